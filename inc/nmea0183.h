@@ -0,0 +1,133 @@
+#ifndef INC_NMEA_0183_H_
+#define INC_NMEA_0183_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+#include "nmeaFields.h"
+#include "nmeaSentences.h"
+
+/**
+ * @brief Called by the parser for every valid sentence of an enabled type.
+ *
+ * The sentence is only valid for the duration of the call; copy what you
+ * need before returning.
+ *
+ * @param sentence Decoded sentence, addressField.sentenceId selects the member.
+ * @param context  The user pointer given to nmeaParserInit().
+ */
+typedef void (*NmeaSentenceCallback)(const NmeaSentence *sentence, void *context);
+
+/**
+ * @brief Optionally called by the parser for every checksum-verified sentence
+ * before it is decoded.
+ *
+ * @param frame    Sentence from the start delimiter up to, excluding, '*'.
+ * @param length   Number of characters in @p frame.
+ * @param checksum The verified checksum, for nmeaDecodeFrame().
+ * @param context  The user pointer given to nmeaParserSetFilter().
+ * @return true to have the parser decode and deliver the sentence, false if
+ *         the filter took it over or discarded it.
+ */
+typedef bool (*NmeaFrameFilter)(const char *frame, size_t length, uint8_t checksum, void *context);
+
+/**
+ * @brief Counters maintained by the byte-feed parser.
+ */
+typedef struct NmeaStatistics
+{
+  uint32_t sentences;            /**< Sentences decoded and delivered to the callback */
+  uint32_t framingErrors;        /**< Overlong or malformed sentences */
+  uint32_t checksumErrors;       /**< Sentences discarded for a bad checksum */
+  uint32_t unsupportedSentences; /**< Valid sentences of an unknown or disabled type */
+  uint32_t fieldErrors;          /**< Sentences with a field that failed to convert */
+  uint32_t filteredSentences;    /**< Sentences the frame filter kept from being decoded */
+} NmeaStatistics;
+
+/* NmeaParser.length and the field lengths of the decoder are uint8_t */
+#if NMEA_MAX_SENTENCE_LENGTH > 255
+#error "NMEA_MAX_SENTENCE_LENGTH must not exceed 255"
+#endif
+
+/**
+ * @brief Byte-feed parser context.
+ *
+ * One context is needed per input stream. The context holds the framing
+ * buffer and the decoded sentence, so nothing large is placed on the stack of
+ * the caller (typically a UART interrupt handler).
+ */
+typedef struct NmeaParser
+{
+  NmeaSentenceCallback callback;            /**< Receives each decoded sentence */
+  void *context;                            /**< User pointer passed to the callback */
+  NmeaFrameFilter filter;                   /**< Sees each sentence before it is decoded, NULL if none */
+  void *filterContext;                      /**< User pointer passed to the filter */
+  NmeaStatistics statistics;                /**< Error and throughput counters */
+  uint8_t state;                            /**< Framing state, internal */
+  uint8_t length;                           /**< Characters held in buffer */
+  uint8_t checksum;                         /**< Running XOR of the sentence characters */
+  uint8_t receivedChecksum;                 /**< Checksum received after '*' */
+  char buffer[NMEA_MAX_SENTENCE_LENGTH];    /**< Sentence from the delimiter up to '*' */
+  NmeaSentence sentence;                    /**< Decode target handed to the callback */
+} NmeaParser;
+
+/**
+ * @brief Calculates the checksum of the characters in [data, data + length).
+ */
+uint8_t nmeaChecksum(const char *data, size_t length);
+
+/**
+ * @brief Decodes one complete sentence.
+ *
+ * @param data    Sentence starting with '$' or '!', trailing CR/LF optional.
+ * @param length  Number of characters in @p data.
+ * @param sentence Receives the decoded sentence.
+ * @return NMEA_OK, or the reason the sentence was rejected.
+ */
+NmeaStatus nmeaDecode(const char *data, size_t length, NmeaSentence *sentence);
+
+/**
+ * @brief Decodes a sentence handed to a frame filter, which has already been
+ * checked against @p checksum.
+ */
+NmeaStatus nmeaDecodeFrame(const char *frame, size_t length, uint8_t checksum, NmeaSentence *sentence);
+
+/**
+ * @brief Encodes a sentence including checksum and trailing CR/LF.
+ *
+ * The output is not NUL terminated.
+ *
+ * @param sentence Sentence to encode, addressField selects the member.
+ * @param buffer   Output buffer.
+ * @param size     Size of @p buffer in bytes.
+ * @param length   Receives the number of characters written.
+ * @return NMEA_OK, NMEA_ERROR_UNSUPPORTED or NMEA_ERROR_BUFFER_SIZE.
+ */
+NmeaStatus nmeaEncode(const NmeaSentence *sentence, char *buffer, size_t size, size_t *length);
+
+/**
+ * @brief Initialises a byte-feed parser.
+ */
+void nmeaParserInit(NmeaParser *parser, NmeaSentenceCallback callback, void *context);
+
+/**
+ * @brief Installs a filter that sees every checksum-verified sentence before
+ * it is decoded, or removes it (NULL).
+ */
+void nmeaParserSetFilter(NmeaParser *parser, NmeaFrameFilter filter, void *context);
+
+/**
+ * @brief Feeds one received character to the parser.
+ *
+ * Decodes and delivers the sentence as soon as its checksum has been
+ * received, without waiting for the CR/LF terminator.
+ */
+void nmeaFeedByte(NmeaParser *parser, uint8_t byte);
+
+/**
+ * @brief Feeds a block of received characters to the parser.
+ */
+void nmeaFeed(NmeaParser *parser, const uint8_t *data, size_t length);
+
+#endif
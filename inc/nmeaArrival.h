@@ -0,0 +1,104 @@
+#ifndef INC_NMEA_ARRIVAL_H_
+#define INC_NMEA_ARRIVAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+#include "nmeaGeodesy.h"
+#include "nmeaNavigator.h"
+#include "nmeaPositionHistory.h"
+
+/* NmeaArrivalDetector.state bits */
+#define NMEA_ARRIVAL_ENTERED (1u << 0) /* Inside the arrival circle */
+#define NMEA_ARRIVAL_PASSED (1u << 1)  /* Past the perpendicular of the inbound leg */
+
+/**
+ * @brief Watches many waypoints and reports arrivals with AAM sentences.
+ *
+ * The waypoints are hashed into a grid of NMEA_ARRIVAL_CELL_DEGREES cells, so
+ * an update only measures the distance to the waypoints in the cells around
+ * the position (with the batch kernels of nmeaGeodesy.h), plus those whose
+ * state is set. An AAM sentence is passed to the callback whenever the
+ * arrival circle or perpendicular state of a waypoint changes, including when
+ * it drops back to V,V. A set state is only cleared once the position is
+ * NMEA_ARRIVAL_HYSTERESIS beyond its boundary, so a fix that wanders along
+ * the circle or the perpendicular does not report every crossing.
+ *
+ * The perpendicular of a waypoint is only checked if it was added with an
+ * inbound leg, and only within the approach range, so the half plane behind
+ * every passed waypoint of a long route does not stay latched.
+ */
+typedef struct NmeaArrivalDetector
+{
+  NmeaSentenceCallback callback; /**< Receives the AAM sentence of each transition */
+  void *context;                 /**< User pointer passed to the callback */
+  TalkerID talkerId;             /**< Talker of the generated sentences */
+  double approachRange;          /**< Nautical miles within which passing the perpendicular counts */
+  double searchRange;            /**< Larger of approachRange and the largest arrival radius, internal */
+  uint16_t count;                /**< Waypoints added */
+  uint16_t activeCount;          /**< Entries in active */
+  NmeaWaypoint waypoints[NMEA_ARRIVAL_MAX_WAYPOINTS]; /**< Watched waypoints */
+  float radius[NMEA_ARRIVAL_MAX_WAYPOINTS];           /**< Arrival circle radii, nautical miles */
+  uint8_t state[NMEA_ARRIVAL_MAX_WAYPOINTS];          /**< NMEA_ARRIVAL_* bits at the last update */
+  float x[NMEA_ARRIVAL_MAX_WAYPOINTS];         /**< Waypoint vectors, internal */
+  float y[NMEA_ARRIVAL_MAX_WAYPOINTS];         /**< Waypoint vectors, internal */
+  float z[NMEA_ARRIVAL_MAX_WAYPOINTS];         /**< Waypoint vectors, internal */
+  float forwardX[NMEA_ARRIVAL_MAX_WAYPOINTS];  /**< Inbound direction of travel, zero without a leg, internal */
+  float forwardY[NMEA_ARRIVAL_MAX_WAYPOINTS];  /**< Inbound direction of travel, internal */
+  float forwardZ[NMEA_ARRIVAL_MAX_WAYPOINTS];  /**< Inbound direction of travel, internal */
+  int32_t cellRow[NMEA_ARRIVAL_MAX_WAYPOINTS]; /**< Grid cell latitude index, internal */
+  int32_t cellColumn[NMEA_ARRIVAL_MAX_WAYPOINTS]; /**< Grid cell longitude index, internal */
+  uint16_t next[NMEA_ARRIVAL_MAX_WAYPOINTS];      /**< Next waypoint in the same bucket, internal */
+  uint16_t buckets[NMEA_ARRIVAL_GRID_BUCKETS];    /**< First waypoint of each bucket, internal */
+  uint16_t active[NMEA_ARRIVAL_MAX_WAYPOINTS];    /**< Waypoints with a state bit set, internal */
+  uint16_t candidates[NMEA_ARRIVAL_MAX_WAYPOINTS]; /**< Waypoints measured by an update, internal */
+  float candidateX[NMEA_ARRIVAL_MAX_WAYPOINTS];    /**< Batch kernel input, internal */
+  float candidateY[NMEA_ARRIVAL_MAX_WAYPOINTS];    /**< Batch kernel input, internal */
+  float candidateZ[NMEA_ARRIVAL_MAX_WAYPOINTS];    /**< Batch kernel input, internal */
+  float distance[NMEA_ARRIVAL_MAX_WAYPOINTS];      /**< Batch kernel output, internal */
+  NmeaSentence sentence;                           /**< AAM handed to the callback, internal */
+} NmeaArrivalDetector;
+
+/**
+ * @brief Initialises a detector without waypoints.
+ *
+ * @param approachRange Nautical miles from a waypoint within which passing
+ *                      its perpendicular is reported.
+ */
+void nmeaArrivalInit(NmeaArrivalDetector *detector, TalkerID talkerId, NmeaSentenceCallback callback,
+                     void *context, double approachRange);
+
+/**
+ * @brief Adds a waypoint to watch.
+ *
+ * @param previous      Origin of the leg into the waypoint, enabling the
+ *                      perpendicular check, or NULL for a lone waypoint.
+ * @param arrivalRadius Arrival circle radius in nautical miles.
+ * @return false if NMEA_ARRIVAL_MAX_WAYPOINTS waypoints are already watched.
+ */
+bool nmeaArrivalAdd(NmeaArrivalDetector *detector, const NmeaWaypoint *waypoint, const NmeaWaypoint *previous,
+                    double arrivalRadius);
+
+/**
+ * @brief Adds the waypoints of a route, each with the leg from its
+ * predecessor as inbound leg.
+ *
+ * @return The number of waypoints added, less than count if the detector
+ *         filled up.
+ */
+uint16_t nmeaArrivalAddRoute(NmeaArrivalDetector *detector, const NmeaWaypoint *route, uint16_t count,
+                             double arrivalRadius);
+
+/**
+ * @brief Checks a new position against the waypoints and calls the callback
+ * with an AAM sentence for every waypoint whose state changed.
+ *
+ * Distances come from the float batch kernels, so a circle boundary is
+ * resolved to NMEA_FAST_DISTANCE_ERROR.
+ *
+ * @return The number of transitions.
+ */
+uint16_t nmeaArrivalUpdate(NmeaArrivalDetector *detector, const NmeaFix *fix);
+
+#endif
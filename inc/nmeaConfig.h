@@ -1,7 +1,10 @@
 #ifndef INC_NMEA_CONFIG_H_
 #define INC_NMEA_CONFIG_H_
 
+#include <stdbool.h>
+
 /* Enabled the sentences and functionlity that you require */
+/* BEGIN GENERATED: sentence switches */
 #define CFG_SENTENCE_AAM_ENABLED true
 #define CFG_SENTENCE_ABK_ENABLED true
 #define CFG_SENTENCE_ABM_ENABLED true
@@ -17,13 +20,119 @@
 #define CFG_SENTENCE_ALR_ENABLED true
 #define CFG_SENTENCE_APB_ENABLED true
 #define CFG_SENTENCE_ARC_ENABLED true
+#define CFG_SENTENCE_BOD_ENABLED true
+#define CFG_SENTENCE_BWC_ENABLED true
+#define CFG_SENTENCE_DTM_ENABLED true
+#define CFG_SENTENCE_GGA_ENABLED true
+#define CFG_SENTENCE_GSA_ENABLED true
+#define CFG_SENTENCE_GST_ENABLED true
+#define CFG_SENTENCE_GSV_ENABLED true
+#define CFG_SENTENCE_HDT_ENABLED true
+#define CFG_SENTENCE_RMB_ENABLED true
+#define CFG_SENTENCE_RMC_ENABLED true
+#define CFG_SENTENCE_VTG_ENABLED true
+#define CFG_SENTENCE_XTE_ENABLED true
+#define CFG_SENTENCE_ZDA_ENABLED true
+/* END GENERATED: sentence switches */
 
 /* Sentence configuration parameters */
+/* BEGIN GENERATED: sentence parameters */
 #define AAM_WAYPOINT_MAX_LENGTH 64
 #define ABM_DATA_MAX_LENGTH 60
 #define ALA_DETAIL_MAX_LENGTH 64
 #define ALC_MAX_ALERT_ENTRIES 128
+#define ALF_ALERT_TEXT_MAX_LENGTH 64
 #define ALR_ALARM_DESCRIPTION_MAX_LENGTH 64
 #define APB_WAYPOINT_MAX_LENGTH 32
+#define BOD_WAYPOINT_MAX_LENGTH 32
+#define BWC_WAYPOINT_MAX_LENGTH 32
+#define RMB_WAYPOINT_MAX_LENGTH 32
+/* END GENERATED: sentence parameters */
+
+/* Fields decoded per sentence, a mask of <ID>_<FIELD>_PRESENT bits, e.g.
+ * (APB_XTE_MAGNITUDE_PRESENT | APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT).
+ * The other fields are skipped unconverted and encoded as null fields; bits
+ * outside <ID>_ALL_PRESENT stop the build. */
+/* BEGIN GENERATED: sentence field masks */
+#define CFG_SENTENCE_AAM_FIELDS AAM_ALL_PRESENT
+#define CFG_SENTENCE_ABK_FIELDS ABK_ALL_PRESENT
+#define CFG_SENTENCE_ABM_FIELDS ABM_ALL_PRESENT
+#define CFG_SENTENCE_ACA_FIELDS ACA_ALL_PRESENT
+#define CFG_SENTENCE_ACK_FIELDS ACK_ALL_PRESENT
+#define CFG_SENTENCE_ACN_FIELDS ACN_ALL_PRESENT
+#define CFG_SENTENCE_ACS_FIELDS ACS_ALL_PRESENT
+#define CFG_SENTENCE_AIR_FIELDS AIR_ALL_PRESENT
+#define CFG_SENTENCE_AKD_FIELDS AKD_ALL_PRESENT
+#define CFG_SENTENCE_ALA_FIELDS ALA_ALL_PRESENT
+#define CFG_SENTENCE_ALC_FIELDS ALC_ALL_PRESENT
+#define CFG_SENTENCE_ALF_FIELDS ALF_ALL_PRESENT
+#define CFG_SENTENCE_ALR_FIELDS ALR_ALL_PRESENT
+#define CFG_SENTENCE_APB_FIELDS APB_ALL_PRESENT
+#define CFG_SENTENCE_ARC_FIELDS ARC_ALL_PRESENT
+#define CFG_SENTENCE_BOD_FIELDS BOD_ALL_PRESENT
+#define CFG_SENTENCE_BWC_FIELDS BWC_ALL_PRESENT
+#define CFG_SENTENCE_DTM_FIELDS DTM_ALL_PRESENT
+#define CFG_SENTENCE_GGA_FIELDS GGA_ALL_PRESENT
+#define CFG_SENTENCE_GSA_FIELDS GSA_ALL_PRESENT
+#define CFG_SENTENCE_GST_FIELDS GST_ALL_PRESENT
+#define CFG_SENTENCE_GSV_FIELDS GSV_ALL_PRESENT
+#define CFG_SENTENCE_HDT_FIELDS HDT_ALL_PRESENT
+#define CFG_SENTENCE_RMB_FIELDS RMB_ALL_PRESENT
+#define CFG_SENTENCE_RMC_FIELDS RMC_ALL_PRESENT
+#define CFG_SENTENCE_VTG_FIELDS VTG_ALL_PRESENT
+#define CFG_SENTENCE_XTE_FIELDS XTE_ALL_PRESENT
+#define CFG_SENTENCE_ZDA_FIELDS ZDA_ALL_PRESENT
+/* END GENERATED: sentence field masks */
+#define CFG_OMIT_MASKED_FIELDS false /* Also leave masked out fields out of the sentence structures */
+
+/* Parser configuration parameters */
+#define NMEA_MAX_SENTENCE_LENGTH 82 /* Including start delimiter, checksum and CR/LF */
+#define NMEA_STACK_BUDGET 512       /* Stack bytes for nmeaFeedByte(), callback excluded; see tools/stackreport.py */
+
+/* Encoder configuration parameters: fraction digits written for each fixed format field type */
+#define NMEA_TIME_DECIMALS 2      /* hhmmss.ss */
+#define NMEA_LATITUDE_DECIMALS 2  /* llll.ll, up to 4; fields are floats of about 7 significant digits */
+#define NMEA_LONGITUDE_DECIMALS 2 /* yyyyy.yy, up to 4; more would only print float rounding noise */
+
+/* Position history configuration parameters */
+#define NMEA_POSITION_HISTORY_LENGTH 64 /* Fixes kept by NmeaPositionHistory */
+
+/* Epoch grouper configuration parameters */
+#define NMEA_EPOCH_MAX_SATELLITES 32 /* GSV satellites merged into one NmeaEpoch */
+
+/* Navigator configuration parameters */
+#define NMEA_WAYPOINT_ID_SIZE 16 /* Including the NUL terminator */
+
+/* Arrival detector configuration parameters */
+#define NMEA_ARRIVAL_MAX_WAYPOINTS 256 /* Waypoints watched by one NmeaArrivalDetector */
+#define NMEA_ARRIVAL_CELL_DEGREES 0.25 /* Spatial grid cell size in latitude and longitude */
+#define NMEA_ARRIVAL_GRID_BUCKETS 64   /* Hash buckets the occupied grid cells are spread over */
+#define NMEA_ARRIVAL_HYSTERESIS 0.01   /* Nautical miles past a boundary before a set state is cleared */
+
+/* Datum stage configuration parameters */
+#define NMEA_DATUM_MAX_DEFINITIONS 8 /* Local datums with offsets known in advance */
+
+/* Load shedder configuration parameters */
+#define NMEA_SHEDDER_QUEUE_LENGTH 16  /* Framed sentences queued per priority class, a power of two */
+#define NMEA_SHEDDER_MAX_RULES 32     /* Sentence IDs with a priority other than normal */
+#define NMEA_SHEDDER_OVERRUN_DRAINS 4 /* Drains in a row out of budget before one more class is shed */
+/* Default priority classes; every other sentence is normal */
+#define NMEA_SHEDDER_CRITICAL_SENTENCES ALR, ALF, ALC, ALA, ACN, ACK, AKD, ARC, HDT, HDG, THS, ROT
+#define NMEA_SHEDDER_HIGH_SENTENCES GGA, RMC, GNS, GLL, VTG, ZDA, DTM, APB, XTE, RMB, BWC, AAM
+#define NMEA_SHEDDER_LOW_SENTENCES VDM, VDO, ABM, BBM, GSV, GST, TXT
+
+/* DMA receiver configuration parameters */
+#define NMEA_DMA_BUFFER_SIZE 256 /* Circular DMA receive buffer, at least two sentences */
+
+/* Linux serial reader configuration parameters (platform/linux) */
+#define NMEA_SERIAL_MAX_PORTS 32   /* Ports multiplexed by one NmeaSerialReader */
+#define NMEA_SERIAL_READ_SIZE 4096 /* Bytes taken from a port per read() */
+
+/* Linux output writer configuration parameters (platform/linux) */
+#define NMEA_OUTPUT_BUFFER_SIZE 4096 /* Bytes of encoded sentences one NmeaOutputWriter holds */
+#define NMEA_OUTPUT_MAX_SENTENCES 64 /* Sentences per writev() or sendmmsg() */
+
+/* Shared-memory ring configuration parameters (platform/linux) */
+#define NMEA_SHARED_SLOTS 1024 /* Sentences kept for the readers, a power of two */
 
 #endif
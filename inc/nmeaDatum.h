@@ -0,0 +1,82 @@
+#ifndef INC_NMEA_DATUM_H_
+#define INC_NMEA_DATUM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+#include "nmeaSentences.h"
+
+/**
+ * @brief Offsets of a local datum from WGS-84, in the fixed point units the
+ * datum stage works in.
+ */
+typedef struct NmeaDatum
+{
+  char code[4];            /**< Local datum code, e.g. "W72" or an IHO code */
+  char subdivision;        /**< Subdivision code, '\0' if none */
+  int32_t latitudeOffset;  /**< 1/10000 minutes, north positive */
+  int32_t longitudeOffset; /**< 1/10000 minutes, east positive */
+  int32_t altitudeOffset;  /**< Centimetres */
+} NmeaDatum;
+
+/**
+ * @brief Pipeline stage converting positions to WGS-84.
+ *
+ * Sits between the parser and the consumers: pass nmeaDatumCallback and the
+ * stage to nmeaParserInit() and the consumer callback to nmeaDatumInit().
+ * A DTM sentence selects the datum of the positions that follow, with the
+ * offsets it carries or, if it has none, those defined in advance for its
+ * local datum code. The stage then subtracts the offsets from the positions
+ * of GGA, RMC, BWC and RMB (and from the GGA altitude) before passing the
+ * sentences on, and replaces the DTM by one for WGS-84 without offsets, so
+ * no consumer has to track the datum.
+ *
+ * Positions are shifted as integer 1/10000 minutes rather than in the float
+ * ddmm.mm representation, so a shift never disturbs the degrees and minutes
+ * split or accumulates rounding.
+ *
+ * Positions of a datum without known offsets, or with a reference datum other
+ * than WGS-84, are passed on unchanged together with their DTM.
+ */
+typedef struct NmeaDatumStage
+{
+  NmeaSentenceCallback callback; /**< Receives the converted sentences */
+  void *context;                 /**< User pointer passed to the callback */
+  uint32_t transformed;          /**< Sentences whose positions were shifted */
+  uint32_t untransformed;        /**< Sentences with positions in a datum without known offsets */
+  uint8_t count;                 /**< Entries in datums */
+  NmeaDatum datums[NMEA_DATUM_MAX_DEFINITIONS]; /**< Datums defined in advance */
+  NmeaDatum active;                             /**< Datum of the current positions */
+  bool known;                                   /**< The offsets of the active datum are known */
+  NmeaSentence sentence;                        /**< Converted copy handed to the callback, internal */
+} NmeaDatumStage;
+
+/**
+ * @brief Initialises a stage; positions are taken as WGS-84 until a DTM
+ * sentence says otherwise.
+ */
+void nmeaDatumInit(NmeaDatumStage *stage, NmeaSentenceCallback callback, void *context);
+
+/**
+ * @brief Defines the offsets of a local datum for receivers that send its
+ * code in DTM without the offsets. The offsets are converted to the fixed
+ * point units once, here.
+ *
+ * @param code            Local datum code as sent in DTM.
+ * @param subdivision     Subdivision code, '\0' if none.
+ * @param latitudeOffset  Minutes, local datum minus WGS-84, north positive.
+ * @param longitudeOffset Minutes, local datum minus WGS-84, east positive.
+ * @param altitudeOffset  Metres, local datum minus WGS-84.
+ * @return false if NMEA_DATUM_MAX_DEFINITIONS datums are already defined.
+ */
+bool nmeaDatumDefine(NmeaDatumStage *stage, const char *code, char subdivision, double latitudeOffset,
+                     double longitudeOffset, double altitudeOffset);
+
+/**
+ * @brief NmeaSentenceCallback of the stage: pass the stage as the parser
+ * context.
+ */
+void nmeaDatumCallback(const NmeaSentence *sentence, void *context);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef INC_NMEA_DECIMAL_H_
+#define INC_NMEA_DECIMAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief A decimal number as written in a sentence field.
+ *
+ * NMEA 0183 numeric fields use a restricted grammar: an optional sign, digits,
+ * and an optional '.' followed by more digits. There is no exponent, no
+ * whitespace and the radix character never depends on the locale. The value
+ * of the field is (negative ? -1 : 1) * mantissa / 10^fractionDigits.
+ */
+typedef struct NmeaDecimal
+{
+  uint64_t mantissa;      /**< All digits of the field as one integer */
+  uint8_t fractionDigits; /**< Number of digits after the decimal point */
+  bool negative;          /**< A leading '-' was present */
+} NmeaDecimal;
+
+/**
+ * @brief Parses a decimal field.
+ *
+ * Runs of up to eight digits are located and converted at once using SWAR
+ * arithmetic, so a typical position or time field costs a handful of
+ * multiplications instead of one per character.
+ *
+ * @param data    First character of the field, need not be NUL terminated.
+ * @param length  Number of characters in the field.
+ * @param decimal Receives the parsed number.
+ * @return false if the field is empty, contains anything other than the
+ *         grammar above, or holds more than 19 digits.
+ */
+bool nmeaParseDecimal(const char *data, uint8_t length, NmeaDecimal *decimal);
+
+/**
+ * @brief Converts to the nearest float.
+ *
+ * The result is correctly rounded for mantissas up to 2^53 (every number of
+ * up to 15 digits) with up to eight fraction digits, which covers every field
+ * defined by IEC 61162-1. Longer mantissas are rounded to double first and
+ * may be one unit off in the last place.
+ */
+float nmeaDecimalToFloat(const NmeaDecimal *decimal);
+
+/**
+ * @brief Converts to the nearest double.
+ *
+ * The result is correctly rounded when the mantissa has at most 15 digits.
+ */
+double nmeaDecimalToDouble(const NmeaDecimal *decimal);
+
+/**
+ * @brief Converts to an integer scaled by 10^decimals, e.g. "4807.038" with
+ * 4 decimals gives 48070380.
+ *
+ * Excess fraction digits are rounded half away from zero.
+ *
+ * @return false if the scaled value does not fit in an int32_t.
+ */
+bool nmeaDecimalToScaled(const NmeaDecimal *decimal, uint8_t decimals, int32_t *value);
+
+/**
+ * @brief Parses an unsigned decimal integer field, e.g. a 9 digit MMSI.
+ *
+ * Uses the same SWAR digit runs as nmeaParseDecimal(): an MMSI converts in
+ * two steps, a two digit counter in one.
+ *
+ * @param data   First character of the field, need not be NUL terminated.
+ * @param length Number of characters in the field.
+ * @param value  Receives the parsed value.
+ * @return false if the field is empty, contains a non-digit, or the value
+ *         exceeds UINT32_MAX.
+ */
+bool nmeaParseUint32(const char *data, uint8_t length, uint32_t *value);
+
+/* Fraction digits supported by nmeaFormatDecimal() */
+#define NMEA_FORMAT_MAX_DECIMALS 9
+
+/* Largest output of nmeaFormatDecimal(), at most 20 integer digits (or the
+ * padding), sign, point and NMEA_FORMAT_MAX_DECIMALS fraction digits */
+#define NMEA_FORMAT_MAX_LENGTH 32
+
+/**
+ * @brief Formats a float as a fixed point decimal field, e.g. 4807.038f with
+ * 4 minimum integer digits and 2 decimals gives "4807.04".
+ *
+ * Uses integer arithmetic only: the float is split into its binary mantissa
+ * and exponent, scaled by 10^decimals and rounded once, so the output is the
+ * same as snprintf("%0*.*f") without the cost of the C library formatter.
+ * The integer part is zero padded to at least @p minDigits (at most 20).
+ *
+ * @param text      Receives the characters, not NUL terminated; must hold
+ *                  NMEA_FORMAT_MAX_LENGTH characters.
+ * @param value     Value to format.
+ * @param minDigits Minimum number of integer digits.
+ * @param decimals  Number of fraction digits, at most NMEA_FORMAT_MAX_DECIMALS.
+ * @return The number of characters written, or 0 if the value is not finite,
+ *         its scaled magnitude does not fit in 64 bits or @p decimals is out
+ *         of range.
+ */
+uint8_t nmeaFormatDecimal(char *text, float value, uint8_t minDigits, uint8_t decimals);
+
+#endif
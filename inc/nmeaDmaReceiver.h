@@ -0,0 +1,95 @@
+#ifndef INC_NMEA_DMA_RECEIVER_H_
+#define INC_NMEA_DMA_RECEIVER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+
+/**
+ * @brief Receive events the UART and DMA controller interrupt on.
+ */
+typedef enum NmeaDmaEvent
+{
+  NMEA_DMA_EVENT_IDLE,     /**< Receive line idle for one character time after data */
+  NMEA_DMA_EVENT_MATCH,    /**< Character match on '\n', the end of a sentence */
+  NMEA_DMA_EVENT_HALF,     /**< DMA filled the first half of the buffer */
+  NMEA_DMA_EVENT_COMPLETE, /**< DMA filled the second half and wrapped */
+  NMEA_DMA_EVENT_COUNT
+} NmeaDmaEvent;
+
+/**
+ * @brief UART and DMA driver functions the receiver needs.
+ *
+ * On an STM32, for example, start() enables circular DMA from USART_RDR into
+ * the buffer with the half and complete transfer interrupts, the IDLE
+ * interrupt (USART_CR1_IDLEIE) and the character match interrupt on '\n'
+ * (USART_CR2_ADD, USART_CR1_CMIE); remaining() returns DMA_CNDTR.
+ */
+typedef struct NmeaDmaHal
+{
+  /** Starts circular reception into buffer and enables the events, false on failure */
+  bool (*start)(void *port, uint8_t *buffer, size_t size);
+  /** Bytes the DMA will write before it wraps to the start of the buffer, 1 to size */
+  size_t (*remaining)(void *port);
+  /** Stops reception and disables the events */
+  void (*stop)(void *port);
+} NmeaDmaHal;
+
+/**
+ * @brief Counters maintained by the DMA receiver.
+ */
+typedef struct NmeaDmaStatistics
+{
+  uint32_t events[NMEA_DMA_EVENT_COUNT]; /**< nmeaDmaService() calls per event */
+  uint32_t bytes;                        /**< Bytes fed to the parser */
+} NmeaDmaStatistics;
+
+/**
+ * @brief DMA receive mode: a circular DMA buffer is filled by the hardware
+ * and handed to the parser in whole chunks.
+ *
+ * Instead of one interrupt per received byte, the CPU wakes up on the idle
+ * line and '\n' character match events, about once per sentence, and on the
+ * half and complete transfer events, which guarantee the buffer is emptied
+ * at least twice per lap. Each wake-up feeds everything received since the
+ * previous one to the parser.
+ *
+ * NMEA_DMA_BUFFER_SIZE must hold what arrives while the interrupt is
+ * masked or delayed; the receiver cannot tell whether the DMA lapped it.
+ */
+typedef struct NmeaDmaReceiver
+{
+  const NmeaDmaHal *hal;                /**< Driver functions */
+  void *port;                           /**< Driver handle passed to the HAL */
+  size_t readIndex;                     /**< Buffer position fed to the parser up to, internal */
+  NmeaDmaStatistics statistics;         /**< Wake-ups and bytes */
+  NmeaParser parser;                    /**< Parser fed from the buffer */
+  uint8_t buffer[NMEA_DMA_BUFFER_SIZE]; /**< Circular DMA buffer */
+} NmeaDmaReceiver;
+
+/**
+ * @brief Initialises the receiver and its parser and starts reception.
+ *
+ * @return false if the HAL could not start reception.
+ */
+bool nmeaDmaInit(NmeaDmaReceiver *receiver, const NmeaDmaHal *hal, void *port, NmeaSentenceCallback callback,
+                 void *context);
+
+/**
+ * @brief Feeds the bytes received since the previous call to the parser.
+ *
+ * Call it from the handlers of all four events, or from a main loop woken by
+ * them; the sentences are delivered from the calling context.
+ *
+ * @param event The event that caused the call, for the statistics.
+ */
+void nmeaDmaService(NmeaDmaReceiver *receiver, NmeaDmaEvent event);
+
+/**
+ * @brief Stops reception, after feeding what is left in the buffer.
+ */
+void nmeaDmaStop(NmeaDmaReceiver *receiver);
+
+#endif
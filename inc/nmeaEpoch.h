@@ -0,0 +1,106 @@
+#ifndef INC_NMEA_EPOCH_H_
+#define INC_NMEA_EPOCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+#include "nmeaSentences.h"
+
+/* NmeaEpoch.sentences bits */
+#define NMEA_EPOCH_GGA (1u << 0)
+#define NMEA_EPOCH_RMC (1u << 1)
+#define NMEA_EPOCH_GSA (1u << 2)
+#define NMEA_EPOCH_GSV (1u << 3)
+#define NMEA_EPOCH_GST (1u << 4)
+#define NMEA_EPOCH_VTG (1u << 5)
+#define NMEA_EPOCH_ZDA (1u << 6)
+
+/**
+ * @brief Everything a GNSS receiver reported for one fix epoch.
+ *
+ * Only the members flagged in @p sentences hold data. When a sentence type
+ * occurs more than once in an epoch (e.g. one GSA per constellation) the last
+ * one is kept; the satellites of all GSV sentences are merged.
+ */
+typedef struct NmeaEpoch
+{
+  float utcTime;     /**< UTC of the epoch (hhmmss.ss), valid if hasTime */
+  bool hasTime;      /**< A sentence of the epoch carried its time */
+  uint8_t sentences; /**< NMEA_EPOCH_* bits of the sentences received */
+#if CFG_SENTENCE_GGA_ENABLED
+  SENTENCE_GGA gga; /**< Fix data */
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  SENTENCE_RMC rmc; /**< Recommended minimum data */
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  SENTENCE_GSA gsa; /**< DOP and active satellites */
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  uint8_t satelliteCount;                                /**< Entries in satellites */
+  SatelliteInView satellites[NMEA_EPOCH_MAX_SATELLITES]; /**< Satellites in view from all GSV sentences */
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  SENTENCE_GST gst; /**< Pseudorange noise statistics */
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  SENTENCE_VTG vtg; /**< Course and speed over ground */
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  SENTENCE_ZDA zda; /**< Time and date */
+#endif
+} NmeaEpoch;
+
+/**
+ * @brief Called once per completed epoch.
+ *
+ * The epoch is only valid for the duration of the call.
+ */
+typedef void (*NmeaEpochCallback)(const NmeaEpoch *epoch, void *context);
+
+/**
+ * @brief Groups the sentences of a GNSS receiver into fix epochs.
+ *
+ * An epoch ends when a sentence carries a different UTC time than the epoch
+ * (GGA, RMC, GST and ZDA carry one), or right after the terminator sentence
+ * if one is configured. The time change only shows with the first sentence
+ * of the next epoch; a terminator delivers each epoch as soon as it is
+ * complete.
+ */
+typedef struct NmeaEpochGrouper
+{
+  NmeaEpochCallback callback; /**< Receives each completed epoch */
+  void *context;              /**< User pointer passed to the callback */
+  SentenceID terminator;      /**< Last sentence of every epoch, 0 if none */
+  uint32_t epochs;            /**< Epochs delivered so far */
+  NmeaEpoch epoch;            /**< Epoch being collected, internal */
+} NmeaEpochGrouper;
+
+/**
+ * @brief Initialises a grouper.
+ *
+ * @param terminator Sentence the receiver sends last in every epoch, e.g. ZDA,
+ *                   or 0 to detect epochs by time changes only. For GSV the
+ *                   last sentence of the GSV series ends the epoch, which
+ *                   needs its sentence numbers in CFG_SENTENCE_GSV_FIELDS.
+ */
+void nmeaEpochInit(NmeaEpochGrouper *grouper, NmeaEpochCallback callback, void *context, SentenceID terminator);
+
+/**
+ * @brief Adds a decoded sentence, delivering the previous epoch if this one
+ * starts a new one. Sentences that are not part of a fix are ignored.
+ */
+void nmeaEpochAdd(NmeaEpochGrouper *grouper, const NmeaSentence *sentence);
+
+/**
+ * @brief Delivers the epoch being collected, if it holds any sentence.
+ */
+void nmeaEpochFlush(NmeaEpochGrouper *grouper);
+
+/**
+ * @brief NmeaSentenceCallback adapter: pass the grouper as the parser context
+ * to group sentences straight from nmeaFeed().
+ */
+void nmeaEpochCallback(const NmeaSentence *sentence, void *context);
+
+#endif
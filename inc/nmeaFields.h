@@ -0,0 +1,130 @@
+#ifndef INC_NMEA_FIELDS_H_
+#define INC_NMEA_FIELDS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+
+/**
+ * @brief Result of decoding or encoding a sentence.
+ */
+typedef enum NmeaStatus
+{
+  NMEA_OK = 0,             /**< Sentence decoded/encoded successfully */
+  NMEA_ERROR_FRAMING,      /**< Missing delimiter, malformed address or sentence too long */
+  NMEA_ERROR_CHECKSUM,     /**< Missing checksum or checksum mismatch */
+  NMEA_ERROR_UNSUPPORTED,  /**< Sentence formatter unknown or disabled in nmeaConfig.h */
+  NMEA_ERROR_FIELD,        /**< A field holds characters that are invalid for its type */
+  NMEA_ERROR_BUFFER_SIZE   /**< Output buffer too small for the encoded sentence */
+} NmeaStatus;
+
+/**
+ * @brief A single comma delimited field of a sentence.
+ *
+ * Fields point into the sentence buffer and are not NUL terminated. A null
+ * field (two adjacent delimiters) has a length of zero.
+ */
+typedef struct NmeaField
+{
+  const char *data; /**< First character of the field */
+  uint8_t length;   /**< Number of characters in the field */
+} NmeaField;
+
+/**
+ * @brief Read position within the data fields of a sentence.
+ *
+ * The cursor spans the characters between the comma following the address
+ * field and the checksum delimiter '*'.
+ */
+typedef struct NmeaCursor
+{
+  const char *next; /**< Start of the next field */
+  const char *end;  /**< One past the last data character */
+} NmeaCursor;
+
+/**
+ * @brief Bounded output buffer used by the sentence encoders.
+ *
+ * The writer accumulates the sentence checksum as characters are written, so
+ * encoding is a single pass over the output.
+ */
+typedef struct NmeaWriter
+{
+  char *next;       /**< Next character to write */
+  char *end;        /**< One past the last writable character */
+  uint8_t checksum; /**< XOR of every checksummed character written so far */
+  bool overflow;    /**< Set when a write did not fit in the buffer or a value could not be formatted */
+} NmeaWriter;
+
+/**
+ * @brief Returns the next field and advances the cursor past its delimiter.
+ *
+ * Once the cursor is exhausted every further call returns a null field, so
+ * decoders treat missing trailing fields (older talkers) as null fields.
+ */
+NmeaField nmeaNextField(NmeaCursor *cursor);
+
+/**
+ * @brief Converts a single character field. A null field yields '\0'.
+ * @return false if the field holds more than one character.
+ */
+bool nmeaFieldToChar(NmeaField field, char *value);
+
+/**
+ * @brief Converts an unsigned decimal field. A null field yields 0.
+ * @return false on a non-digit character or if the value does not fit.
+ */
+bool nmeaFieldToUint8(NmeaField field, uint8_t *value);
+bool nmeaFieldToUint16(NmeaField field, uint16_t *value);
+bool nmeaFieldToUint32(NmeaField field, uint32_t *value);
+
+/**
+ * @brief Converts a decimal field (optional sign, digits, optional fraction).
+ * A null field yields 0.0. The result is correctly rounded and does not
+ * depend on the C locale, see nmeaParseDecimal().
+ * @return false if the field is not a valid decimal number.
+ */
+bool nmeaFieldToFloat(NmeaField field, float *value);
+
+/**
+ * @brief Copies a text field into a NUL terminated buffer of @p size bytes.
+ * @return false if the field was truncated to fit.
+ */
+bool nmeaFieldToText(NmeaField field, char *text, size_t size);
+
+/**
+ * @brief Prepares @p writer to fill @p size bytes of @p buffer.
+ */
+void nmeaWriterInit(NmeaWriter *writer, char *buffer, size_t size);
+
+/**
+ * @brief Writes a character and adds it to the running checksum.
+ */
+void nmeaPutChar(NmeaWriter *writer, char c);
+
+/**
+ * @brief Writes a single character field; '\0' produces a null field.
+ */
+void nmeaPutFieldChar(NmeaWriter *writer, char c);
+
+/**
+ * @brief Writes an unsigned decimal, zero padded to at least @p minDigits.
+ */
+void nmeaPutUint(NmeaWriter *writer, uint32_t value, uint8_t minDigits);
+
+/**
+ * @brief Writes a fixed point decimal with @p decimals fractional digits and
+ * the integer part zero padded to at least @p minDigits (e.g. 4 for llll.ll).
+ *
+ * Non-finite values and values too large for nmeaFormatDecimal() set the
+ * overflow flag instead of writing anything.
+ */
+void nmeaPutFloat(NmeaWriter *writer, float value, uint8_t minDigits, uint8_t decimals);
+
+/**
+ * @brief Writes a NUL terminated text field.
+ */
+void nmeaPutText(NmeaWriter *writer, const char *text);
+
+#endif
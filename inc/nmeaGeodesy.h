@@ -0,0 +1,128 @@
+#ifndef INC_NMEA_GEODESY_H_
+#define INC_NMEA_GEODESY_H_
+
+/*
+ * Spherical earth navigation math. Positions are signed degrees (north and
+ * east positive), bearings are degrees true in [0, 360) and distances are
+ * nautical miles.
+ *
+ * Great circle functions work on unit position vectors (n-vectors), so a
+ * position used repeatedly only pays for its sines and cosines once.
+ *
+ * The double precision functions are the reference. The batch kernels trade
+ * accuracy for speed: they take waypoints as float vectors in structure of
+ * arrays layout and use a polynomial arctangent instead of libm. Their loops
+ * only vectorise once sqrtf() need not set errno and the arctangent's selects
+ * may be evaluated unconditionally: with GCC, build nmeaGeodesy.c with
+ * -O3 -fno-math-errno -fno-trapping-math and check with -fopt-info-vec; plain
+ * -O3 leaves them scalar. Their error stays below NMEA_FAST_DISTANCE_ERROR
+ * and NMEA_FAST_BEARING_ERROR, see tools/bench/benchGeodesy.c. A float vector
+ * pins a position to about half a metre, so bearings to waypoints closer
+ * than a nautical mile lose precision.
+ */
+
+#include <stddef.h>
+
+#define NMEA_EARTH_RADIUS_NM 3440.065 /* Mean earth radius in nautical miles */
+
+#define NMEA_FAST_ATAN2_ERROR 1e-6f     /* Radians, nmeaFastAtan2() */
+#define NMEA_FAST_DISTANCE_ERROR 0.002f /* Nautical miles (< 4 m), batch distances and offsets */
+#define NMEA_FAST_BEARING_ERROR 0.05f   /* Degrees, batch bearings to waypoints over 1 NM away */
+
+/**
+ * @brief Earth centred unit vector of a position; z points to the north pole
+ * and x to latitude 0, longitude 0.
+ */
+typedef struct NmeaVector
+{
+  double x; /**< Towards latitude 0, longitude 0 */
+  double y; /**< Towards latitude 0, longitude 90 east */
+  double z; /**< Towards the north pole */
+} NmeaVector;
+
+/**
+ * @brief Converts a position to its unit vector.
+ */
+NmeaVector nmeaGeoVector(double latitude, double longitude);
+
+/**
+ * @brief Dot product, the cosine of the angle between two unit vectors.
+ */
+double nmeaGeoDot(const NmeaVector *a, const NmeaVector *b);
+
+/**
+ * @brief Cross product, normal to the great circle through @p a and @p b.
+ */
+NmeaVector nmeaGeoCross(const NmeaVector *a, const NmeaVector *b);
+
+/**
+ * @brief Scales a vector to unit length; the zero vector is returned as is.
+ */
+NmeaVector nmeaGeoNormalise(const NmeaVector *v);
+
+/**
+ * @brief Great circle distance between two positions.
+ */
+double nmeaGreatCircleDistance(const NmeaVector *from, const NmeaVector *to);
+
+/**
+ * @brief Initial great circle bearing from one position towards another.
+ */
+double nmeaGreatCircleBearing(const NmeaVector *from, const NmeaVector *to);
+
+/**
+ * @brief Signed distance of a position from the great circle with the given
+ * unit normal, positive on the side the normal points to.
+ */
+double nmeaGreatCircleOffset(const NmeaVector *normal, const NmeaVector *position);
+
+/**
+ * @brief Constant bearing (loxodrome) between two positions.
+ */
+double nmeaRhumbBearing(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude);
+
+/**
+ * @brief Length of the rhumb line between two positions.
+ */
+double nmeaRhumbDistance(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude);
+
+/**
+ * @brief Polynomial atan2, within NMEA_FAST_ATAN2_ERROR of atan2().
+ *
+ * Selects instead of branches, so loops calling it can vectorise (see the
+ * flags above). atan2(0, 0) gives 0.
+ */
+float nmeaFastAtan2(float y, float x);
+
+/**
+ * @brief Converts positions to float unit vectors in structure of arrays
+ * layout, as used by the batch kernels. Done once per waypoint.
+ */
+void nmeaGeoVectorBatch(const double *latitude, const double *longitude, size_t count, float *x, float *y,
+                        float *z);
+
+/**
+ * @brief Great circle distance and initial bearing from one position to many
+ * waypoints.
+ *
+ * @param from     Own position.
+ * @param x, y, z  Waypoint vectors from nmeaGeoVectorBatch().
+ * @param count    Number of waypoints.
+ * @param distance Receives count distances, nautical miles.
+ * @param bearing  Receives count bearings, degrees true, or NULL to skip them.
+ */
+void nmeaGreatCircleBatch(const NmeaVector *from, const float *x, const float *y, const float *z, size_t count,
+                          float *distance, float *bearing);
+
+/**
+ * @brief Signed distance of many positions from one great circle, e.g. the
+ * cross-track error of many targets against a leg.
+ *
+ * @param normal Unit normal of the great circle.
+ * @param offset Receives count distances, nautical miles, positive on the
+ *               side the normal points to.
+ */
+void nmeaGreatCircleOffsetBatch(const NmeaVector *normal, const float *x, const float *y, const float *z,
+                                size_t count, float *offset);
+
+#endif
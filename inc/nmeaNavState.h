@@ -0,0 +1,145 @@
+#ifndef INC_NMEA_NAV_STATE_H_
+#define INC_NMEA_NAV_STATE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+#include "nmeaSentences.h"
+
+/**
+ * @brief Latest position fix, merged from GGA and RMC sentences.
+ */
+typedef struct NmeaNavPosition
+{
+  double latitude;    /**< Degrees, north positive, kept while there is no fix */
+  double longitude;   /**< Degrees, east positive */
+  float utcTime;      /**< UTC of the last GGA or RMC, hhmmss.ss, also without a fix */
+  uint32_t date;      /**< Date of the fix (ddmmyy) from RMC, 0 until known */
+  float altitude;     /**< Metres above mean sea level, from GGA */
+  float hdop;         /**< Horizontal dilution of precision, from GGA */
+  uint8_t quality;    /**< GPSQualityIndicator of the last GGA */
+  uint8_t satellites; /**< Satellites in use, from GGA */
+  bool valid;         /**< The last GGA or RMC reported a valid fix */
+} NmeaNavPosition;
+
+/**
+ * @brief Latest course and speed over ground, from RMC and VTG sentences.
+ */
+typedef struct NmeaNavMotion
+{
+  float courseOverGround; /**< Degrees true */
+  float speedOverGround;  /**< Knots */
+} NmeaNavMotion;
+
+/**
+ * @brief Latest true heading, from HDT sentences.
+ */
+typedef struct NmeaNavHeading
+{
+  float heading; /**< Degrees true */
+} NmeaNavHeading;
+
+/**
+ * @brief Latest navigation state shared between one writer and any number of
+ * readers.
+ *
+ * Each record is protected by its own sequence lock: the writer makes the
+ * sequence odd, updates the record in place and makes it even again, so it
+ * never waits for a reader. A reader copies the record and retries if the
+ * sequence was odd or changed meanwhile, so every copy it returns was written
+ * by a single update. Sequence values are internal and only ever increase, even
+ * across nmeaNavStateRestore(); the read functions return the number of
+ * updates, which is counted separately.
+ *
+ * Readers spin while an update is in progress, so a reader must not preempt
+ * the writer on the same core (e.g. read from an interrupt handler while the
+ * main loop writes); the opposite arrangement is fine.
+ */
+typedef struct NmeaNavState
+{
+  uint32_t positionSequence; /**< Sequence lock of position, internal */
+  uint32_t positionUpdates;  /**< Updates of position, written under its lock, internal */
+  NmeaNavPosition position;  /**< Position record, internal */
+  uint32_t motionSequence;   /**< Sequence lock of motion, internal */
+  uint32_t motionUpdates;    /**< Updates of motion, written under its lock, internal */
+  NmeaNavMotion motion;      /**< Motion record, internal */
+  uint32_t headingSequence;  /**< Sequence lock of heading, internal */
+  uint32_t headingUpdates;   /**< Updates of heading, written under its lock, internal */
+  NmeaNavHeading heading;    /**< Heading record, internal */
+} NmeaNavState;
+
+/**
+ * @brief Every record of the navigation state, each one consistent.
+ *
+ * An update count of 0 means the record has never been written.
+ */
+typedef struct NmeaNavSnapshot
+{
+  NmeaNavPosition position; /**< Latest position */
+  NmeaNavMotion motion;     /**< Latest course and speed */
+  NmeaNavHeading heading;   /**< Latest heading */
+  uint32_t positionUpdates; /**< Updates of position so far */
+  uint32_t motionUpdates;   /**< Updates of motion so far */
+  uint32_t headingUpdates;  /**< Updates of heading so far */
+} NmeaNavSnapshot;
+
+/**
+ * @brief Converts a latitude (ddmm.mm) or longitude (dddmm.mm) field and its
+ * polarity to signed degrees, north and east positive.
+ */
+double nmeaDegrees(float value, Polarity polarity);
+
+/**
+ * @brief Initialises an empty navigation state.
+ */
+void nmeaNavStateInit(NmeaNavState *state);
+
+/**
+ * @brief Merges a decoded sentence into the navigation state.
+ *
+ * Only one thread (or interrupt) may update a given state.
+ *
+ * @return false if the sentence carries no navigation state (GGA, RMC, VTG
+ *         and HDT do).
+ */
+bool nmeaNavStateUpdate(NmeaNavState *state, const NmeaSentence *sentence);
+
+/**
+ * @brief NmeaSentenceCallback adapter: pass the state as the parser context
+ * to keep it updated straight from nmeaFeed().
+ */
+void nmeaNavStateCallback(const NmeaSentence *sentence, void *context);
+
+/**
+ * @brief Copies the latest position. Never blocks the writer.
+ * @return The number of position updates so far, 0 if there is none yet.
+ */
+uint32_t nmeaNavStateReadPosition(const NmeaNavState *state, NmeaNavPosition *position);
+
+/**
+ * @brief Copies the latest course and speed. Never blocks the writer.
+ * @return The number of motion updates so far, 0 if there is none yet.
+ */
+uint32_t nmeaNavStateReadMotion(const NmeaNavState *state, NmeaNavMotion *motion);
+
+/**
+ * @brief Copies the latest heading. Never blocks the writer.
+ * @return The number of heading updates so far, 0 if there is none yet.
+ */
+uint32_t nmeaNavStateReadHeading(const NmeaNavState *state, NmeaNavHeading *heading);
+
+/**
+ * @brief Copies every record of the navigation state.
+ */
+void nmeaNavStateSnapshot(const NmeaNavState *state, NmeaNavSnapshot *snapshot);
+
+/**
+ * @brief Writes every record of a snapshot back, including the update
+ * counts, e.g. to warm start from a saved state.
+ *
+ * Counts as an update by the writer: it must not run concurrently with
+ * nmeaNavStateUpdate().
+ */
+void nmeaNavStateRestore(NmeaNavState *state, const NmeaNavSnapshot *snapshot);
+
+#endif
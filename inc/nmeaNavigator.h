@@ -0,0 +1,117 @@
+#ifndef INC_NMEA_NAVIGATOR_H_
+#define INC_NMEA_NAVIGATOR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+#include "nmeaFields.h"
+#include "nmeaGeodesy.h"
+#include "nmeaPositionHistory.h"
+#include "nmeaSentences.h"
+
+/**
+ * @brief A named route point.
+ */
+typedef struct NmeaWaypoint
+{
+  char id[NMEA_WAYPOINT_ID_SIZE]; /**< NUL terminated waypoint ID */
+  double latitude;                /**< Degrees, north positive */
+  double longitude;               /**< Degrees, east positive */
+} NmeaWaypoint;
+
+/**
+ * @brief Track followed between the origin and destination of a leg.
+ */
+typedef enum NmeaLegType
+{
+  NMEA_LEG_GREAT_CIRCLE, /**< Shortest path */
+  NMEA_LEG_RHUMB_LINE    /**< Constant bearing */
+} NmeaLegType;
+
+/**
+ * @brief Steering data of the active leg at the last update.
+ */
+typedef struct NmeaLegStatus
+{
+  double crossTrackError;       /**< Nautical miles from the track, positive right of it */
+  double bearingToDestination;  /**< Degrees true, along the leg type */
+  double distanceToDestination; /**< Nautical miles, along the leg type */
+  double greatCircleBearing;    /**< Degrees true, great circle (BWC) */
+  double greatCircleDistance;   /**< Nautical miles, great circle (BWC) */
+  double closingVelocity;       /**< Knots towards the destination, 0 for a fix without motion */
+  bool arrivalCircleEntered;    /**< Within the arrival radius of the destination */
+  bool perpendicularPassed;     /**< Past the line through the destination normal to the leg */
+} NmeaLegStatus;
+
+/**
+ * @brief Produces APB, XTE, BWC, RMB and BOD sentences for the active leg.
+ *
+ * Everything that only depends on the leg (waypoint vectors, track normal,
+ * origin to destination bearing) is computed once by nmeaNavigatorSetLeg();
+ * each nmeaNavigatorUpdate() only does the work that depends on the position.
+ */
+typedef struct NmeaNavigator
+{
+  TalkerID talkerId;        /**< Talker of the generated sentences */
+  char modeIndicator;       /**< Mode indicator of the generated sentences, 'A' by default */
+  NmeaLegType legType;      /**< Track followed on the active leg */
+  NmeaWaypoint origin;      /**< Origin of the active leg */
+  NmeaWaypoint destination; /**< Destination of the active leg */
+  double arrivalRadius;     /**< Arrival circle radius, nautical miles */
+  double magneticVariation; /**< Degrees, east positive, valid if hasVariation */
+  bool hasVariation;        /**< Magnetic bearings are generated */
+  bool hasLeg;              /**< A leg has been set */
+  bool hasStatus;           /**< status holds the result of an update */
+  NmeaVector originVector;      /**< Origin unit vector, internal */
+  NmeaVector destinationVector; /**< Destination unit vector, internal */
+  NmeaVector legNormal;         /**< Unit normal of the leg great circle, pointing left, internal */
+  NmeaVector legForward;        /**< Direction of travel at the destination, internal */
+  double legBearing;            /**< Origin to destination bearing, internal */
+  double legLength;             /**< Origin to destination distance, internal */
+  float utcTime;                /**< UTC of the last update, hhmmss.ss */
+  NmeaLegStatus status;         /**< Result of the last update */
+  NmeaSentence sentence;        /**< Encoding scratch, internal */
+} NmeaNavigator;
+
+/**
+ * @brief Initialises a navigator without an active leg.
+ */
+void nmeaNavigatorInit(NmeaNavigator *navigator, TalkerID talkerId);
+
+/**
+ * @brief Activates a leg and precomputes everything that only depends on it.
+ *
+ * @param arrivalRadius Arrival circle radius in nautical miles.
+ */
+void nmeaNavigatorSetLeg(NmeaNavigator *navigator, const NmeaWaypoint *origin, const NmeaWaypoint *destination,
+                         NmeaLegType legType, double arrivalRadius);
+
+/**
+ * @brief Sets the magnetic variation used for magnetic bearings.
+ *
+ * @param variation Degrees, east positive.
+ */
+void nmeaNavigatorSetVariation(NmeaNavigator *navigator, double variation);
+
+/**
+ * @brief Computes the steering data for a new position.
+ *
+ * @param fix     Position, course and speed over ground.
+ * @param utcTime UTC of the fix (hhmmss.ss), reported in BWC.
+ * @return false if no leg is active.
+ */
+bool nmeaNavigatorUpdate(NmeaNavigator *navigator, const NmeaFix *fix, float utcTime);
+
+/**
+ * @brief Encodes one sentence from the last update, including checksum and
+ * CR/LF, without NUL terminator.
+ *
+ * @param sentenceId APB, XTE, BWC, RMB or BOD.
+ * @return NMEA_OK, NMEA_ERROR_UNSUPPORTED for another or disabled sentence or
+ *         before the first update, or NMEA_ERROR_BUFFER_SIZE.
+ */
+NmeaStatus nmeaNavigatorEncode(NmeaNavigator *navigator, SentenceID sentenceId, char *buffer, size_t size,
+                               size_t *length);
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef INC_NMEA_POSITION_HISTORY_H_
+#define INC_NMEA_POSITION_HISTORY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmeaConfig.h"
+#include "nmeaSentences.h"
+
+/**
+ * @brief A position fix with its course and speed at a point in time.
+ */
+typedef struct NmeaFix
+{
+  int64_t timeMs;         /**< Caller defined, monotonic time in milliseconds */
+  double latitude;        /**< Degrees, north positive */
+  double longitude;       /**< Degrees, east positive, -180 to 180 */
+  float courseOverGround; /**< Degrees true, 0 without motion */
+  float speedOverGround;  /**< Knots, 0 without motion */
+  bool hasMotion;         /**< Course and speed are known */
+} NmeaFix;
+
+/**
+ * @brief How a position between two fixes is estimated.
+ */
+typedef enum NmeaInterpolation
+{
+  NMEA_INTERPOLATE_LINEAR, /**< Straight line between the fixes */
+  NMEA_INTERPOLATE_HERMITE /**< Cubic curve matching the course and speed at both fixes */
+} NmeaInterpolation;
+
+/**
+ * @brief Where a queried position came from.
+ */
+typedef enum NmeaPositionSource
+{
+  NMEA_POSITION_UNAVAILABLE,  /**< Empty history, or a time before the oldest fix */
+  NMEA_POSITION_INTERPOLATED, /**< Between the oldest and newest fix */
+  NMEA_POSITION_EXTRAPOLATED  /**< Dead reckoned from the newest fix */
+} NmeaPositionSource;
+
+/**
+ * @brief Ring of the last NMEA_POSITION_HISTORY_LENGTH fixes in time order.
+ *
+ * Lets consumers ask for the position at an arbitrary time, e.g. the time of
+ * a radar sweep, instead of keeping their own copies of past fixes.
+ */
+typedef struct NmeaPositionHistory
+{
+  NmeaFix fixes[NMEA_POSITION_HISTORY_LENGTH]; /**< Ring storage, internal */
+  uint16_t newest;                             /**< Index of the newest fix, internal */
+  uint16_t count;                              /**< Number of fixes held */
+} NmeaPositionHistory;
+
+/**
+ * @brief Initialises an empty history.
+ */
+void nmeaHistoryInit(NmeaPositionHistory *history);
+
+/**
+ * @brief Appends a fix, replacing the oldest one when the ring is full.
+ * @return false if the fix is not newer than the newest fix held.
+ */
+bool nmeaHistoryAdd(NmeaPositionHistory *history, const NmeaFix *fix);
+
+/**
+ * @brief Appends the fix carried by a valid RMC sentence, without motion if
+ *        its course or speed is null.
+ *
+ * @param timeMs Time of the fix on the caller's clock, e.g. its reception time.
+ * @return false if the sentence is not a valid RMC with a position, or is not
+ *         newer than the newest fix held.
+ */
+bool nmeaHistoryAddSentence(NmeaPositionHistory *history, const NmeaSentence *sentence, int64_t timeMs);
+
+/**
+ * @brief Estimates the position at @p timeMs.
+ *
+ * The bracketing fixes are found by binary search. Times after the newest fix
+ * are dead reckoned along its course and speed; this is a flat earth estimate
+ * meant for horizons of seconds to minutes. A fix without motion holds its
+ * position when dead reckoned, and Hermite interpolation takes the chord as
+ * its tangent.
+ *
+ * @param position Receives the estimate, including interpolated course and
+ *                 speed, with timeMs set to the requested time.
+ */
+NmeaPositionSource nmeaHistoryPositionAt(const NmeaPositionHistory *history, int64_t timeMs,
+                                         NmeaInterpolation method, NmeaFix *position);
+
+#endif
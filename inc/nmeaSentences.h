@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include "nmeaConfig.h"
+#include "nmeaFields.h"
 
 /**
  * @brief Enumeration of NMEA 0183 Talker IDs.
@@ -428,30 +429,103 @@ typedef enum AlertCategory
   ALERT_CATEGORY_C = 'C' /**< Requires information but cannot be acknowledged on bridge. */
 } AlertCategory;
 
+/**
+ * @brief GPS quality indicator of a GGA fix.
+ */
+typedef enum GPSQualityIndicator
+{
+  GPS_FIX_NOT_AVAILABLE = 0, /**< Fix not available or invalid */
+  GPS_FIX_SPS = 1,           /**< GPS SPS mode, fix valid */
+  GPS_FIX_DIFFERENTIAL = 2,  /**< Differential GPS, SPS mode, fix valid */
+  GPS_FIX_PPS = 3,           /**< GPS PPS mode, fix valid */
+  GPS_FIX_RTK = 4,           /**< Real Time Kinematic, fixed integers */
+  GPS_FIX_FLOAT_RTK = 5,     /**< Float RTK, floating integers */
+  GPS_FIX_ESTIMATED = 6,     /**< Estimated (dead reckoning) mode */
+  GPS_FIX_MANUAL = 7,        /**< Manual input mode */
+  GPS_FIX_SIMULATOR = 8      /**< Simulator mode */
+} GPSQualityIndicator;
+
+/* BEGIN GENERATED: sentence structures */
 /**
  * @brief Alert entry structure.
  *
- * This structure represents an alert entry transported within an ALC (Cyclic Alert List) sentence.
- * Each alert entry consists of identifying data for a certain alert, including manufacturer identifier,
- * alert identifier, alert instance, and revision counter.
+ * This structure represents an alert entry transported within an ALC (Cyclic
+ * Alert List) sentence. Each alert entry consists of identifying data for a
+ * certain alert, including manufacturer mnemonic, alert identifier, alert
+ * instance, and revision counter.
+ *
+ * @var char manufacturerMnemonic[4]
+ * @brief Manufacturer mnemonic code (see ALF Manufacturer Mnemonic Code), null
+ * for standardised alerts.
+ *
+ * @var uint32_t alertIdentifier
+ * @brief Alert identifier (see ALF Alert Identifier).
+ *
+ * @var uint32_t alertInstance
+ * @brief Alert instance (see ALF Alert instance).
+ *
+ * @var uint8_t revisionCounter
+ * @brief Revision counter (see ALF Revision Counter).
  */
 typedef struct AlertEntry
 {
-  uint8_t manufacturerIdentifier; /**< Manufacturer identifier (see ALF Manufacturer Identifier) */
-  uint32_t alertIdentifier;       /**< Alert identifier (see ALF Alert Identifier) */
-  uint32_t alertInstance;         /**< Alert instance (see ALF Alert instance) */
-  uint32_t revisionCounter;       /**< Revision counter (see ALF Revision Counter) */
+  char manufacturerMnemonic[4];
+  uint32_t alertIdentifier;
+  uint32_t alertInstance;
+  uint8_t revisionCounter;
 } AlertEntry;
 
+/**
+ * @brief Satellite in view structure.
+ *
+ * This structure represents one satellite transported within a GSV (GNSS
+ * satellites in view) sentence.
+ *
+ * @var uint8_t satelliteId
+ * @brief Satellite ID number.
+ *
+ * @var uint8_t elevation
+ * @brief Elevation, degrees, 90 maximum.
+ *
+ * @var uint16_t azimuth
+ * @brief Azimuth, degrees true, 000 to 359.
+ *
+ * @var uint8_t snr
+ * @brief SNR (C/No) 00-99 dB-Hz, 0 when not tracking.
+ */
+typedef struct SatelliteInView
+{
+  uint8_t satelliteId;
+  uint8_t elevation;
+  uint16_t azimuth;
+  uint8_t snr;
+} SatelliteInView;
+
 #if CFG_SENTENCE_AAM_ENABLED
+/* SENTENCE_AAM.presentFields bits, also the bits of CFG_SENTENCE_AAM_FIELDS */
+#define AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT (1UL << 0)
+#define AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT (1UL << 1)
+#define AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT (1UL << 2)
+#define AAM_RADIUS_UNITS_PRESENT (1UL << 3)
+#define AAM_WAYPOINT_ID_PRESENT (1UL << 4)
+#define AAM_ALL_PRESENT 0x1FUL
+#if (CFG_SENTENCE_AAM_FIELDS) & ~AAM_ALL_PRESENT
+#error "CFG_SENTENCE_AAM_FIELDS has bits outside AAM_ALL_PRESENT"
+#endif
+
 /**
  * @brief Waypoint arrival alarm (AAM) sentence structure.
  *
  * Status of arrival (entering the arrival circle, or passing the perpendicular
  * of the course line) at waypoint c--c.
- * *
+ *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (AAM).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (AAM).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (AAM_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var StatusField arrivalCircledEntered
  * @brief Single character field indicating if the vessel has entered the
@@ -466,11 +540,11 @@ typedef struct AlertEntry
  * @var float arrivalCircleRadius
  * @brief The radius of the arrival circle.
  *
- * @var uint8_t radiusUnits
- * @brief The units of the radius (e.g., Nautical Miles).
+ * @var char radiusUnits
+ * @brief The units of the radius (N = Nautical Miles).
  *
- * @var uint8_t *waypointID
- * @brief Pointer to the waypoint identifier.
+ * @var char waypointID[AAM_WAYPOINT_MAX_LENGTH]
+ * @brief The waypoint identifier.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -480,19 +554,40 @@ typedef struct AlertEntry
 typedef struct SENTENCE_AAM
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT)
   StatusField arrivalCircledEntered;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AAM_FIELDS & AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
   StatusField perpendicularPassedAtWaypoint;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT)
   float arrivalCircleRadius;
-  uint8_t radiusUnits;
-  uint8_t waypointID[AAM_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AAM_FIELDS & AAM_RADIUS_UNITS_PRESENT)
+  char radiusUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AAM_FIELDS & AAM_WAYPOINT_ID_PRESENT)
+  char waypointID[AAM_WAYPOINT_MAX_LENGTH];
+#endif
   uint8_t checksum;
 } SENTENCE_AAM;
 #endif // CFG_SENTENCE_AAM_ENABLED
 
 #if CFG_SENTENCE_ABK_ENABLED
+/* SENTENCE_ABK.presentFields bits, also the bits of CFG_SENTENCE_ABK_FIELDS */
+#define ABK_MMSI_ADDRESS_PRESENT (1UL << 0)
+#define ABK_MMSI_CHANNEL_PRESENT (1UL << 1)
+#define ABK_M1373_MESSAGE_ID_PRESENT (1UL << 2)
+#define ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT (1UL << 3)
+#define ABK_ACKNOWLEDGEMENT_TYPE_PRESENT (1UL << 4)
+#define ABK_ALL_PRESENT 0x1FUL
+#if (CFG_SENTENCE_ABK_FIELDS) & ~ABK_ALL_PRESENT
+#error "CFG_SENTENCE_ABK_FIELDS has bits outside ABK_ALL_PRESENT"
+#endif
+
 /**
- * @brief AIS addressed and binary broadcast acknowledgement (ABK) sentence
- * structure.
+ * @brief AIS addressed and binary broadcast acknowledgement (ABK) sentence structure.
  *
  * This structure represents information related to the AIS addressed and binary
  * broadcast acknowledgement (ABK) sentence. The ABK sentence is generated upon
@@ -506,19 +601,23 @@ typedef struct SENTENCE_AAM
  * of AIR (ITU-R M.1371 Message 15) and BBM (ITU-R M.1371 Messages 8, 14, 25,
  * 26) sentences to the external application.
  *
- * The external application can initiate an interrogation through the
- * AIR-sentence or a broadcast through the BBM sentence. The AIS unit generates
- * the ABK sentence to report the outcome of the ABM, AIR, or BBM broadcast
- * process.
+ * The external application can initiate an interrogation through the AIR-
+ * sentence or a broadcast through the BBM sentence. The AIS unit generates the
+ * ABK sentence to report the outcome of the ABM, AIR, or BBM broadcast process.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ABK).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ABK).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ABK_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint32_t mmsiAddress
  * @brief The Maritime Mobile Service Identity (MMSI) address.
  *
- * @var uint8_t mmsiChannel
- * @brief The MMSI channel.
+ * @var AISChannel mmsiChannel
+ * @brief The AIS channel of reception (A or B).
  *
  * @var float m1373MessageId
  * @brief The ID of ITU-R M.1373 message.
@@ -526,9 +625,8 @@ typedef struct SENTENCE_AAM
  * @var uint8_t messageSequenceNumber
  * @brief The sequence number of the message.
  *
- * @var StatusField acknowledgement
- * @brief The acknowledgement status (A = Yes, data valid, warning flag clear;
- * V = No, data invalid, warning flag set).
+ * @var uint8_t acknowledgementType
+ * @brief The type of acknowledgement (0 to 4), see IEC 61162-1.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -538,19 +636,43 @@ typedef struct SENTENCE_AAM
 typedef struct SENTENCE_ABK
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_ADDRESS_PRESENT)
   uint32_t mmsiAddress;
-  uint8_t mmsiChannel;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_CHANNEL_PRESENT)
+  AISChannel mmsiChannel;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABK_FIELDS & ABK_M1373_MESSAGE_ID_PRESENT)
   float m1373MessageId;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABK_FIELDS & ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT)
   uint8_t messageSequenceNumber;
-  StatusField acknowledgement;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABK_FIELDS & ABK_ACKNOWLEDGEMENT_TYPE_PRESENT)
+  uint8_t acknowledgementType;
+#endif
   uint8_t checksum;
 } SENTENCE_ABK;
 #endif // CFG_SENTENCE_ABK_ENABLED
 
 #if CFG_SENTENCE_ABM_ENABLED
+/* SENTENCE_ABM.presentFields bits, also the bits of CFG_SENTENCE_ABM_FIELDS */
+#define ABM_TOTAL_SENTENCE_NUMBER_PRESENT (1UL << 0)
+#define ABM_SENTENCE_NUMBER_PRESENT (1UL << 1)
+#define ABM_SEQUENTIAL_MESSAGE_ID_PRESENT (1UL << 2)
+#define ABM_MMSI_ADDRESS_PRESENT (1UL << 3)
+#define ABM_AIS_CHANNEL_PRESENT (1UL << 4)
+#define ABM_M1373_MESSAGE_ID_PRESENT (1UL << 5)
+#define ABM_ENCAPSULATED_DATA_PRESENT (1UL << 6)
+#define ABM_NUMBER_FILL_BITS_PRESENT (1UL << 7)
+#define ABM_ALL_PRESENT 0xFFUL
+#if (CFG_SENTENCE_ABM_FIELDS) & ~ABM_ALL_PRESENT
+#error "CFG_SENTENCE_ABM_FIELDS has bits outside ABM_ALL_PRESENT"
+#endif
+
 /**
- * @brief AIS addressed binary and safety related message (ABM) sentence
- * structure.
+ * @brief AIS addressed binary and safety related message (ABM) sentence structure.
  *
  * This structure represents information related to the AIS addressed binary and
  * safety related message (ABM) sentence. The ABM sentence supports ITU-R M.1371
@@ -576,7 +698,12 @@ typedef struct SENTENCE_ABK
  * transmission of Message 26 over the VHF data link.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ABM).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ABM).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ABM_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint8_t totalSentenceNumber
  * @brief The total number of sentences in the message sequence.
@@ -591,12 +718,12 @@ typedef struct SENTENCE_ABK
  * @brief The Maritime Mobile Service Identity (MMSI) address.
  *
  * @var uint8_t aisChannel
- * @brief The AIS channel.
+ * @brief The AIS channel for broadcast of the radio message (0 to 3).
  *
  * @var uint8_t m1373MessageId
  * @brief The ID of ITU-R M.1373 message.
  *
- * @var uint8_t encapsulatedData[ABM_DATA_MAX_LENGTH]
+ * @var char encapsulatedData[ABM_DATA_MAX_LENGTH]
  * @brief The encapsulated data in the ABM sentence.
  *
  * @var uint8_t numberFillBits
@@ -610,19 +737,61 @@ typedef struct SENTENCE_ABK
 typedef struct SENTENCE_ABM
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_TOTAL_SENTENCE_NUMBER_PRESENT)
   uint8_t totalSentenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_SENTENCE_NUMBER_PRESENT)
   uint8_t sentenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_SEQUENTIAL_MESSAGE_ID_PRESENT)
   uint8_t sequentialMessageId;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_MMSI_ADDRESS_PRESENT)
   uint32_t mmsiAddress;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_AIS_CHANNEL_PRESENT)
   uint8_t aisChannel;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_M1373_MESSAGE_ID_PRESENT)
   uint8_t m1373MessageId;
-  uint8_t encapsulatedData[ABM_DATA_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_ENCAPSULATED_DATA_PRESENT)
+  char encapsulatedData[ABM_DATA_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ABM_FIELDS & ABM_NUMBER_FILL_BITS_PRESENT)
   uint8_t numberFillBits;
+#endif
   uint8_t checksum;
 } SENTENCE_ABM;
 #endif // CFG_SENTENCE_ABM_ENABLED
 
 #if CFG_SENTENCE_ACA_ENABLED
+/* SENTENCE_ACA.presentFields bits, also the bits of CFG_SENTENCE_ACA_FIELDS */
+#define ACA_SEQUENCE_NUMBER_PRESENT (1UL << 0)
+#define ACA_NE_LATITUDE_PRESENT (1UL << 1)
+#define ACA_NE_LATITUDE_POLARITY_PRESENT (1UL << 2)
+#define ACA_NE_LONGITUDE_PRESENT (1UL << 3)
+#define ACA_NE_LONGITUDE_POLARITY_PRESENT (1UL << 4)
+#define ACA_SW_LATITUDE_PRESENT (1UL << 5)
+#define ACA_SW_LATITUDE_POLARITY_PRESENT (1UL << 6)
+#define ACA_SW_LONGITUDE_PRESENT (1UL << 7)
+#define ACA_SW_LONGITUDE_POLARITY_PRESENT (1UL << 8)
+#define ACA_TRANSITION_ZONE_SIZE_PRESENT (1UL << 9)
+#define ACA_CHANNEL_A_PRESENT (1UL << 10)
+#define ACA_CHANNEL_ABANDWIDTH_PRESENT (1UL << 11)
+#define ACA_CHANNEL_B_PRESENT (1UL << 12)
+#define ACA_CHANNEL_BBANDWIDTH_PRESENT (1UL << 13)
+#define ACA_TX_RX_MODE_PRESENT (1UL << 14)
+#define ACA_POWER_LEVEL_PRESENT (1UL << 15)
+#define ACA_INFO_SOURCE_PRESENT (1UL << 16)
+#define ACA_IN_USE_FLAG_PRESENT (1UL << 17)
+#define ACA_IN_USE_CHANGE_TIME_PRESENT (1UL << 18)
+#define ACA_ALL_PRESENT 0x7FFFFUL
+#if (CFG_SENTENCE_ACA_FIELDS) & ~ACA_ALL_PRESENT
+#error "CFG_SENTENCE_ACA_FIELDS has bits outside ACA_ALL_PRESENT"
+#endif
+
 /**
  * @brief AIS channel assignment message (ACA) sentence structure.
  *
@@ -647,7 +816,12 @@ typedef struct SENTENCE_ABM
  * functions of the AIS unit as described in ITU-R M.1371.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ACA).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ACA).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ACA_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint8_t sequenceNumber
  * @brief The sequence number of the ACA sentence.
@@ -683,13 +857,13 @@ typedef struct SENTENCE_ABM
  * @var uint8_t transitionZoneSize
  * @brief The size of the transition zone.
  *
- * @var uin16_t channelA
+ * @var uint16_t channelA
  * @brief The VHF channel number of channel A (see ITU-R M.1084, Annex 4).
  *
  * @var ChannelBandwidth channelABandwidth
  * @brief The bandwidth of channel A. See ITU-R M.1084, Annex 4 for details.
  *
- * @var uint32_t channelB
+ * @var uint16_t channelB
  * @brief The VHF channel number of channel B (see ITU-R M.1084, Annex 4).
  *
  * @var ChannelBandwidth channelBBandwidth
@@ -708,10 +882,8 @@ typedef struct SENTENCE_ABM
  * @brief The flag indicating if the channel management information is in use.
  *
  * @var float inUseChangeTime
- * @brief The time when the channel management information became in use.
- * @note This is the UTC time that the “In-use flag” field changed to the
- * indicated state. This field should be null when the sentence is sent to an
- * AIS unit.
+ * @brief The UTC time that the “In-use flag” field changed to the indicated
+ * state. This field should be null when the sentence is sent to an AIS unit.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -721,30 +893,76 @@ typedef struct SENTENCE_ABM
 typedef struct SENTENCE_ACA
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_SEQUENCE_NUMBER_PRESENT)
   uint8_t sequenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_PRESENT)
   float neLatitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_POLARITY_PRESENT)
   Polarity neLatitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_PRESENT)
   float neLongitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_POLARITY_PRESENT)
   Polarity neLongitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_PRESENT)
   float swLatitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_POLARITY_PRESENT)
   Polarity swLatitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_PRESENT)
   float swLongitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_POLARITY_PRESENT)
   Polarity swLongitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_TRANSITION_ZONE_SIZE_PRESENT)
   uint8_t transitionZoneSize;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_A_PRESENT)
   uint16_t channelA;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_ABANDWIDTH_PRESENT)
   ChannelBandwidth channelABandwidth;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_B_PRESENT)
   uint16_t channelB;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_BBANDWIDTH_PRESENT)
   ChannelBandwidth channelBBandwidth;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_TX_RX_MODE_PRESENT)
   TxRxModeControl txRxMode;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_POWER_LEVEL_PRESENT)
   TxPowerLevel powerLevel;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_INFO_SOURCE_PRESENT)
   ACAInfoSource infoSource;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_FLAG_PRESENT)
   uint8_t inUseFlag;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_CHANGE_TIME_PRESENT)
   float inUseChangeTime;
+#endif
   uint8_t checksum;
 } SENTENCE_ACA;
 #endif // CFG_SENTENCE_ACA_ENABLED
 
 #if CFG_SENTENCE_ACK_ENABLED
+/* SENTENCE_ACK.presentFields bits, also the bits of CFG_SENTENCE_ACK_FIELDS */
+#define ACK_ALARM_ID_PRESENT (1UL << 0)
+#define ACK_ALL_PRESENT 0x1UL
+#if (CFG_SENTENCE_ACK_FIELDS) & ~ACK_ALL_PRESENT
+#error "CFG_SENTENCE_ACK_FIELDS has bits outside ACK_ALL_PRESENT"
+#endif
+
 /**
  * @brief Acknowledge alarm (ACK) sentence structure.
  *
@@ -753,9 +971,14 @@ typedef struct SENTENCE_ACA
  * by a device.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ACK).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ACK).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ACK_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
- * @var uint16_t alarmId
+ * @var uint32_t alarmId
  * @brief The unique identifier (alarm number) of the alarm being acknowledged.
  *
  * @var uint8_t checksum
@@ -766,12 +989,27 @@ typedef struct SENTENCE_ACA
 typedef struct SENTENCE_ACK
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACK_FIELDS & ACK_ALARM_ID_PRESENT)
   uint32_t alarmId;
+#endif
   uint8_t checksum;
 } SENTENCE_ACK;
 #endif // CFG_SENTENCE_ACK_ENABLED
 
 #if CFG_SENTENCE_ACN_ENABLED
+/* SENTENCE_ACN.presentFields bits, also the bits of CFG_SENTENCE_ACN_FIELDS */
+#define ACN_TIME_PRESENT (1UL << 0)
+#define ACN_MANUFACTURER_MNEMONIC_PRESENT (1UL << 1)
+#define ACN_ALERT_ID_PRESENT (1UL << 2)
+#define ACN_ALERT_INSTANCE_PRESENT (1UL << 3)
+#define ACN_ALERT_COMMAND_PRESENT (1UL << 4)
+#define ACN_STATUS_FLAG_PRESENT (1UL << 5)
+#define ACN_ALL_PRESENT 0x3FUL
+#if (CFG_SENTENCE_ACN_FIELDS) & ~ACN_ALL_PRESENT
+#error "CFG_SENTENCE_ACN_FIELDS has bits outside ACN_ALL_PRESENT"
+#endif
+
 /**
  * @brief Alert command (ACN) sentence structure.
  *
@@ -779,20 +1017,22 @@ typedef struct SENTENCE_ACK
  * sentence. ACN sentences, along with other related sentences like ALC, ALF,
  * and ARC, are used for alert handling as described in IEC 61924-2.
  *
- * @var TalkerID talkerId
- * @brief The talker ID associated with the sentence.
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ACN).
  *
- * @var SentenceID sentenceId
- * @brief The unique identifier for the sentence (ACN).
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ACN_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var float time
  * @brief The release time of the alert command. Optional field, can be null.
  *
- * @var uint8_t[3] manufacturerCode
+ * @var char manufacturerMnemonic[4]
  * @brief The manufacturer mnemonic code for proprietary alerts. Should be null
  * for standardised alerts.
  *
- * @var uint32_t alertIdentifier
+ * @var uint32_t alertId
  * @brief The unique identifier of the alert. Range: 10000-9999999. 0 reserved
  * for command request to all alerts.
  *
@@ -801,17 +1041,12 @@ typedef struct SENTENCE_ACK
  * 1 to 999999. 0 for all instances.
  *
  * @var AlertAcknowledgedState alertCommand
- * @brief The alert command:
- * - 'A': Acknowledge
- * - 'Q': Request/Repeat information
- * - 'O': Responsibility transfer
- * - 'S': Silence
- *
- * @var uint8_t sentenceStatusFlag
- * @brief The sentence status flag:
- * - 'C': Command
- * Should not be null, indicates a command.
- * A sentence without 'C' is not a command.
+ * @brief The alert command: 'A' Acknowledge, 'Q' Request/Repeat information,
+ * 'O' Responsibility transfer, 'S' Silence.
+ *
+ * @var char statusFlag
+ * @brief The sentence status flag, 'C' for a command. A sentence without 'C' is
+ * not a command.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -820,47 +1055,80 @@ typedef struct SENTENCE_ACK
  */
 typedef struct SENTENCE_ACN
 {
-  TalkerID talkerId;
-  SentenceID sentenceId = ACN;
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_TIME_PRESENT)
   float time;
-  uint8_t manufacturerMnemonic[3];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_MANUFACTURER_MNEMONIC_PRESENT)
+  char manufacturerMnemonic[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_ID_PRESENT)
   uint32_t alertId;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_INSTANCE_PRESENT)
   uint32_t alertInstance;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_COMMAND_PRESENT)
   AlertAcknowledgedState alertCommand;
-  uint8_t statusFlag;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACN_FIELDS & ACN_STATUS_FLAG_PRESENT)
+  char statusFlag;
+#endif
   uint8_t checksum;
 } SENTENCE_ACN;
 #endif // CFG_SENTENCE_ACN_ENABLED
 
 #if CFG_SENTENCE_ACS_ENABLED
+/* SENTENCE_ACS.presentFields bits, also the bits of CFG_SENTENCE_ACS_FIELDS */
+#define ACS_SEQUENCE_NUMBER_PRESENT (1UL << 0)
+#define ACS_MMSI_PRESENT (1UL << 1)
+#define ACS_TIME_PRESENT (1UL << 2)
+#define ACS_DAY_PRESENT (1UL << 3)
+#define ACS_MONTH_PRESENT (1UL << 4)
+#define ACS_YEAR_PRESENT (1UL << 5)
+#define ACS_ALL_PRESENT 0x3FUL
+#if (CFG_SENTENCE_ACS_FIELDS) & ~ACS_ALL_PRESENT
+#error "CFG_SENTENCE_ACS_FIELDS has bits outside ACS_ALL_PRESENT"
+#endif
+
 /**
  * @brief AIS Channel Management Information Source (ACS) sentence structure.
  *
  * This structure represents information related to the AIS Channel Management
- * Information Source (ACS) sentence. ACS sentences are used in conjunction
- * with ACA sentences to identify the originator of the information and the
- * date and time the AIS unit received that information.
+ * Information Source (ACS) sentence. ACS sentences are used in conjunction with
+ * ACA sentences to identify the originator of the information and the date and
+ * time the AIS unit received that information.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ACS).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ACS_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
- * @var uint32_t sequenceNumber
+ * @var uint8_t sequenceNumber
  * @brief Sequence number of the ACS sentence, ranging from 0 to 9.
  *
  * @var uint32_t mmsi
  * @brief Maritime Mobile Service Identity (MMSI) of the originator.
  *
  * @var float time
- * @brief Time of the UTC receipt of channel management information. Format: hhmmss.ss.
+ * @brief Time of the UTC receipt of channel management information. Format:
+ * hhmmss.ss.
  *
  * @var uint8_t day
- * @brief Day of the UTC date of receipt of channel management information. Range: 01 to 31.
+ * @brief Day of the UTC date of receipt of channel management information.
+ * Range: 01 to 31.
  *
  * @var uint8_t month
- * @brief Month of the UTC date of receipt of channel management information. Range: 01 to 12.
+ * @brief Month of the UTC date of receipt of channel management information.
+ * Range: 01 to 12.
  *
  * @var uint16_t year
- * @brief Year of the UTC date of receipt of channel management information. E.g., 2024.
- *
- * @var uint8_t sourceType
- * @brief Type of the source of information. 'x' denotes any character.
+ * @brief Year of the UTC date of receipt of channel management information.
+ * E.g., 2024.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -869,27 +1137,64 @@ typedef struct SENTENCE_ACN
  */
 typedef struct SENTENCE_ACS
 {
-  uint32_t sequenceNumber;
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_SEQUENCE_NUMBER_PRESENT)
+  uint8_t sequenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_MMSI_PRESENT)
   uint32_t mmsi;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_TIME_PRESENT)
   float time;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_DAY_PRESENT)
   uint8_t day;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_MONTH_PRESENT)
   uint8_t month;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ACS_FIELDS & ACS_YEAR_PRESENT)
   uint16_t year;
+#endif
   uint8_t checksum;
 } SENTENCE_ACS;
 #endif // CFG_SENTENCE_ACS_ENABLED
 
 #if CFG_SENTENCE_AIR_ENABLED
+/* SENTENCE_AIR.presentFields bits, also the bits of CFG_SENTENCE_AIR_FIELDS */
+#define AIR_MMSI_INTERROGATED_STATION1_PRESENT (1UL << 0)
+#define AIR_MESSAGE_NUMBER1_PRESENT (1UL << 1)
+#define AIR_MESSAGE_SUBSECTION1_PRESENT (1UL << 2)
+#define AIR_MESSAGE_NUMBER2_PRESENT (1UL << 3)
+#define AIR_MESSAGE_SUBSECTION2_PRESENT (1UL << 4)
+#define AIR_MMSI_INTERROGATED_STATION2_PRESENT (1UL << 5)
+#define AIR_MESSAGE_NUMBER3_PRESENT (1UL << 6)
+#define AIR_MESSAGE_SUBSECTION3_PRESENT (1UL << 7)
+#define AIR_INTERROGATION_CHANNEL_PRESENT (1UL << 8)
+#define AIR_MESSAGE_ID1_1_PRESENT (1UL << 9)
+#define AIR_MESSAGE_ID1_2_PRESENT (1UL << 10)
+#define AIR_MESSAGE_ID2_1_PRESENT (1UL << 11)
+#define AIR_ALL_PRESENT 0xFFFUL
+#if (CFG_SENTENCE_AIR_FIELDS) & ~AIR_ALL_PRESENT
+#error "CFG_SENTENCE_AIR_FIELDS has bits outside AIR_ALL_PRESENT"
+#endif
+
 /**
  * @brief AIS Interrogation Request (AIR) sentence structure.
  *
- * This structure represents information related to the AIS Interrogation Request (AIR)
- * sentence. AIR sentences support ITU-R M.1371 Message 10 and 15, providing an external
- * application with the means to initiate requests for specific ITU-R M.1371 messages from
- * distant mobile or base station AIS units.
+ * This structure represents information related to the AIS Interrogation
+ * Request (AIR) sentence. AIR sentences support ITU-R M.1371 Message 10 and 15,
+ * providing an external application with the means to initiate requests for
+ * specific ITU-R M.1371 messages from distant mobile or base station AIS units.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (AIR).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (AIR).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (AIR_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint32_t mmsiInterrogatedStation1
  * @brief MMSI of the interrogated station-1.
@@ -935,58 +1240,102 @@ typedef struct SENTENCE_ACS
 typedef struct SENTENCE_AIR
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION1_PRESENT)
   uint32_t mmsiInterrogatedStation1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER1_PRESENT)
   uint8_t messageNumber1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION1_PRESENT)
   uint8_t messageSubsection1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER2_PRESENT)
   uint8_t messageNumber2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION2_PRESENT)
   uint8_t messageSubsection2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION2_PRESENT)
   uint32_t mmsiInterrogatedStation2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER3_PRESENT)
   uint8_t messageNumber3;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION3_PRESENT)
   uint8_t messageSubsection3;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_INTERROGATION_CHANNEL_PRESENT)
   AISChannel interrogationChannel;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_1_PRESENT)
   uint16_t messageID1_1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_2_PRESENT)
   uint16_t messageID1_2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID2_1_PRESENT)
   uint16_t messageID2_1;
+#endif
   uint8_t checksum;
 } SENTENCE_AIR;
 #endif // CFG_SENTENCE_AIR_ENABLED
 
 #if CFG_SENTENCE_AKD_ENABLED
+/* SENTENCE_AKD.presentFields bits, also the bits of CFG_SENTENCE_AKD_FIELDS */
+#define AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT (1UL << 0)
+#define AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT (1UL << 1)
+#define AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT (1UL << 2)
+#define AKD_INSTANCE_NUMBER_PRESENT (1UL << 3)
+#define AKD_ALARM_TYPE_PRESENT (1UL << 4)
+#define AKD_ACK_SYSTEM_INDICATOR_PRESENT (1UL << 5)
+#define AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT (1UL << 6)
+#define AKD_ACK_INSTANCE_NUMBER_PRESENT (1UL << 7)
+#define AKD_ALL_PRESENT 0xFFUL
+#if (CFG_SENTENCE_AKD_FIELDS) & ~AKD_ALL_PRESENT
+#error "CFG_SENTENCE_AKD_FIELDS has bits outside AKD_ALL_PRESENT"
+#endif
+
 /**
  * @brief Acknowledge Detail Alarm Condition (AKD) sentence structure.
  *
- * This structure represents information related to the AKD (Acknowledge Detail Alarm Condition)
- * sentence. AKD sentences provide acknowledgment of a detailed alarm condition reported through
- * ALA sentences.
+ * This structure represents information related to the AKD (Acknowledge Detail
+ * Alarm Condition) sentence. AKD sentences provide acknowledgment of a detailed
+ * alarm condition reported through ALA sentences.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (AKD).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (AKD).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (AKD_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var float timeOfAcknowledgement
  * @brief Time of acknowledgement in hhmmss.ss format.
  *
- * @var uint8_t originalSystemIndicator
+ * @var char originalSystemIndicator[4]
  * @brief System indicator of the original alarm source.
  *
- * @var uint8_t originalSubsystemIndicator
+ * @var char originalSubsystemIndicator[4]
  * @brief Subsystem equipment indicator of the original alarm source.
  *
  * @var uint16_t instanceNumber
  * @brief Instance number of equipment/unit/item.
  *
- * @var uint8_t alarmType
+ * @var uint16_t alarmType
  * @brief Type of alarm: corresponds to the ALA sentence being acknowledged.
  *
- * @var uint8_t ackSystemIndicator
+ * @var char ackSystemIndicator[4]
  * @brief System indicator of the system sending the acknowledgment.
  *
- * @var uint8_t ackSubsystemIndicator
+ * @var char ackSubsystemIndicator[4]
  * @brief Subsystem indicator of the system sending the acknowledgment.
  *
  * @var uint16_t ackInstanceNumber
  * @brief Instance of equipment/unit/item sending the acknowledgment.
  *
- * @var uint16_t checksum
+ * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
  * bits of each character in the sentence, excluding "$" and "*", without
  * including start or stop bits.
@@ -994,43 +1343,83 @@ typedef struct SENTENCE_AIR
 typedef struct SENTENCE_AKD
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT)
   float timeOfAcknowledgement;
-  uint8_t originalSystemIndicator;
-  uint8_t originalSubsystemIndicator;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT)
+  char originalSystemIndicator[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT)
+  char originalSubsystemIndicator[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_INSTANCE_NUMBER_PRESENT)
   uint16_t instanceNumber;
-  uint8_t alarmType;
-  uint8_t ackSystemIndicator;
-  uint8_t ackSubsystemIndicator;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ALARM_TYPE_PRESENT)
+  uint16_t alarmType;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SYSTEM_INDICATOR_PRESENT)
+  char ackSystemIndicator[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT)
+  char ackSubsystemIndicator[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_AKD_FIELDS & AKD_ACK_INSTANCE_NUMBER_PRESENT)
   uint16_t ackInstanceNumber;
-  uint16_t checksum;
+#endif
+  uint8_t checksum;
 } SENTENCE_AKD;
 #endif // CFG_SENTENCE_AKD_ENABLED
 
 #if CFG_SENTENCE_ALA_ENABLED
+/* SENTENCE_ALA.presentFields bits, also the bits of CFG_SENTENCE_ALA_FIELDS */
+#define ALA_EVENT_TIME_PRESENT (1UL << 0)
+#define ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT (1UL << 1)
+#define ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT (1UL << 2)
+#define ALA_INSTANCE_NUMBER_PRESENT (1UL << 3)
+#define ALA_ALARM_TYPE_PRESENT (1UL << 4)
+#define ALA_ALARM_CONDITION_PRESENT (1UL << 5)
+#define ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT (1UL << 6)
+#define ALA_ALARM_DESCRIPTION_TEXT_PRESENT (1UL << 7)
+#define ALA_ALL_PRESENT 0xFFUL
+#if (CFG_SENTENCE_ALA_FIELDS) & ~ALA_ALL_PRESENT
+#error "CFG_SENTENCE_ALA_FIELDS has bits outside ALA_ALL_PRESENT"
+#endif
+
 /**
  * @brief Report Detailed Alarm Condition (ALA) sentence structure.
  *
- * This structure represents information related to the ALA (Report Detailed Alarm Condition)
- * sentence. ALA sentences permit the alarm and alarm acknowledge condition of systems to be reported.
- * Unlike ALR, this sentence supports reporting multiple system and sub-system alarm conditions.
+ * This structure represents information related to the ALA (Report Detailed
+ * Alarm Condition) sentence. ALA sentences permit the alarm and alarm
+ * acknowledge condition of systems to be reported. Unlike ALR, this sentence
+ * supports reporting multiple system and sub-system alarm conditions.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ALA).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ALA).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ALA_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var float eventTime
- * @brief Event time of alarm condition change including acknowledgement state change in hhmmss.ss format.
+ * @brief Event time of alarm condition change including acknowledgement state
+ * change in hhmmss.ss format.
  *
- * @var uint8_t originalSystemIndicator
+ * @var char originalSystemIndicator[3]
  * @brief System indicator of original alarm source.
  *
- * @var uint8_t originalSubsystemIndicator
- * @brief Subsystem equipment indicator of original alarm source. Null if no subsystem.
+ * @var char originalSubsystemIndicator[3]
+ * @brief Subsystem equipment indicator of original alarm source. Null if no
+ * subsystem.
  *
  * @var uint16_t instanceNumber
  * @brief Instance number of equipment/unit/item.
  *
  * @var uint16_t alarmType
- * @brief Type of alarm (as defined in 61162-1 Annex D, Table D.1... codes 900 to 999 are user definable).
+ * @brief Type of alarm (as defined in 61162-1 Annex D, Table D.1... codes 900
+ * to 999 are user definable).
  *
  * @var AlarmCondition alarmCondition
  * @brief Alarm condition.
@@ -1038,8 +1427,8 @@ typedef struct SENTENCE_AKD
  * @var AlarmAcknowledgedState alarmAcknowledgedState
  * @brief Alarm's acknowledged state.
  *
- * @var char alarmDescriptionText[4]
- * @brief Additional and optional descriptive text/alarm detail condition tag. Maximum length is 4 characters.
+ * @var char alarmDescriptionText[ALA_DETAIL_MAX_LENGTH]
+ * @brief Additional and optional descriptive text/alarm detail condition tag.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
@@ -1049,28 +1438,61 @@ typedef struct SENTENCE_AKD
 typedef struct SENTENCE_ALA
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_EVENT_TIME_PRESENT)
   float eventTime;
-  uint8_t originalSystemIndicator;
-  uint8_t originalSubsystemIndicator;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT)
+  char originalSystemIndicator[3];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT)
+  char originalSubsystemIndicator[3];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_INSTANCE_NUMBER_PRESENT)
   uint16_t instanceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_TYPE_PRESENT)
   uint16_t alarmType;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_CONDITION_PRESENT)
   AlarmCondition alarmCondition;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT)
   AlarmAcknowledgedState alarmAcknowledgedState;
-  char alarmDescriptionText[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_DESCRIPTION_TEXT_PRESENT)
+  char alarmDescriptionText[ALA_DETAIL_MAX_LENGTH];
+#endif
   uint8_t checksum;
 } SENTENCE_ALA;
 #endif // CFG_SENTENCE_ALA_ENABLED
 
 #if CFG_SENTENCE_ALC_ENABLED
+/* SENTENCE_ALC.presentFields bits, also the bits of CFG_SENTENCE_ALC_FIELDS */
+#define ALC_TOTAL_SENTENCES_PRESENT (1UL << 0)
+#define ALC_SENTENCE_NUMBER_PRESENT (1UL << 1)
+#define ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT (1UL << 2)
+#define ALC_NUMBER_OF_ALERT_ENTRIES_PRESENT (1UL << 3)
+#define ALC_ALL_PRESENT 0xFUL
+#if (CFG_SENTENCE_ALC_FIELDS) & ~ALC_ALL_PRESENT
+#error "CFG_SENTENCE_ALC_FIELDS has bits outside ALC_ALL_PRESENT"
+#endif
+
 /**
  * @brief Cyclic Alert List (ALC) sentence structure.
  *
  * This structure represents information related to the ALC (Cyclic Alert List)
- * sentence. ALC sentences provide condensed ALF sentence information, containing
- * identifying data for each present alert of one certain source/device.
- * 
+ * sentence. ALC sentences provide condensed ALF sentence information,
+ * containing identifying data for each present alert of one certain
+ * source/device.
+ *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ALC).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ALC).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ALC_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint8_t totalSentences
  * @brief Total number of sentences used for this message.
@@ -1079,23 +1501,33 @@ typedef struct SENTENCE_ALA
  * @brief Order of this sentence in the message.
  *
  * @var uint8_t sequentialMessageIdentifier
- * @brief Sequential message identifier relating all sentences belonging to a group of multiple sentences.
+ * @brief Sequential message identifier relating all sentences belonging to a
+ * group of multiple sentences.
  *
  * @var uint8_t numberOfAlertEntries
  * @brief Number of alert entries transported within this sentence.
  *
- * @var AlertEntry alertEntries[MAX_ALERT_ENTRIES]
+ * @var AlertEntry alertEntries[ALC_MAX_ALERT_ENTRIES]
  * @brief Array containing alert entries.
  *
  * @var uint8_t checksum
- * @brief Checksum for error detection.
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
  */
 typedef struct SENTENCE_ALC
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALC_FIELDS & ALC_TOTAL_SENTENCES_PRESENT)
   uint8_t totalSentences;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALC_FIELDS & ALC_SENTENCE_NUMBER_PRESENT)
   uint8_t sentenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALC_FIELDS & ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT)
   uint8_t sequentialMessageIdentifier;
+#endif
   uint8_t numberOfAlertEntries;
   AlertEntry alertEntries[ALC_MAX_ALERT_ENTRIES];
   uint8_t checksum;
@@ -1103,15 +1535,39 @@ typedef struct SENTENCE_ALC
 #endif // CFG_SENTENCE_ALC_ENABLED
 
 #if CFG_SENTENCE_ALF_ENABLED
+/* SENTENCE_ALF.presentFields bits, also the bits of CFG_SENTENCE_ALF_FIELDS */
+#define ALF_TOTAL_SENTENCES_PRESENT (1UL << 0)
+#define ALF_SENTENCE_NUMBER_PRESENT (1UL << 1)
+#define ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT (1UL << 2)
+#define ALF_TIME_OF_LAST_CHANGE_PRESENT (1UL << 3)
+#define ALF_ALERT_CATEGORY_PRESENT (1UL << 4)
+#define ALF_ALERT_PRIORITY_PRESENT (1UL << 5)
+#define ALF_ALERT_STATE_PRESENT (1UL << 6)
+#define ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT (1UL << 7)
+#define ALF_ALERT_IDENTIFIER_PRESENT (1UL << 8)
+#define ALF_ALERT_INSTANCE_PRESENT (1UL << 9)
+#define ALF_REVISION_COUNTER_PRESENT (1UL << 10)
+#define ALF_ESCALATION_COUNTER_PRESENT (1UL << 11)
+#define ALF_ALERT_TEXT_PRESENT (1UL << 12)
+#define ALF_ALL_PRESENT 0x1FFFUL
+#if (CFG_SENTENCE_ALF_FIELDS) & ~ALF_ALL_PRESENT
+#error "CFG_SENTENCE_ALF_FIELDS has bits outside ALF_ALL_PRESENT"
+#endif
+
 /**
  * @brief Alert sentence structure.
  *
  * This structure represents information related to the ALF (Alert Sentence)
- * sentence. ALF sentences are used to report an alert condition and the
- * alert state of a device.
- * 
+ * sentence. ALF sentences are used to report an alert condition and the alert
+ * state of a device.
+ *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ALF).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ALF).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ALF_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var uint8_t totalSentences
  * @brief Total number of ALF sentences for this message.
@@ -1122,19 +1578,19 @@ typedef struct SENTENCE_ALC
  * @var uint8_t sequentialMessageIdentifier
  * @brief Sequential message identifier for multiple sentences.
  *
- * @var char[9] timeOfLastChange
- * @brief Time of last change in HHMMSS.ss format.
+ * @var float timeOfLastChange
+ * @brief Time of last change in hhmmss.ss format.
  *
- * @var char alertCategory
+ * @var AlertCategory alertCategory
  * @brief Alert category: A, B, or C.
  *
  * @var AlertPriority alertPriority
  * @brief Alert priority: E, A, W, or C.
  *
- * @var char alertState
+ * @var AlertAcknowledgedState alertState
  * @brief Alert state: A, S, N, O, U, or V.
  *
- * @var char[3] manufacturerMnemonicCode
+ * @var char manufacturerMnemonicCode[4]
  * @brief Manufacturer mnemonic code (or null).
  *
  * @var uint32_t alertIdentifier
@@ -1149,7 +1605,7 @@ typedef struct SENTENCE_ALC
  * @var uint8_t escalationCounter
  * @brief Escalation counter (0 to 9).
  *
- * @var char[86] alertText
+ * @var char alertText[ALF_ALERT_TEXT_MAX_LENGTH]
  * @brief Alert title or additional alert description.
  *
  * @var uint8_t checksum
@@ -1159,35 +1615,77 @@ typedef struct SENTENCE_ALC
  */
 typedef struct SENTENCE_ALF
 {
-  TalkerID talkerId;
-  SentenceID sentenceId;
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_TOTAL_SENTENCES_PRESENT)
   uint8_t totalSentences;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_SENTENCE_NUMBER_PRESENT)
   uint8_t sentenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT)
   uint8_t sequentialMessageIdentifier;
-  char timeOfLastChange[9];
-  char alertCategory;
-  char alertPriority;
-  char alertState;
-  char manufacturerMnemonicCode[3];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_TIME_OF_LAST_CHANGE_PRESENT)
+  float timeOfLastChange;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_CATEGORY_PRESENT)
+  AlertCategory alertCategory;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_PRIORITY_PRESENT)
+  AlertPriority alertPriority;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_STATE_PRESENT)
+  AlertAcknowledgedState alertState;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT)
+  char manufacturerMnemonicCode[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_IDENTIFIER_PRESENT)
   uint32_t alertIdentifier;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_INSTANCE_PRESENT)
   uint32_t alertInstance;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_REVISION_COUNTER_PRESENT)
   uint8_t revisionCounter;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ESCALATION_COUNTER_PRESENT)
   uint8_t escalationCounter;
-  char alertText[86];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_TEXT_PRESENT)
+  char alertText[ALF_ALERT_TEXT_MAX_LENGTH];
+#endif
   uint8_t checksum;
 } SENTENCE_ALF;
 #endif // CFG_SENTENCE_ALF_ENABLED
 
 #if CFG_SENTENCE_ALR_ENABLED
+/* SENTENCE_ALR.presentFields bits, also the bits of CFG_SENTENCE_ALR_FIELDS */
+#define ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT (1UL << 0)
+#define ALR_ALARM_NUMBER_PRESENT (1UL << 1)
+#define ALR_ALARM_CONDITION_PRESENT (1UL << 2)
+#define ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT (1UL << 3)
+#define ALR_ALARM_DESCRIPTION_TEXT_PRESENT (1UL << 4)
+#define ALR_ALL_PRESENT 0x1FUL
+#if (CFG_SENTENCE_ALR_FIELDS) & ~ALR_ALL_PRESENT
+#error "CFG_SENTENCE_ALR_FIELDS has bits outside ALR_ALL_PRESENT"
+#endif
+
 /**
  * @brief Local alarm condition and status (ALR) sentence structure.
  *
- * This structure represents information related to the ALR (Local Alarm Condition and Status)
- * sentence. ALR sentences are used to report an alarm condition on a device and its current
- * state of acknowledgement.
+ * This structure represents information related to the ALR (Local Alarm
+ * Condition and Status) sentence. ALR sentences are used to report an alarm
+ * condition on a device and its current state of acknowledgement.
  *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ALR).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ALR).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ALR_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var float timeOfAlarmConditionChange
  * @brief Time of alarm condition change, UTC; format is hhmmss.ss.
@@ -1199,45 +1697,87 @@ typedef struct SENTENCE_ALF
  * @brief Alarm condition (A = threshold exceeded, V = not exceeded).
  *
  * @var AlarmAcknowledgedState alarmAcknowledgedState
- * @brief Alarm’s acknowledge state (A = acknowledged, V = unacknowledged).
+ * @brief Alarm's acknowledge state (A = acknowledged, V = unacknowledged).
  *
  * @var char alarmDescriptionText[ALR_ALARM_DESCRIPTION_MAX_LENGTH]
- * @brief Alarm’s description text; default length is 64 characters.
+ * @brief Alarm's description text.
  *
  * @var uint8_t checksum
  * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
  * bits of each character in the sentence, excluding "$" and "*", without
- * including start or stop bits. 
+ * including start or stop bits.
  */
 typedef struct SENTENCE_ALR
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALR_FIELDS & ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT)
   float timeOfAlarmConditionChange;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_NUMBER_PRESENT)
   uint32_t alarmNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_CONDITION_PRESENT)
   AlarmCondition alarmCondition;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT)
   AlarmAcknowledgedState alarmAcknowledgedState;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_DESCRIPTION_TEXT_PRESENT)
   char alarmDescriptionText[ALR_ALARM_DESCRIPTION_MAX_LENGTH];
+#endif
   uint8_t checksum;
 } SENTENCE_ALR;
 #endif // CFG_SENTENCE_ALR_ENABLED
 
+#if CFG_SENTENCE_APB_ENABLED
+/* SENTENCE_APB.presentFields bits, also the bits of CFG_SENTENCE_APB_FIELDS */
+#define APB_STATUS1_PRESENT (1UL << 0)
+#define APB_STATUS2_PRESENT (1UL << 1)
+#define APB_XTE_MAGNITUDE_PRESENT (1UL << 2)
+#define APB_XTE_DIRECTION_PRESENT (1UL << 3)
+#define APB_XTE_UNITS_PRESENT (1UL << 4)
+#define APB_ARRIVAL_CIRCLE_ENTERED_PRESENT (1UL << 5)
+#define APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT (1UL << 6)
+#define APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT (1UL << 7)
+#define APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT (1UL << 8)
+#define APB_DESTINATION_WAYPOINT_ID_PRESENT (1UL << 9)
+#define APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT (1UL << 10)
+#define APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT (1UL << 11)
+#define APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT (1UL << 12)
+#define APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT (1UL << 13)
+#define APB_MODE_INDICATOR_PRESENT (1UL << 14)
+#define APB_ALL_PRESENT 0x7FFFUL
+#if (CFG_SENTENCE_APB_FIELDS) & ~APB_ALL_PRESENT
+#error "CFG_SENTENCE_APB_FIELDS has bits outside APB_ALL_PRESENT"
+#endif
+
 /**
  * @brief APB: Autopilot Sentence B structure.
  *
- * This structure represents information related to the APB (Heading/track controller) sentence.
- * The APB sentence is commonly used by autopilots and contains navigation receiver warning flag
- * status, cross-track-error, waypoint arrival status, initial bearing from origin waypoint to the
- * destination, continuous bearing from present position to destination, and recommended heading to
- * steer to destination waypoint for the active navigation leg of the journey.
- * 
+ * This structure represents information related to the APB (Heading/track
+ * controller) sentence. The APB sentence is commonly used by autopilots and
+ * contains navigation receiver warning flag status, cross-track-error, waypoint
+ * arrival status, initial bearing from origin waypoint to the destination,
+ * continuous bearing from present position to destination, and recommended
+ * heading to steer to destination waypoint for the active navigation leg of the
+ * journey.
+ *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (APB).
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (APB).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (APB_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
  *
  * @var StatusField status1
- * @brief Navigation receiver warning flag status (A = Data valid, V = LORAN C blink or SNR warning).
+ * @brief Navigation receiver warning flag status (A = Data valid, V = LORAN C
+ * blink or SNR warning).
  *
  * @var StatusField status2
- * @brief Navigation receiver warning flag status (A = OK or not used, V = LORAN C cycle lock warning).
+ * @brief Navigation receiver warning flag status (A = OK or not used, V = LORAN
+ * C cycle lock warning).
  *
  * @var float xteMagnitude
  * @brief Magnitude of cross-track error.
@@ -1245,8 +1785,8 @@ typedef struct SENTENCE_ALR
  * @var char xteDirection
  * @brief Direction to steer (L/R).
  *
- * @var float xteUnits
- * @brief Cross-track error units (nautical miles).
+ * @var char xteUnits
+ * @brief Cross-track error units (N = nautical miles).
  *
  * @var StatusField arrivalCircleEntered
  * @brief Arrival circle status (A = entered, V = not entered).
@@ -1255,79 +1795,1597 @@ typedef struct SENTENCE_ALR
  * @brief Perpendicular status (A = passed, V = not passed).
  *
  * @var float bearingOriginToDestination
- * @brief Initial bearing from origin waypoint to destination (M/T).
+ * @brief Initial bearing from origin waypoint to destination.
+ *
+ * @var char bearingOriginToDestinationReference
+ * @brief Reference of the origin to destination bearing (M = magnetic, T =
+ * true).
  *
  * @var char destinationWaypointID[APB_WAYPOINT_MAX_LENGTH]
  * @brief Destination waypoint ID.
- * 
+ *
+ * @var float bearingPresentPositionToDestination
+ * @brief Bearing from present position to destination.
+ *
+ * @var char bearingPresentPositionToDestinationReference
+ * @brief Reference of the present position to destination bearing (M =
+ * magnetic, T = true).
+ *
+ * @var float headingToSteerToDestinationWaypoint
+ * @brief Heading to steer to destination waypoint.
+ *
+ * @var char headingToSteerToDestinationWaypointReference
+ * @brief Reference of the heading to steer (M = magnetic, T = true).
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, M =
+ * manual, S = simulator, N = data not valid).
+ *
  * @var uint8_t checksum
- * @brief An 8-bit checksum for error detection is computed by XOR'ing the data 
- * bits of each character in the sentence, excluding "$" and "*", without 
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
  * including start or stop bits.
  */
-#if CFG_SENTENCE_APB_ENABLED
 typedef struct SENTENCE_APB
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_STATUS1_PRESENT)
   StatusField status1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_STATUS2_PRESENT)
   StatusField status2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_XTE_MAGNITUDE_PRESENT)
   float xteMagnitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_XTE_DIRECTION_PRESENT)
   char xteDirection;
-  float xteUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_XTE_UNITS_PRESENT)
+  char xteUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_ARRIVAL_CIRCLE_ENTERED_PRESENT)
   StatusField arrivalCircleEntered;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
   StatusField perpendicularPassedAtWaypoint;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT)
   float bearingOriginToDestination;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT)
+  char bearingOriginToDestinationReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_DESTINATION_WAYPOINT_ID_PRESENT)
   char destinationWaypointID[APB_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT)
   float bearingPresentPositionToDestination;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT)
+  char bearingPresentPositionToDestinationReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT)
   float headingToSteerToDestinationWaypoint;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT)
+  char headingToSteerToDestinationWaypointReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_APB_FIELDS & APB_MODE_INDICATOR_PRESENT)
   char modeIndicator;
+#endif
   uint8_t checksum;
 } SENTENCE_APB;
 #endif // CFG_SENTENCE_APB_ENABLED
 
-#ifdef CFG_SENTENCE_ARC_ENABLED
+#if CFG_SENTENCE_ARC_ENABLED
+/* SENTENCE_ARC.presentFields bits, also the bits of CFG_SENTENCE_ARC_FIELDS */
+#define ARC_TIME_PRESENT (1UL << 0)
+#define ARC_MANUFACTURER_MNEMONIC_PRESENT (1UL << 1)
+#define ARC_ALERT_ID_PRESENT (1UL << 2)
+#define ARC_ALERT_INSTANCE_PRESENT (1UL << 3)
+#define ARC_ALERT_COMMAND_PRESENT (1UL << 4)
+#define ARC_ALL_PRESENT 0x1FUL
+#if (CFG_SENTENCE_ARC_FIELDS) & ~ARC_ALL_PRESENT
+#error "CFG_SENTENCE_ARC_FIELDS has bits outside ARC_ALL_PRESENT"
+#endif
+
 /**
  * @brief Alert command refused (ARC) sentence structure.
- * 
- * This structure represents information related to the Alert command refused (ARC) sentence.
- * ARC sentences are used for alert handling as described in IEC 61924-2.
- * 
+ *
+ * This structure represents information related to the Alert command refused
+ * (ARC) sentence. ARC sentences are used for alert handling as described in IEC
+ * 61924-2.
+ *
  * @var AddressField addressField
- * @brief The address field of the sentence: talker ID and sentence formatter (ARC).
- * 
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ARC).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ARC_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
  * @var float time
  * @brief The release time of the alert command. Optional field, can be null.
- * 
- * @var uint8_t manufacturerMnemonic[3]
- * @brief The manufacturer mnemonic code for proprietary alerts. Should be null for standardised alerts.
- * 
+ *
+ * @var char manufacturerMnemonic[4]
+ * @brief The manufacturer mnemonic code for proprietary alerts. Should be null
+ * for standardised alerts.
+ *
  * @var uint32_t alertId
- * @brief The unique identifier of the alert. Range: 10000-9999999. 0 reserved for command request to all alerts.
- * 
+ * @brief The unique identifier of the alert. Range: 10000-9999999. 0 reserved
+ * for command request to all alerts.
+ *
  * @var uint32_t alertInstance
- * @brief The alert instance identifies the current instance of an alert. Range: 1 to 999999. 0 for all instances.
- * 
+ * @brief The alert instance identifies the current instance of an alert. Range:
+ * 1 to 999999. 0 for all instances.
+ *
  * @var AlertAcknowledgedState alertCommand
- * @brief The alert command, this should not be a null field:
- * - 'A': Acknowledge
- * - 'Q': Request/Repeat information
- * - 'O': Responsibility transfer
- * - 'S': Silence
- * 
+ * @brief The refused alert command: 'A' Acknowledge, 'Q' Request/Repeat
+ * information, 'O' Responsibility transfer, 'S' Silence.
+ *
  * @var uint8_t checksum
- * @brief An 8-bit checksum for error detection is computed by XOR'ing the data bits of each character in the sentence,
- * excluding "$" and "*", without including start or stop bits.
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
  */
 typedef struct SENTENCE_ARC
 {
   AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ARC_FIELDS & ARC_TIME_PRESENT)
   float time;
-  uint8_t manufacturerMnemonic[3];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ARC_FIELDS & ARC_MANUFACTURER_MNEMONIC_PRESENT)
+  char manufacturerMnemonic[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_ID_PRESENT)
   uint32_t alertId;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_INSTANCE_PRESENT)
   uint32_t alertInstance;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_COMMAND_PRESENT)
   AlertAcknowledgedState alertCommand;
+#endif
   uint8_t checksum;
 } SENTENCE_ARC;
 #endif // CFG_SENTENCE_ARC_ENABLED
 
+#if CFG_SENTENCE_BOD_ENABLED
+/* SENTENCE_BOD.presentFields bits, also the bits of CFG_SENTENCE_BOD_FIELDS */
+#define BOD_BEARING_TRUE_PRESENT (1UL << 0)
+#define BOD_BEARING_TRUE_REFERENCE_PRESENT (1UL << 1)
+#define BOD_BEARING_MAGNETIC_PRESENT (1UL << 2)
+#define BOD_BEARING_MAGNETIC_REFERENCE_PRESENT (1UL << 3)
+#define BOD_DESTINATION_WAYPOINT_ID_PRESENT (1UL << 4)
+#define BOD_ORIGIN_WAYPOINT_ID_PRESENT (1UL << 5)
+#define BOD_ALL_PRESENT 0x3FUL
+#if (CFG_SENTENCE_BOD_FIELDS) & ~BOD_ALL_PRESENT
+#error "CFG_SENTENCE_BOD_FIELDS has bits outside BOD_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Bearing origin to destination (BOD) sentence structure.
+ *
+ * This structure represents information related to the BOD (Bearing origin to
+ * destination) sentence. BOD sentences carry the bearing angle of the line,
+ * calculated at the origin waypoint, extending to the destination waypoint from
+ * the origin waypoint for the active navigation leg of the journey.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (BOD).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (BOD_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float bearingTrue
+ * @brief Bearing origin to destination, degrees true.
+ *
+ * @var char bearingTrueReference
+ * @brief Bearing reference (T = true).
+ *
+ * @var float bearingMagnetic
+ * @brief Bearing origin to destination, degrees magnetic.
+ *
+ * @var char bearingMagneticReference
+ * @brief Bearing reference (M = magnetic).
+ *
+ * @var char destinationWaypointID[BOD_WAYPOINT_MAX_LENGTH]
+ * @brief Destination waypoint ID.
+ *
+ * @var char originWaypointID[BOD_WAYPOINT_MAX_LENGTH]
+ * @brief Origin waypoint ID.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_BOD
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_PRESENT)
+  float bearingTrue;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_REFERENCE_PRESENT)
+  char bearingTrueReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_PRESENT)
+  float bearingMagnetic;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_REFERENCE_PRESENT)
+  char bearingMagneticReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_DESTINATION_WAYPOINT_ID_PRESENT)
+  char destinationWaypointID[BOD_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BOD_FIELDS & BOD_ORIGIN_WAYPOINT_ID_PRESENT)
+  char originWaypointID[BOD_WAYPOINT_MAX_LENGTH];
+#endif
+  uint8_t checksum;
+} SENTENCE_BOD;
+#endif // CFG_SENTENCE_BOD_ENABLED
+
+#if CFG_SENTENCE_BWC_ENABLED
+/* SENTENCE_BWC.presentFields bits, also the bits of CFG_SENTENCE_BWC_FIELDS */
+#define BWC_UTC_TIME_PRESENT (1UL << 0)
+#define BWC_WAYPOINT_LATITUDE_PRESENT (1UL << 1)
+#define BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT (1UL << 2)
+#define BWC_WAYPOINT_LONGITUDE_PRESENT (1UL << 3)
+#define BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT (1UL << 4)
+#define BWC_BEARING_TRUE_PRESENT (1UL << 5)
+#define BWC_BEARING_TRUE_REFERENCE_PRESENT (1UL << 6)
+#define BWC_BEARING_MAGNETIC_PRESENT (1UL << 7)
+#define BWC_BEARING_MAGNETIC_REFERENCE_PRESENT (1UL << 8)
+#define BWC_DISTANCE_PRESENT (1UL << 9)
+#define BWC_DISTANCE_UNITS_PRESENT (1UL << 10)
+#define BWC_WAYPOINT_ID_PRESENT (1UL << 11)
+#define BWC_MODE_INDICATOR_PRESENT (1UL << 12)
+#define BWC_ALL_PRESENT 0x1FFFUL
+#if (CFG_SENTENCE_BWC_FIELDS) & ~BWC_ALL_PRESENT
+#error "CFG_SENTENCE_BWC_FIELDS has bits outside BWC_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Bearing and distance to waypoint - great circle (BWC) sentence structure.
+ *
+ * This structure represents information related to the BWC (Bearing and
+ * distance to waypoint - great circle) sentence. BWC sentences carry the time,
+ * distance and bearing to, and location of, a specified waypoint from present
+ * position, along the great circle path.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (BWC).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (BWC_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float utcTime
+ * @brief UTC of observation.
+ *
+ * @var float waypointLatitude
+ * @brief Waypoint latitude (ddmm.mm).
+ *
+ * @var Polarity waypointLatitudePolarity
+ * @brief Waypoint latitude polarity (N/S).
+ *
+ * @var float waypointLongitude
+ * @brief Waypoint longitude (dddmm.mm).
+ *
+ * @var Polarity waypointLongitudePolarity
+ * @brief Waypoint longitude polarity (E/W).
+ *
+ * @var float bearingTrue
+ * @brief Bearing to waypoint, degrees true.
+ *
+ * @var char bearingTrueReference
+ * @brief Bearing reference (T = true).
+ *
+ * @var float bearingMagnetic
+ * @brief Bearing to waypoint, degrees magnetic.
+ *
+ * @var char bearingMagneticReference
+ * @brief Bearing reference (M = magnetic).
+ *
+ * @var float distance
+ * @brief Distance to waypoint, nautical miles.
+ *
+ * @var char distanceUnits
+ * @brief Distance units (N = nautical miles).
+ *
+ * @var char waypointID[BWC_WAYPOINT_MAX_LENGTH]
+ * @brief Waypoint ID.
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, M =
+ * manual, S = simulator, N = data not valid).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_BWC
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_UTC_TIME_PRESENT)
+  float utcTime;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_PRESENT)
+  float waypointLatitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT)
+  Polarity waypointLatitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_PRESENT)
+  float waypointLongitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT)
+  Polarity waypointLongitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_PRESENT)
+  float bearingTrue;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_REFERENCE_PRESENT)
+  char bearingTrueReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_PRESENT)
+  float bearingMagnetic;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_REFERENCE_PRESENT)
+  char bearingMagneticReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_PRESENT)
+  float distance;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_UNITS_PRESENT)
+  char distanceUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_ID_PRESENT)
+  char waypointID[BWC_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_BWC_FIELDS & BWC_MODE_INDICATOR_PRESENT)
+  char modeIndicator;
+#endif
+  uint8_t checksum;
+} SENTENCE_BWC;
+#endif // CFG_SENTENCE_BWC_ENABLED
+
+#if CFG_SENTENCE_DTM_ENABLED
+/* SENTENCE_DTM.presentFields bits, also the bits of CFG_SENTENCE_DTM_FIELDS */
+#define DTM_LOCAL_DATUM_PRESENT (1UL << 0)
+#define DTM_LOCAL_DATUM_SUBDIVISION_PRESENT (1UL << 1)
+#define DTM_LATITUDE_OFFSET_PRESENT (1UL << 2)
+#define DTM_LATITUDE_OFFSET_POLARITY_PRESENT (1UL << 3)
+#define DTM_LONGITUDE_OFFSET_PRESENT (1UL << 4)
+#define DTM_LONGITUDE_OFFSET_POLARITY_PRESENT (1UL << 5)
+#define DTM_ALTITUDE_OFFSET_PRESENT (1UL << 6)
+#define DTM_REFERENCE_DATUM_PRESENT (1UL << 7)
+#define DTM_ALL_PRESENT 0xFFUL
+#if (CFG_SENTENCE_DTM_FIELDS) & ~DTM_ALL_PRESENT
+#error "CFG_SENTENCE_DTM_FIELDS has bits outside DTM_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Datum reference (DTM) sentence structure.
+ *
+ * This structure represents information related to the DTM (Datum reference)
+ * sentence. DTM sentences identify the local geodetic datum of the positions
+ * that follow and its offsets from the reference datum. Position in local datum
+ * = position in reference datum + offset.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (DTM).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (DTM_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var char localDatum[4]
+ * @brief Local datum code (W84 = WGS-84, W72 = WGS-72, S85 = SGS-85, P90 =
+ * PE-90, 999 = user defined, or an IHO datum code).
+ *
+ * @var char localDatumSubdivision
+ * @brief Local datum subdivision code, null if none.
+ *
+ * @var float latitudeOffset
+ * @brief Latitude offset, minutes.
+ *
+ * @var Polarity latitudeOffsetPolarity
+ * @brief Latitude offset polarity (N/S).
+ *
+ * @var float longitudeOffset
+ * @brief Longitude offset, minutes.
+ *
+ * @var Polarity longitudeOffsetPolarity
+ * @brief Longitude offset polarity (E/W).
+ *
+ * @var float altitudeOffset
+ * @brief Altitude offset, metres.
+ *
+ * @var char referenceDatum[4]
+ * @brief Reference datum code (W84 = WGS-84, W72 = WGS-72, S85 = SGS-85, P90 =
+ * PE-90).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_DTM
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_PRESENT)
+  char localDatum[4];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT)
+  char localDatumSubdivision;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_PRESENT)
+  float latitudeOffset;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_POLARITY_PRESENT)
+  Polarity latitudeOffsetPolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_PRESENT)
+  float longitudeOffset;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_POLARITY_PRESENT)
+  Polarity longitudeOffsetPolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_ALTITUDE_OFFSET_PRESENT)
+  float altitudeOffset;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_DTM_FIELDS & DTM_REFERENCE_DATUM_PRESENT)
+  char referenceDatum[4];
+#endif
+  uint8_t checksum;
+} SENTENCE_DTM;
+#endif // CFG_SENTENCE_DTM_ENABLED
+
+#if CFG_SENTENCE_GGA_ENABLED
+/* SENTENCE_GGA.presentFields bits, also the bits of CFG_SENTENCE_GGA_FIELDS */
+#define GGA_UTC_TIME_PRESENT (1UL << 0)
+#define GGA_LATITUDE_PRESENT (1UL << 1)
+#define GGA_LATITUDE_POLARITY_PRESENT (1UL << 2)
+#define GGA_LONGITUDE_PRESENT (1UL << 3)
+#define GGA_LONGITUDE_POLARITY_PRESENT (1UL << 4)
+#define GGA_QUALITY_INDICATOR_PRESENT (1UL << 5)
+#define GGA_SATELLITES_IN_USE_PRESENT (1UL << 6)
+#define GGA_HDOP_PRESENT (1UL << 7)
+#define GGA_ALTITUDE_PRESENT (1UL << 8)
+#define GGA_ALTITUDE_UNITS_PRESENT (1UL << 9)
+#define GGA_GEOIDAL_SEPARATION_PRESENT (1UL << 10)
+#define GGA_GEOIDAL_SEPARATION_UNITS_PRESENT (1UL << 11)
+#define GGA_DIFFERENTIAL_DATA_AGE_PRESENT (1UL << 12)
+#define GGA_DIFFERENTIAL_STATION_ID_PRESENT (1UL << 13)
+#define GGA_ALL_PRESENT 0x3FFFUL
+#if (CFG_SENTENCE_GGA_FIELDS) & ~GGA_ALL_PRESENT
+#error "CFG_SENTENCE_GGA_FIELDS has bits outside GGA_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Global positioning system (GPS) fix data (GGA) sentence structure.
+ *
+ * This structure represents information related to the GGA (Global positioning
+ * system fix data) sentence. GGA sentences carry the time, position and fix
+ * related data of a GPS receiver.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (GGA).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (GGA_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float utcTime
+ * @brief UTC of position.
+ *
+ * @var float latitude
+ * @brief Latitude (ddmm.mm).
+ *
+ * @var Polarity latitudePolarity
+ * @brief Latitude polarity (N/S).
+ *
+ * @var float longitude
+ * @brief Longitude (dddmm.mm).
+ *
+ * @var Polarity longitudePolarity
+ * @brief Longitude polarity (E/W).
+ *
+ * @var GPSQualityIndicator qualityIndicator
+ * @brief GPS quality indicator.
+ *
+ * @var uint8_t satellitesInUse
+ * @brief Number of satellites in use, 00-12, may be different from the number
+ * in view.
+ *
+ * @var float hdop
+ * @brief Horizontal dilution of precision.
+ *
+ * @var float altitude
+ * @brief Altitude re: mean-sea-level (geoid).
+ *
+ * @var char altitudeUnits
+ * @brief Altitude units (M = metres).
+ *
+ * @var float geoidalSeparation
+ * @brief Geoidal separation, the difference between the WGS-84 earth ellipsoid
+ * and mean-sea-level (geoid); '-' = mean-sea-level below ellipsoid.
+ *
+ * @var char geoidalSeparationUnits
+ * @brief Geoidal separation units (M = metres).
+ *
+ * @var float differentialDataAge
+ * @brief Age of differential GPS data in seconds, null when DGPS is not used.
+ *
+ * @var uint16_t differentialStationId
+ * @brief Differential reference station ID, 0000-1023.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_GGA
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_UTC_TIME_PRESENT)
+  float utcTime;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_PRESENT)
+  float latitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_POLARITY_PRESENT)
+  Polarity latitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_PRESENT)
+  float longitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_POLARITY_PRESENT)
+  Polarity longitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_QUALITY_INDICATOR_PRESENT)
+  GPSQualityIndicator qualityIndicator;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_SATELLITES_IN_USE_PRESENT)
+  uint8_t satellitesInUse;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_HDOP_PRESENT)
+  float hdop;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_PRESENT)
+  float altitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_UNITS_PRESENT)
+  char altitudeUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_PRESENT)
+  float geoidalSeparation;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_UNITS_PRESENT)
+  char geoidalSeparationUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_DATA_AGE_PRESENT)
+  float differentialDataAge;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_STATION_ID_PRESENT)
+  uint16_t differentialStationId;
+#endif
+  uint8_t checksum;
+} SENTENCE_GGA;
+#endif // CFG_SENTENCE_GGA_ENABLED
+
+#if CFG_SENTENCE_GSA_ENABLED
+/* SENTENCE_GSA.presentFields bits, also the bits of CFG_SENTENCE_GSA_FIELDS */
+#define GSA_SELECTION_MODE_PRESENT (1UL << 0)
+#define GSA_FIX_MODE_PRESENT (1UL << 1)
+#define GSA_SATELLITE_ID1_PRESENT (1UL << 2)
+#define GSA_SATELLITE_ID2_PRESENT (1UL << 3)
+#define GSA_SATELLITE_ID3_PRESENT (1UL << 4)
+#define GSA_SATELLITE_ID4_PRESENT (1UL << 5)
+#define GSA_SATELLITE_ID5_PRESENT (1UL << 6)
+#define GSA_SATELLITE_ID6_PRESENT (1UL << 7)
+#define GSA_SATELLITE_ID7_PRESENT (1UL << 8)
+#define GSA_SATELLITE_ID8_PRESENT (1UL << 9)
+#define GSA_SATELLITE_ID9_PRESENT (1UL << 10)
+#define GSA_SATELLITE_ID10_PRESENT (1UL << 11)
+#define GSA_SATELLITE_ID11_PRESENT (1UL << 12)
+#define GSA_SATELLITE_ID12_PRESENT (1UL << 13)
+#define GSA_PDOP_PRESENT (1UL << 14)
+#define GSA_HDOP_PRESENT (1UL << 15)
+#define GSA_VDOP_PRESENT (1UL << 16)
+#define GSA_ALL_PRESENT 0x1FFFFUL
+#if (CFG_SENTENCE_GSA_FIELDS) & ~GSA_ALL_PRESENT
+#error "CFG_SENTENCE_GSA_FIELDS has bits outside GSA_ALL_PRESENT"
+#endif
+
+/**
+ * @brief GNSS DOP and active satellites (GSA) sentence structure.
+ *
+ * This structure represents information related to the GSA (GNSS DOP and active
+ * satellites) sentence. GSA sentences carry the GNSS receiver operating mode,
+ * the satellites used in the navigation solution and the DOP values.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (GSA).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (GSA_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var char selectionMode
+ * @brief Mode (M = manual, forced to operate in 2D or 3D mode; A = automatic,
+ * allowed to automatically switch 2D/3D).
+ *
+ * @var uint8_t fixMode
+ * @brief Mode (1 = fix not available, 2 = 2D, 3 = 3D).
+ *
+ * @var uint8_t satelliteId1
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId2
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId3
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId4
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId5
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId6
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId7
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId8
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId9
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId10
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId11
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var uint8_t satelliteId12
+ * @brief ID number of satellite used in solution, null if unused.
+ *
+ * @var float pdop
+ * @brief Position dilution of precision.
+ *
+ * @var float hdop
+ * @brief Horizontal dilution of precision.
+ *
+ * @var float vdop
+ * @brief Vertical dilution of precision.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_GSA
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SELECTION_MODE_PRESENT)
+  char selectionMode;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_FIX_MODE_PRESENT)
+  uint8_t fixMode;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID1_PRESENT)
+  uint8_t satelliteId1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID2_PRESENT)
+  uint8_t satelliteId2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID3_PRESENT)
+  uint8_t satelliteId3;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID4_PRESENT)
+  uint8_t satelliteId4;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID5_PRESENT)
+  uint8_t satelliteId5;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID6_PRESENT)
+  uint8_t satelliteId6;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID7_PRESENT)
+  uint8_t satelliteId7;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID8_PRESENT)
+  uint8_t satelliteId8;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID9_PRESENT)
+  uint8_t satelliteId9;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID10_PRESENT)
+  uint8_t satelliteId10;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID11_PRESENT)
+  uint8_t satelliteId11;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID12_PRESENT)
+  uint8_t satelliteId12;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_PDOP_PRESENT)
+  float pdop;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_HDOP_PRESENT)
+  float hdop;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSA_FIELDS & GSA_VDOP_PRESENT)
+  float vdop;
+#endif
+  uint8_t checksum;
+} SENTENCE_GSA;
+#endif // CFG_SENTENCE_GSA_ENABLED
+
+#if CFG_SENTENCE_GST_ENABLED
+/* SENTENCE_GST.presentFields bits, also the bits of CFG_SENTENCE_GST_FIELDS */
+#define GST_UTC_TIME_PRESENT (1UL << 0)
+#define GST_RANGE_RMS_PRESENT (1UL << 1)
+#define GST_SEMI_MAJOR_ERROR_PRESENT (1UL << 2)
+#define GST_SEMI_MINOR_ERROR_PRESENT (1UL << 3)
+#define GST_SEMI_MAJOR_ORIENTATION_PRESENT (1UL << 4)
+#define GST_LATITUDE_ERROR_PRESENT (1UL << 5)
+#define GST_LONGITUDE_ERROR_PRESENT (1UL << 6)
+#define GST_ALTITUDE_ERROR_PRESENT (1UL << 7)
+#define GST_ALL_PRESENT 0xFFUL
+#if (CFG_SENTENCE_GST_FIELDS) & ~GST_ALL_PRESENT
+#error "CFG_SENTENCE_GST_FIELDS has bits outside GST_ALL_PRESENT"
+#endif
+
+/**
+ * @brief GNSS pseudorange noise statistics (GST) sentence structure.
+ *
+ * This structure represents information related to the GST (GNSS pseudorange
+ * noise statistics) sentence. GST sentences carry the error statistics of the
+ * position fix reported in GGA.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (GST).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (GST_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float utcTime
+ * @brief UTC time of the associated GGA fix.
+ *
+ * @var float rangeRms
+ * @brief RMS value of the standard deviation of the range inputs to the
+ * navigation process.
+ *
+ * @var float semiMajorError
+ * @brief Standard deviation of semi-major axis of error ellipse, metres.
+ *
+ * @var float semiMinorError
+ * @brief Standard deviation of semi-minor axis of error ellipse, metres.
+ *
+ * @var float semiMajorOrientation
+ * @brief Orientation of semi-major axis of error ellipse, degrees from true
+ * north.
+ *
+ * @var float latitudeError
+ * @brief Standard deviation of latitude error, metres.
+ *
+ * @var float longitudeError
+ * @brief Standard deviation of longitude error, metres.
+ *
+ * @var float altitudeError
+ * @brief Standard deviation of altitude error, metres.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_GST
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_UTC_TIME_PRESENT)
+  float utcTime;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_RANGE_RMS_PRESENT)
+  float rangeRms;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ERROR_PRESENT)
+  float semiMajorError;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_SEMI_MINOR_ERROR_PRESENT)
+  float semiMinorError;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ORIENTATION_PRESENT)
+  float semiMajorOrientation;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_LATITUDE_ERROR_PRESENT)
+  float latitudeError;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_LONGITUDE_ERROR_PRESENT)
+  float longitudeError;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GST_FIELDS & GST_ALTITUDE_ERROR_PRESENT)
+  float altitudeError;
+#endif
+  uint8_t checksum;
+} SENTENCE_GST;
+#endif // CFG_SENTENCE_GST_ENABLED
+
+#if CFG_SENTENCE_GSV_ENABLED
+/* SENTENCE_GSV.presentFields bits, also the bits of CFG_SENTENCE_GSV_FIELDS */
+#define GSV_TOTAL_SENTENCES_PRESENT (1UL << 0)
+#define GSV_SENTENCE_NUMBER_PRESENT (1UL << 1)
+#define GSV_SATELLITES_IN_VIEW_PRESENT (1UL << 2)
+#define GSV_ALL_PRESENT 0x7UL
+#if (CFG_SENTENCE_GSV_FIELDS) & ~GSV_ALL_PRESENT
+#error "CFG_SENTENCE_GSV_FIELDS has bits outside GSV_ALL_PRESENT"
+#endif
+
+/**
+ * @brief GNSS satellites in view (GSV) sentence structure.
+ *
+ * This structure represents information related to the GSV (GNSS satellites in
+ * view) sentence. GSV sentences carry the number of satellites in view,
+ * satellite ID numbers, elevation, azimuth, and SNR value, four satellites per
+ * sentence.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (GSV).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (GSV_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var uint8_t totalSentences
+ * @brief Total number of sentences, 1 to 9.
+ *
+ * @var uint8_t sentenceNumber
+ * @brief Sentence number, 1 to 9.
+ *
+ * @var uint8_t satellitesInView
+ * @brief Total number of satellites in view.
+ *
+ * @var uint8_t satelliteCount
+ * @brief Number of entries in satellites.
+ *
+ * @var SatelliteInView satellites[4]
+ * @brief Satellites reported by this sentence.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_GSV
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSV_FIELDS & GSV_TOTAL_SENTENCES_PRESENT)
+  uint8_t totalSentences;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSV_FIELDS & GSV_SENTENCE_NUMBER_PRESENT)
+  uint8_t sentenceNumber;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_GSV_FIELDS & GSV_SATELLITES_IN_VIEW_PRESENT)
+  uint8_t satellitesInView;
+#endif
+  uint8_t satelliteCount;
+  SatelliteInView satellites[4];
+  uint8_t checksum;
+} SENTENCE_GSV;
+#endif // CFG_SENTENCE_GSV_ENABLED
+
+#if CFG_SENTENCE_HDT_ENABLED
+/* SENTENCE_HDT.presentFields bits, also the bits of CFG_SENTENCE_HDT_FIELDS */
+#define HDT_HEADING_PRESENT (1UL << 0)
+#define HDT_HEADING_REFERENCE_PRESENT (1UL << 1)
+#define HDT_ALL_PRESENT 0x3UL
+#if (CFG_SENTENCE_HDT_FIELDS) & ~HDT_ALL_PRESENT
+#error "CFG_SENTENCE_HDT_FIELDS has bits outside HDT_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Heading true (HDT) sentence structure.
+ *
+ * This structure represents information related to the HDT (Heading true)
+ * sentence. HDT sentences carry the actual vessel heading in degrees true
+ * produced by any device or system producing true heading.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (HDT).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (HDT_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float heading
+ * @brief Heading, degrees true.
+ *
+ * @var char headingReference
+ * @brief Heading reference (T = true).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_HDT
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_PRESENT)
+  float heading;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_REFERENCE_PRESENT)
+  char headingReference;
+#endif
+  uint8_t checksum;
+} SENTENCE_HDT;
+#endif // CFG_SENTENCE_HDT_ENABLED
+
+#if CFG_SENTENCE_RMB_ENABLED
+/* SENTENCE_RMB.presentFields bits, also the bits of CFG_SENTENCE_RMB_FIELDS */
+#define RMB_STATUS_PRESENT (1UL << 0)
+#define RMB_XTE_MAGNITUDE_PRESENT (1UL << 1)
+#define RMB_DIRECTION_TO_STEER_PRESENT (1UL << 2)
+#define RMB_ORIGIN_WAYPOINT_ID_PRESENT (1UL << 3)
+#define RMB_DESTINATION_WAYPOINT_ID_PRESENT (1UL << 4)
+#define RMB_DESTINATION_LATITUDE_PRESENT (1UL << 5)
+#define RMB_DESTINATION_LATITUDE_POLARITY_PRESENT (1UL << 6)
+#define RMB_DESTINATION_LONGITUDE_PRESENT (1UL << 7)
+#define RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT (1UL << 8)
+#define RMB_RANGE_TO_DESTINATION_PRESENT (1UL << 9)
+#define RMB_BEARING_TO_DESTINATION_PRESENT (1UL << 10)
+#define RMB_CLOSING_VELOCITY_PRESENT (1UL << 11)
+#define RMB_ARRIVAL_STATUS_PRESENT (1UL << 12)
+#define RMB_MODE_INDICATOR_PRESENT (1UL << 13)
+#define RMB_ALL_PRESENT 0x3FFFUL
+#if (CFG_SENTENCE_RMB_FIELDS) & ~RMB_ALL_PRESENT
+#error "CFG_SENTENCE_RMB_FIELDS has bits outside RMB_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Recommended minimum navigation information (RMB) sentence structure.
+ *
+ * This structure represents information related to the RMB (Recommended minimum
+ * navigation information) sentence. RMB sentences carry the navigation data
+ * from present position to a destination waypoint provided by a navigation
+ * receiver.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (RMB).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (RMB_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var StatusField status
+ * @brief Data status (A = data valid, V = navigation receiver warning).
+ *
+ * @var float xteMagnitude
+ * @brief Cross-track error, nautical miles.
+ *
+ * @var char directionToSteer
+ * @brief Direction to steer to correct the error (L/R).
+ *
+ * @var char originWaypointID[RMB_WAYPOINT_MAX_LENGTH]
+ * @brief Origin waypoint ID.
+ *
+ * @var char destinationWaypointID[RMB_WAYPOINT_MAX_LENGTH]
+ * @brief Destination waypoint ID.
+ *
+ * @var float destinationLatitude
+ * @brief Destination waypoint latitude (ddmm.mm).
+ *
+ * @var Polarity destinationLatitudePolarity
+ * @brief Destination waypoint latitude polarity (N/S).
+ *
+ * @var float destinationLongitude
+ * @brief Destination waypoint longitude (dddmm.mm).
+ *
+ * @var Polarity destinationLongitudePolarity
+ * @brief Destination waypoint longitude polarity (E/W).
+ *
+ * @var float rangeToDestination
+ * @brief Range to destination, nautical miles.
+ *
+ * @var float bearingToDestination
+ * @brief Bearing to destination, degrees true.
+ *
+ * @var float closingVelocity
+ * @brief Destination closing velocity, knots.
+ *
+ * @var StatusField arrivalStatus
+ * @brief Arrival status (A = arrival circle entered or perpendicular passed, V
+ * = not entered/passed).
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, M =
+ * manual, S = simulator, N = data not valid).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_RMB
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_STATUS_PRESENT)
+  StatusField status;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_XTE_MAGNITUDE_PRESENT)
+  float xteMagnitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DIRECTION_TO_STEER_PRESENT)
+  char directionToSteer;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_ORIGIN_WAYPOINT_ID_PRESENT)
+  char originWaypointID[RMB_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_WAYPOINT_ID_PRESENT)
+  char destinationWaypointID[RMB_WAYPOINT_MAX_LENGTH];
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_PRESENT)
+  float destinationLatitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_POLARITY_PRESENT)
+  Polarity destinationLatitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_PRESENT)
+  float destinationLongitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT)
+  Polarity destinationLongitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_RANGE_TO_DESTINATION_PRESENT)
+  float rangeToDestination;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_BEARING_TO_DESTINATION_PRESENT)
+  float bearingToDestination;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_CLOSING_VELOCITY_PRESENT)
+  float closingVelocity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_ARRIVAL_STATUS_PRESENT)
+  StatusField arrivalStatus;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMB_FIELDS & RMB_MODE_INDICATOR_PRESENT)
+  char modeIndicator;
+#endif
+  uint8_t checksum;
+} SENTENCE_RMB;
+#endif // CFG_SENTENCE_RMB_ENABLED
+
+#if CFG_SENTENCE_RMC_ENABLED
+/* SENTENCE_RMC.presentFields bits, also the bits of CFG_SENTENCE_RMC_FIELDS */
+#define RMC_UTC_TIME_PRESENT (1UL << 0)
+#define RMC_STATUS_PRESENT (1UL << 1)
+#define RMC_LATITUDE_PRESENT (1UL << 2)
+#define RMC_LATITUDE_POLARITY_PRESENT (1UL << 3)
+#define RMC_LONGITUDE_PRESENT (1UL << 4)
+#define RMC_LONGITUDE_POLARITY_PRESENT (1UL << 5)
+#define RMC_SPEED_OVER_GROUND_PRESENT (1UL << 6)
+#define RMC_COURSE_OVER_GROUND_PRESENT (1UL << 7)
+#define RMC_DATE_PRESENT (1UL << 8)
+#define RMC_MAGNETIC_VARIATION_PRESENT (1UL << 9)
+#define RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT (1UL << 10)
+#define RMC_MODE_INDICATOR_PRESENT (1UL << 11)
+#define RMC_NAVIGATIONAL_STATUS_PRESENT (1UL << 12)
+#define RMC_ALL_PRESENT 0x1FFFUL
+#if (CFG_SENTENCE_RMC_FIELDS) & ~RMC_ALL_PRESENT
+#error "CFG_SENTENCE_RMC_FIELDS has bits outside RMC_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Recommended minimum specific GNSS data (RMC) sentence structure.
+ *
+ * This structure represents information related to the RMC (Recommended minimum
+ * specific GNSS data) sentence. RMC sentences carry time, date, position,
+ * course and speed data provided by a GNSS navigation receiver.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (RMC).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (RMC_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float utcTime
+ * @brief UTC of position fix.
+ *
+ * @var StatusField status
+ * @brief Status (A = data valid, V = navigation receiver warning).
+ *
+ * @var float latitude
+ * @brief Latitude (ddmm.mm).
+ *
+ * @var Polarity latitudePolarity
+ * @brief Latitude polarity (N/S).
+ *
+ * @var float longitude
+ * @brief Longitude (dddmm.mm).
+ *
+ * @var Polarity longitudePolarity
+ * @brief Longitude polarity (E/W).
+ *
+ * @var float speedOverGround
+ * @brief Speed over ground, knots.
+ *
+ * @var float courseOverGround
+ * @brief Course over ground, degrees true.
+ *
+ * @var uint32_t date
+ * @brief Date (ddmmyy).
+ *
+ * @var float magneticVariation
+ * @brief Magnetic variation, degrees.
+ *
+ * @var Polarity magneticVariationDirection
+ * @brief Magnetic variation direction (E/W). Easterly variation subtracts from
+ * true course.
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, F =
+ * float RTK, M = manual, N = no fix, P = precise, R = RTK, S = simulator).
+ *
+ * @var char navigationalStatus
+ * @brief Navigational status (S = safe, C = caution, U = unsafe, V = not
+ * valid).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_RMC
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_UTC_TIME_PRESENT)
+  float utcTime;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_STATUS_PRESENT)
+  StatusField status;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_PRESENT)
+  float latitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_POLARITY_PRESENT)
+  Polarity latitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_PRESENT)
+  float longitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_POLARITY_PRESENT)
+  Polarity longitudePolarity;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_SPEED_OVER_GROUND_PRESENT)
+  float speedOverGround;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_COURSE_OVER_GROUND_PRESENT)
+  float courseOverGround;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_DATE_PRESENT)
+  uint32_t date;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_PRESENT)
+  float magneticVariation;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT)
+  Polarity magneticVariationDirection;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_MODE_INDICATOR_PRESENT)
+  char modeIndicator;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_RMC_FIELDS & RMC_NAVIGATIONAL_STATUS_PRESENT)
+  char navigationalStatus;
+#endif
+  uint8_t checksum;
+} SENTENCE_RMC;
+#endif // CFG_SENTENCE_RMC_ENABLED
+
+#if CFG_SENTENCE_VTG_ENABLED
+/* SENTENCE_VTG.presentFields bits, also the bits of CFG_SENTENCE_VTG_FIELDS */
+#define VTG_COURSE_OVER_GROUND_TRUE_PRESENT (1UL << 0)
+#define VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT (1UL << 1)
+#define VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT (1UL << 2)
+#define VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT (1UL << 3)
+#define VTG_SPEED_OVER_GROUND_KNOTS_PRESENT (1UL << 4)
+#define VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT (1UL << 5)
+#define VTG_SPEED_OVER_GROUND_KMH_PRESENT (1UL << 6)
+#define VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT (1UL << 7)
+#define VTG_MODE_INDICATOR_PRESENT (1UL << 8)
+#define VTG_ALL_PRESENT 0x1FFUL
+#if (CFG_SENTENCE_VTG_FIELDS) & ~VTG_ALL_PRESENT
+#error "CFG_SENTENCE_VTG_FIELDS has bits outside VTG_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Course over ground and ground speed (VTG) sentence structure.
+ *
+ * This structure represents information related to the VTG (Course over ground
+ * and ground speed) sentence. VTG sentences carry the actual course and speed
+ * relative to the ground.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (VTG).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (VTG_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float courseOverGroundTrue
+ * @brief Course over ground, degrees true.
+ *
+ * @var char courseOverGroundTrueReference
+ * @brief Course reference (T = true).
+ *
+ * @var float courseOverGroundMagnetic
+ * @brief Course over ground, degrees magnetic.
+ *
+ * @var char courseOverGroundMagneticReference
+ * @brief Course reference (M = magnetic).
+ *
+ * @var float speedOverGroundKnots
+ * @brief Speed over ground, knots.
+ *
+ * @var char speedOverGroundKnotsUnits
+ * @brief Speed units (N = knots).
+ *
+ * @var float speedOverGroundKmh
+ * @brief Speed over ground, km/h.
+ *
+ * @var char speedOverGroundKmhUnits
+ * @brief Speed units (K = km/h).
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, M =
+ * manual, P = precise, S = simulator, N = data not valid).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_VTG
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_PRESENT)
+  float courseOverGroundTrue;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT)
+  char courseOverGroundTrueReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT)
+  float courseOverGroundMagnetic;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT)
+  char courseOverGroundMagneticReference;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_PRESENT)
+  float speedOverGroundKnots;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT)
+  char speedOverGroundKnotsUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_PRESENT)
+  float speedOverGroundKmh;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT)
+  char speedOverGroundKmhUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_VTG_FIELDS & VTG_MODE_INDICATOR_PRESENT)
+  char modeIndicator;
+#endif
+  uint8_t checksum;
+} SENTENCE_VTG;
+#endif // CFG_SENTENCE_VTG_ENABLED
+
+#if CFG_SENTENCE_XTE_ENABLED
+/* SENTENCE_XTE.presentFields bits, also the bits of CFG_SENTENCE_XTE_FIELDS */
+#define XTE_STATUS1_PRESENT (1UL << 0)
+#define XTE_STATUS2_PRESENT (1UL << 1)
+#define XTE_XTE_MAGNITUDE_PRESENT (1UL << 2)
+#define XTE_DIRECTION_TO_STEER_PRESENT (1UL << 3)
+#define XTE_XTE_UNITS_PRESENT (1UL << 4)
+#define XTE_MODE_INDICATOR_PRESENT (1UL << 5)
+#define XTE_ALL_PRESENT 0x3FUL
+#if (CFG_SENTENCE_XTE_FIELDS) & ~XTE_ALL_PRESENT
+#error "CFG_SENTENCE_XTE_FIELDS has bits outside XTE_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Cross-track error, measured (XTE) sentence structure.
+ *
+ * This structure represents information related to the XTE (Cross-track error,
+ * measured) sentence. XTE sentences carry the magnitude of the position error
+ * perpendicular to the intended track line and the direction to steer to remove
+ * it.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (XTE).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (XTE_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var StatusField status1
+ * @brief Status (A = data valid, V = LORAN C blink or SNR warning).
+ *
+ * @var StatusField status2
+ * @brief Status (A = data valid or not used, V = LORAN C cycle lock warning).
+ *
+ * @var float xteMagnitude
+ * @brief Magnitude of cross-track error.
+ *
+ * @var char directionToSteer
+ * @brief Direction to steer (L/R).
+ *
+ * @var char xteUnits
+ * @brief Cross-track error units (N = nautical miles).
+ *
+ * @var char modeIndicator
+ * @brief Mode indicator (A = autonomous, D = differential, E = estimated, M =
+ * manual, S = simulator, N = data not valid).
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_XTE
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_STATUS1_PRESENT)
+  StatusField status1;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_STATUS2_PRESENT)
+  StatusField status2;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_XTE_MAGNITUDE_PRESENT)
+  float xteMagnitude;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_DIRECTION_TO_STEER_PRESENT)
+  char directionToSteer;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_XTE_UNITS_PRESENT)
+  char xteUnits;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_XTE_FIELDS & XTE_MODE_INDICATOR_PRESENT)
+  char modeIndicator;
+#endif
+  uint8_t checksum;
+} SENTENCE_XTE;
+#endif // CFG_SENTENCE_XTE_ENABLED
+
+#if CFG_SENTENCE_ZDA_ENABLED
+/* SENTENCE_ZDA.presentFields bits, also the bits of CFG_SENTENCE_ZDA_FIELDS */
+#define ZDA_UTC_TIME_PRESENT (1UL << 0)
+#define ZDA_DAY_PRESENT (1UL << 1)
+#define ZDA_MONTH_PRESENT (1UL << 2)
+#define ZDA_YEAR_PRESENT (1UL << 3)
+#define ZDA_LOCAL_ZONE_HOURS_PRESENT (1UL << 4)
+#define ZDA_LOCAL_ZONE_MINUTES_PRESENT (1UL << 5)
+#define ZDA_ALL_PRESENT 0x3FUL
+#if (CFG_SENTENCE_ZDA_FIELDS) & ~ZDA_ALL_PRESENT
+#error "CFG_SENTENCE_ZDA_FIELDS has bits outside ZDA_ALL_PRESENT"
+#endif
+
+/**
+ * @brief Time and date (ZDA) sentence structure.
+ *
+ * This structure represents information related to the ZDA (Time and date)
+ * sentence. ZDA sentences carry UTC, day, month, year and local time zone.
+ *
+ * @var AddressField addressField
+ * @brief The address field of the sentence: talker ID and sentence formatter
+ * (ZDA).
+ *
+ * @var uint32_t presentFields
+ * @brief Bit mask of the fields that were not null (ZDA_*_PRESENT). Null fields
+ * read as zero or empty; the encoder writes a null field for every clear bit.
+ *
+ * @var float utcTime
+ * @brief UTC.
+ *
+ * @var uint8_t day
+ * @brief Day, 01 to 31 (UTC).
+ *
+ * @var uint8_t month
+ * @brief Month, 01 to 12 (UTC).
+ *
+ * @var uint16_t year
+ * @brief Year (UTC).
+ *
+ * @var float localZoneHours
+ * @brief Local zone hours, 00 to +/-13 hours. Local time = UTC + zone.
+ *
+ * @var uint8_t localZoneMinutes
+ * @brief Local zone minutes, 00 to 59, same sign as the local hours.
+ *
+ * @var uint8_t checksum
+ * @brief An 8-bit checksum for error detection is computed by XOR'ing the data
+ * bits of each character in the sentence, excluding "$" and "*", without
+ * including start or stop bits.
+ */
+typedef struct SENTENCE_ZDA
+{
+  AddressField addressField;
+  uint32_t presentFields;
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_UTC_TIME_PRESENT)
+  float utcTime;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_DAY_PRESENT)
+  uint8_t day;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_MONTH_PRESENT)
+  uint8_t month;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_YEAR_PRESENT)
+  uint16_t year;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_HOURS_PRESENT)
+  float localZoneHours;
+#endif
+#if !CFG_OMIT_MASKED_FIELDS || (CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_MINUTES_PRESENT)
+  uint8_t localZoneMinutes;
+#endif
+  uint8_t checksum;
+} SENTENCE_ZDA;
+#endif // CFG_SENTENCE_ZDA_ENABLED
+
+/**
+ * @brief Any decoded sentence.
+ *
+ * Every SENTENCE_* structure begins with its AddressField, so
+ * addressField.sentenceId identifies the valid member of the union.
+ */
+typedef union NmeaSentence
+{
+  AddressField addressField; /**< Common initial member of every sentence */
+#if CFG_SENTENCE_AAM_ENABLED
+  SENTENCE_AAM aam;
+#endif
+#if CFG_SENTENCE_ABK_ENABLED
+  SENTENCE_ABK abk;
+#endif
+#if CFG_SENTENCE_ABM_ENABLED
+  SENTENCE_ABM abm;
+#endif
+#if CFG_SENTENCE_ACA_ENABLED
+  SENTENCE_ACA aca;
+#endif
+#if CFG_SENTENCE_ACK_ENABLED
+  SENTENCE_ACK ack;
+#endif
+#if CFG_SENTENCE_ACN_ENABLED
+  SENTENCE_ACN acn;
+#endif
+#if CFG_SENTENCE_ACS_ENABLED
+  SENTENCE_ACS acs;
+#endif
+#if CFG_SENTENCE_AIR_ENABLED
+  SENTENCE_AIR air;
+#endif
+#if CFG_SENTENCE_AKD_ENABLED
+  SENTENCE_AKD akd;
+#endif
+#if CFG_SENTENCE_ALA_ENABLED
+  SENTENCE_ALA ala;
+#endif
+#if CFG_SENTENCE_ALC_ENABLED
+  SENTENCE_ALC alc;
+#endif
+#if CFG_SENTENCE_ALF_ENABLED
+  SENTENCE_ALF alf;
+#endif
+#if CFG_SENTENCE_ALR_ENABLED
+  SENTENCE_ALR alr;
+#endif
+#if CFG_SENTENCE_APB_ENABLED
+  SENTENCE_APB apb;
+#endif
+#if CFG_SENTENCE_ARC_ENABLED
+  SENTENCE_ARC arc;
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+  SENTENCE_BOD bod;
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  SENTENCE_BWC bwc;
+#endif
+#if CFG_SENTENCE_DTM_ENABLED
+  SENTENCE_DTM dtm;
+#endif
+#if CFG_SENTENCE_GGA_ENABLED
+  SENTENCE_GGA gga;
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  SENTENCE_GSA gsa;
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  SENTENCE_GST gst;
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  SENTENCE_GSV gsv;
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+  SENTENCE_HDT hdt;
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  SENTENCE_RMB rmb;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  SENTENCE_RMC rmc;
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  SENTENCE_VTG vtg;
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+  SENTENCE_XTE xte;
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  SENTENCE_ZDA zda;
+#endif
+} NmeaSentence;
+
+/**
+ * @brief Decodes the data fields of the sentence selected by
+ * sentence->addressField.sentenceId.
+ *
+ * @param cursor   Data fields following the address field.
+ * @param checksum Verified checksum of the sentence.
+ * @param sentence Receives the decoded fields; addressField must be set.
+ * @return NMEA_OK, NMEA_ERROR_UNSUPPORTED or NMEA_ERROR_FIELD.
+ */
+NmeaStatus nmeaDecodeFields(NmeaCursor *cursor, uint8_t checksum, NmeaSentence *sentence);
+
+/**
+ * @brief Encodes the data fields, each preceded by its ',' delimiter.
+ * @return NMEA_OK, or NMEA_ERROR_UNSUPPORTED for a disabled sentence.
+ */
+NmeaStatus nmeaEncodeFields(const NmeaSentence *sentence, NmeaWriter *writer);
+
+/**
+ * @brief Returns the start delimiter ('$' or '!') of a sentence, or '\0' if
+ * the sentence is unknown or disabled.
+ */
+char nmeaSentenceDelimiter(SentenceID sentenceId);
+/* END GENERATED: sentence structures */
+
 #endif // Header guard
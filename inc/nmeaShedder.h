@@ -0,0 +1,149 @@
+#ifndef INC_NMEA_SHEDDER_H_
+#define INC_NMEA_SHEDDER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+
+/**
+ * @brief Priority classes, most important first.
+ */
+typedef enum NmeaPriority
+{
+  NMEA_PRIORITY_CRITICAL, /**< Alerts and heading, never shed */
+  NMEA_PRIORITY_HIGH,     /**< Position and navigation */
+  NMEA_PRIORITY_NORMAL,   /**< Everything without a rule */
+  NMEA_PRIORITY_LOW,      /**< AIS traffic, satellite details, text */
+  NMEA_PRIORITY_COUNT
+} NmeaPriority;
+
+/**
+ * @brief Reads a free running clock for the drain budget, in any unit (e.g.
+ * CPU cycles or microseconds); wrap-around is handled.
+ */
+typedef uint32_t (*NmeaShedderClock)(void);
+
+/**
+ * @brief Counters per priority class.
+ *
+ * queued, shed and overflowed are written by the framing side, delivered and
+ * rejected by the draining side.
+ */
+typedef struct NmeaShedderStatistics
+{
+  uint32_t queued[NMEA_PRIORITY_COUNT];     /**< Sentences framed and queued for decoding */
+  uint32_t shed[NMEA_PRIORITY_COUNT];       /**< Sentences dropped by the shedding policy, before decode */
+  uint32_t overflowed[NMEA_PRIORITY_COUNT]; /**< Sentences dropped because their queue was full */
+  uint32_t delivered[NMEA_PRIORITY_COUNT];  /**< Sentences decoded and delivered to the callback */
+  uint32_t rejected;                        /**< Queued sentences that failed to decode */
+  uint32_t budgetOverruns;                  /**< Drains that ran out of budget with sentences left */
+} NmeaShedderStatistics;
+
+/**
+ * @brief A framed, checksum-verified sentence waiting to be decoded.
+ */
+typedef struct NmeaShedderFrame
+{
+  uint8_t length;                          /**< Characters in text */
+  uint8_t checksum;                        /**< Verified checksum */
+  char text[NMEA_MAX_SENTENCE_LENGTH - 5]; /**< Sentence from the start delimiter up to, excluding, '*' */
+} NmeaShedderFrame;
+
+/**
+ * @brief Single producer, single consumer queue of one priority class.
+ */
+typedef struct NmeaShedderQueue
+{
+  uint32_t head;                                      /**< Frames queued so far, written by the framing side */
+  uint32_t tail;                                      /**< Frames decoded so far, written by the draining side */
+  NmeaShedderFrame frames[NMEA_SHEDDER_QUEUE_LENGTH]; /**< Ring of frames */
+} NmeaShedderQueue;
+
+/**
+ * @brief Priority of one sentence ID.
+ */
+typedef struct NmeaShedderRule
+{
+  SentenceID sentenceId; /**< Sentence the rule applies to */
+  uint8_t priority;      /**< NmeaPriority of the sentence */
+} NmeaShedderRule;
+
+/**
+ * @brief Overload protection between framing and decoding.
+ *
+ * The framing side (typically the UART interrupt) feeds bytes with
+ * nmeaShedderFeed(). Every checksum-verified sentence is classified by its
+ * sentence ID and queued, undecoded, in the queue of its class. The draining
+ * side (the main loop) calls nmeaShedderDrain(), which decodes the queued
+ * sentences highest class first within a time budget.
+ *
+ * When the load is more than the draining side can decode, the lower classes
+ * are shed at framing, before any decoding work is spent on them:
+ *
+ * - a class is shed while the sentences queued in all classes reach its
+ *   shedDepth;
+ * - NMEA_SHEDDER_OVERRUN_DRAINS drains in a row that run out of budget with
+ *   sentences of admitted classes left shed one more class, from the lowest
+ *   up, and every drain that empties the queues within its budget takes one
+ *   class back.
+ *
+ * Critical sentences are never shed; they are only lost if their own queue
+ * overflows, which is counted separately.
+ */
+typedef struct NmeaShedder
+{
+  NmeaSentenceCallback callback;                 /**< Receives each decoded sentence */
+  void *context;                                 /**< User pointer passed to the callback */
+  NmeaShedderClock clock;                        /**< Budget clock, NULL to budget in sentences */
+  uint16_t shedDepth[NMEA_PRIORITY_COUNT];       /**< Queued sentences at which a class is shed, 0 never */
+  uint8_t level;                                 /**< Classes from this one down are shed, internal */
+  uint8_t overruns;                              /**< Consecutive drains out of budget, internal */
+  uint8_t ruleCount;                             /**< Entries in rules */
+  NmeaShedderRule rules[NMEA_SHEDDER_MAX_RULES]; /**< Sentence IDs with a priority other than normal */
+  NmeaShedderStatistics statistics;              /**< Queued, shed and delivered sentences */
+  NmeaParser framer;                             /**< Framing parser, also holds the decoded sentence, internal */
+  NmeaShedderQueue queues[NMEA_PRIORITY_COUNT];  /**< One queue per class, internal */
+} NmeaShedder;
+
+/**
+ * @brief Initialises a shedder with the priority classes of nmeaConfig.h.
+ *
+ * The shed depths default to a quarter of the total queue capacity for low,
+ * half for normal and three quarters for high sentences.
+ *
+ * @param clock Clock the drain budget is measured with, or NULL to give the
+ *              budget as a number of sentences.
+ */
+void nmeaShedderInit(NmeaShedder *shedder, NmeaSentenceCallback callback, void *context, NmeaShedderClock clock);
+
+/**
+ * @brief Sets the priority class of a sentence ID.
+ *
+ * @return false if NMEA_SHEDDER_MAX_RULES sentence IDs have a rule already.
+ */
+bool nmeaShedderSetPriority(NmeaShedder *shedder, SentenceID sentenceId, NmeaPriority priority);
+
+/**
+ * @brief Priority class of a sentence ID.
+ */
+NmeaPriority nmeaShedderPriority(const NmeaShedder *shedder, SentenceID sentenceId);
+
+/**
+ * @brief Framing side: feeds received characters, queueing or shedding each
+ * complete sentence.
+ */
+void nmeaShedderFeed(NmeaShedder *shedder, const uint8_t *data, size_t length);
+
+/**
+ * @brief Draining side: decodes queued sentences, highest class first, and
+ * delivers them to the callback until the queues are empty or the budget is
+ * spent.
+ *
+ * @param budget Clock ticks the call may take, or sentences if the shedder
+ *               has no clock. At least one sentence is decoded per call.
+ * @return The number of sentences still queued.
+ */
+uint32_t nmeaShedderDrain(NmeaShedder *shedder, uint32_t budget);
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef INC_NMEA_SNAPSHOT_H_
+#define INC_NMEA_SNAPSHOT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "nmeaArrival.h"
+#include "nmeaDatum.h"
+#include "nmeaNavState.h"
+#include "nmeaNavigator.h"
+#include "nmeaPositionHistory.h"
+
+#define NMEA_SNAPSHOT_MAGIC 0x4E534E50u /* "NSNP" */
+#define NMEA_SNAPSHOT_VERSION 1         /* Bump when the meaning of a section changes without its size */
+
+/**
+ * @brief Sections of a snapshot, bits of NmeaSnapshotHeader.sections.
+ */
+typedef enum NmeaSnapshotSection
+{
+  NMEA_SNAPSHOT_NAV_STATE = 1 << 0, /**< Latest position, motion and heading */
+  NMEA_SNAPSHOT_HISTORY = 1 << 1,   /**< Position history */
+  NMEA_SNAPSHOT_NAVIGATOR = 1 << 2, /**< Active leg and last leg status */
+  NMEA_SNAPSHOT_ARRIVAL = 1 << 3,   /**< Watched waypoints and their arrival state */
+  NMEA_SNAPSHOT_DATUM = 1 << 4      /**< Datum definitions and the active datum */
+} NmeaSnapshotSection;
+
+/**
+ * @brief Header of a snapshot image.
+ */
+typedef struct NmeaSnapshotHeader
+{
+  uint32_t magic;    /**< NMEA_SNAPSHOT_MAGIC */
+  uint16_t version;  /**< NMEA_SNAPSHOT_VERSION */
+  uint16_t sections; /**< NmeaSnapshotSection bits of the sections taken */
+  uint32_t size;     /**< sizeof(NmeaSnapshot) */
+  uint32_t layout;   /**< Hash of the section sizes, changes with the configuration */
+  uint32_t sequence; /**< Caller's sequence number, e.g. to pick the newer of two flash slots */
+  uint32_t crc;      /**< CRC-32 of everything after the header */
+} NmeaSnapshotHeader;
+
+/**
+ * @brief Warm-start image of the state derived from the sentences received
+ * so far, one fixed-size block that can be written to flash or a file and
+ * copied back as it is.
+ *
+ * Only state that takes a while to rebuild is kept. Sentence reassembly is
+ * not: a parser or epoch grouper in the middle of a sentence or an epoch
+ * starts over after a restart anyway. Callbacks, their contexts and encoding
+ * scratch are not kept either; they are the live objects'.
+ *
+ * The image is only valid for the build that wrote it: the layout hash and
+ * the CRC reject images from a different configuration or a torn write.
+ */
+typedef struct NmeaSnapshot
+{
+  NmeaSnapshotHeader header;   /**< Identification and integrity */
+  NmeaNavSnapshot navState;    /**< NMEA_SNAPSHOT_NAV_STATE */
+  NmeaPositionHistory history; /**< NMEA_SNAPSHOT_HISTORY */
+  /** NMEA_SNAPSHOT_NAVIGATOR, the navigator up to its scratch */
+  uint8_t navigator[offsetof(NmeaNavigator, sentence)];
+  /** NMEA_SNAPSHOT_ARRIVAL, the detector from after its callback up to its scratch */
+  uint8_t arrival[offsetof(NmeaArrivalDetector, candidates) - offsetof(NmeaArrivalDetector, talkerId)];
+  /** NMEA_SNAPSHOT_DATUM, the stage from after its callback up to its scratch */
+  uint8_t datum[offsetof(NmeaDatumStage, sentence) - offsetof(NmeaDatumStage, transformed)];
+} NmeaSnapshot;
+
+/**
+ * @brief The objects a snapshot is taken from and restored to; a NULL
+ * pointer leaves the section out.
+ */
+typedef struct NmeaSnapshotSources
+{
+  NmeaNavState *navState;       /**< Navigation state */
+  NmeaPositionHistory *history; /**< Position history */
+  NmeaNavigator *navigator;     /**< Route navigator */
+  NmeaArrivalDetector *arrival; /**< Arrival detector */
+  NmeaDatumStage *datum;        /**< Datum stage */
+} NmeaSnapshotSources;
+
+/**
+ * @brief Copies the state of the sources into a snapshot image.
+ *
+ * Call it from the context that updates the sources, e.g. the main loop
+ * between sentences, then write the image out at leisure.
+ *
+ * @param sequence Stored in the header for the caller.
+ */
+void nmeaSnapshotTake(NmeaSnapshot *snapshot, const NmeaSnapshotSources *sources, uint32_t sequence);
+
+/**
+ * @brief Restores the sections of a snapshot image that are present in both
+ * the image and the sources, keeping the sources' callbacks and contexts.
+ *
+ * Initialise the sources first; sections missing from the image keep their
+ * initial state. Restored position history fixes keep their timeMs, so they
+ * need a clock that continues across restarts (e.g. UTC) to be of use.
+ *
+ * @return The NmeaSnapshotSection bits restored, 0 if the image is not valid
+ *         for this build (magic, version, size, layout or CRC mismatch).
+ */
+uint16_t nmeaSnapshotRestore(const NmeaSnapshot *snapshot, const NmeaSnapshotSources *sources);
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* sendmmsg() */
+#endif
+#include "nmeaOutput.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t nowNs(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static bool wouldBlock(void)
+{
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+void nmeaOutputInit(NmeaOutputWriter *writer, int fd, NmeaOutputKind kind, size_t flushBytes, uint16_t flushCount,
+                    uint32_t maxDelayUs)
+{
+  writer->fd = fd;
+  writer->kind = kind;
+  writer->flushBytes = flushBytes < NMEA_OUTPUT_BUFFER_SIZE ? flushBytes : NMEA_OUTPUT_BUFFER_SIZE;
+  writer->flushCount = flushCount < 1u ? 1u : flushCount < NMEA_OUTPUT_MAX_SENTENCES ? flushCount
+                                                                                      : NMEA_OUTPUT_MAX_SENTENCES;
+  writer->maxDelayUs = maxDelayUs;
+  memset(&writer->statistics, 0, sizeof(writer->statistics));
+  writer->oldestNs = 0;
+  writer->first = 0;
+  writer->count = 0;
+  writer->used = 0;
+}
+
+/* Bytes added but not yet written */
+static size_t pendingBytes(const NmeaOutputWriter *writer)
+{
+  if (writer->first == writer->count)
+  {
+    return 0;
+  }
+  return writer->used - (size_t)((const char *)writer->iov[writer->first].iov_base - writer->buffer);
+}
+
+static bool flushStream(NmeaOutputWriter *writer)
+{
+  while (writer->first < writer->count)
+  {
+    ssize_t written = writev(writer->fd, &writer->iov[writer->first], writer->count - writer->first);
+
+    writer->statistics.syscalls++;
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return wouldBlock();
+    }
+    writer->statistics.bytes += (uint64_t)written;
+    /* Complete entries are done, a partly written one is cut */
+    while (written > 0)
+    {
+      struct iovec *entry = &writer->iov[writer->first];
+
+      if ((size_t)written >= entry->iov_len)
+      {
+        written -= (ssize_t)entry->iov_len;
+        writer->first++;
+        writer->statistics.sentences++;
+      }
+      else
+      {
+        entry->iov_base = (char *)entry->iov_base + written;
+        entry->iov_len -= (size_t)written;
+        written = 0;
+      }
+    }
+  }
+  return true;
+}
+
+static bool flushDatagrams(NmeaOutputWriter *writer)
+{
+  struct mmsghdr messages[NMEA_OUTPUT_MAX_SENTENCES];
+
+  while (writer->first < writer->count)
+  {
+    unsigned int count = (unsigned int)(writer->count - writer->first);
+    unsigned int i;
+    int sent;
+
+    memset(messages, 0, count * sizeof(messages[0]));
+    for (i = 0; i < count; i++)
+    {
+      messages[i].msg_hdr.msg_iov = &writer->iov[writer->first + i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    sent = sendmmsg(writer->fd, messages, count, 0);
+    writer->statistics.syscalls++;
+    if (sent < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return wouldBlock();
+    }
+    for (i = 0; i < (unsigned int)sent; i++)
+    {
+      writer->statistics.bytes += writer->iov[writer->first + i].iov_len;
+    }
+    writer->statistics.sentences += (uint32_t)sent;
+    writer->first += (uint16_t)sent;
+  }
+  return true;
+}
+
+bool nmeaOutputFlush(NmeaOutputWriter *writer)
+{
+  bool ok = writer->kind == NMEA_OUTPUT_DATAGRAM ? flushDatagrams(writer) : flushStream(writer);
+
+  if (writer->first == writer->count)
+  {
+    writer->first = 0;
+    writer->count = 0;
+    writer->used = 0;
+  }
+  return ok;
+}
+
+/* Moves what a blocked descriptor left pending to the start of the buffer */
+static void compact(NmeaOutputWriter *writer)
+{
+  char *start;
+  size_t bytes;
+  uint16_t i;
+
+  if (writer->first == 0)
+  {
+    return;
+  }
+  start = (char *)writer->iov[writer->first].iov_base;
+  bytes = pendingBytes(writer);
+  memmove(writer->buffer, start, bytes);
+  for (i = writer->first; i < writer->count; i++)
+  {
+    writer->iov[i - writer->first].iov_base = writer->buffer + ((char *)writer->iov[i].iov_base - start);
+    writer->iov[i - writer->first].iov_len = writer->iov[i].iov_len;
+  }
+  writer->count = (uint16_t)(writer->count - writer->first);
+  writer->first = 0;
+  writer->used = bytes;
+}
+
+/* Room for a sentence of up to length bytes, flushing the batch first if it
+ * is full; NULL if the sentence has to be dropped or the flush failed */
+static char *reserve(NmeaOutputWriter *writer, size_t length)
+{
+  if (writer->count == NMEA_OUTPUT_MAX_SENTENCES || writer->used + length > NMEA_OUTPUT_BUFFER_SIZE)
+  {
+    if (!nmeaOutputFlush(writer))
+    {
+      writer->statistics.dropped++;
+      return NULL;
+    }
+    compact(writer);
+    if (writer->count == NMEA_OUTPUT_MAX_SENTENCES || writer->used + length > NMEA_OUTPUT_BUFFER_SIZE)
+    {
+      writer->statistics.dropped++;
+      errno = ENOBUFS;
+      return NULL;
+    }
+  }
+  return &writer->buffer[writer->used];
+}
+
+/* Appends the sentence written at the reserved position, flushing if the
+ * batch is due */
+static bool commit(NmeaOutputWriter *writer, char *text, size_t length)
+{
+  if (writer->first == writer->count)
+  {
+    writer->oldestNs = nowNs();
+  }
+  writer->iov[writer->count].iov_base = text;
+  writer->iov[writer->count].iov_len = length;
+  writer->count++;
+  writer->used += length;
+  if (pendingBytes(writer) >= writer->flushBytes ||
+      (uint16_t)(writer->count - writer->first) >= writer->flushCount ||
+      nowNs() - writer->oldestNs >= (uint64_t)writer->maxDelayUs * 1000u)
+  {
+    return nmeaOutputFlush(writer);
+  }
+  return true;
+}
+
+bool nmeaOutputEncode(NmeaOutputWriter *writer, const NmeaSentence *sentence)
+{
+  char *text = reserve(writer, NMEA_MAX_SENTENCE_LENGTH);
+  size_t length;
+
+  if (text == NULL)
+  {
+    return false;
+  }
+  if (nmeaEncode(sentence, text, NMEA_OUTPUT_BUFFER_SIZE - writer->used, &length) != NMEA_OK)
+  {
+    errno = EINVAL;
+    return false;
+  }
+  return commit(writer, text, length);
+}
+
+bool nmeaOutputWrite(NmeaOutputWriter *writer, const char *text, size_t length)
+{
+  char *copy = reserve(writer, length);
+
+  if (copy == NULL)
+  {
+    return false;
+  }
+  memcpy(copy, text, length);
+  return commit(writer, copy, length);
+}
+
+int nmeaOutputTimeoutMs(const NmeaOutputWriter *writer)
+{
+  uint64_t deadline = writer->oldestNs + (uint64_t)writer->maxDelayUs * 1000u;
+  uint64_t now = nowNs();
+
+  if (writer->first == writer->count)
+  {
+    return -1;
+  }
+  return now >= deadline ? 0 : (int)((deadline - now + 999999u) / 1000000u);
+}
+
+bool nmeaOutputService(NmeaOutputWriter *writer)
+{
+  if (writer->first == writer->count || nowNs() - writer->oldestNs < (uint64_t)writer->maxDelayUs * 1000u)
+  {
+    return true;
+  }
+  return nmeaOutputFlush(writer);
+}
+
+void nmeaOutputCallback(const NmeaSentence *sentence, void *context)
+{
+  (void)nmeaOutputEncode((NmeaOutputWriter *)context, sentence);
+}
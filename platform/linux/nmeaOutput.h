@@ -0,0 +1,116 @@
+#ifndef PLATFORM_LINUX_NMEA_OUTPUT_H_
+#define PLATFORM_LINUX_NMEA_OUTPUT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+
+/**
+ * @brief How the sentences of a batch are handed to the kernel.
+ */
+typedef enum NmeaOutputKind
+{
+  NMEA_OUTPUT_STREAM,  /**< Serial port, file, pipe or TCP: one writev() per batch */
+  NMEA_OUTPUT_DATAGRAM /**< Connected UDP socket: one datagram per sentence, one sendmmsg() per batch */
+} NmeaOutputKind;
+
+typedef struct NmeaOutputStatistics
+{
+  uint32_t sentences; /**< Sentences handed to the kernel */
+  uint64_t bytes;     /**< Bytes handed to the kernel */
+  uint32_t syscalls;  /**< writev() and sendmmsg() calls */
+  uint32_t dropped;   /**< Sentences discarded because the buffer was full or a flush failed */
+} NmeaOutputStatistics;
+
+/**
+ * @brief Coalescing output writer (Linux).
+ *
+ * Collects encoded sentences and writes them with one system call per batch
+ * instead of one per sentence. A batch is flushed when it holds flushBytes
+ * bytes or flushCount sentences, or when its oldest sentence has waited
+ * maxDelayUs, which bounds the latency added. The deadline is checked
+ * whenever a sentence is added; an event loop that may go quiet calls
+ * nmeaOutputService() with nmeaOutputTimeoutMs() as its poll timeout.
+ *
+ * On a non-blocking descriptor that cannot take more, the rest of the batch
+ * stays buffered and is retried with the next flush; once the buffer is full
+ * new sentences are dropped and counted.
+ */
+typedef struct NmeaOutputWriter
+{
+  int fd;                                      /**< Output file descriptor */
+  NmeaOutputKind kind;                         /**< Stream or datagram */
+  size_t flushBytes;                           /**< Batch size in bytes that triggers a flush */
+  uint16_t flushCount;                         /**< Batch size in sentences that triggers a flush */
+  uint32_t maxDelayUs;                         /**< Longest a sentence waits for its batch */
+  NmeaOutputStatistics statistics;             /**< Counters since initialisation */
+  uint64_t oldestNs;                           /**< When the oldest pending sentence was added, internal */
+  uint16_t first;                              /**< First pending entry of iov, internal */
+  uint16_t count;                              /**< Entries used in iov, internal */
+  size_t used;                                 /**< Bytes used in buffer, internal */
+  struct iovec iov[NMEA_OUTPUT_MAX_SENTENCES]; /**< One entry per sentence, internal */
+  char buffer[NMEA_OUTPUT_BUFFER_SIZE];        /**< Encoded sentences, internal */
+} NmeaOutputWriter;
+
+/**
+ * @brief Initialises a writer. The writer does not take ownership of @p fd.
+ *
+ * For NMEA_OUTPUT_DATAGRAM, @p fd must be a UDP socket connect()ed to the
+ * destination: the datagrams are sent without an address, which fails with
+ * EDESTADDRREQ on an unconnected socket.
+ *
+ * @param flushBytes Flush at this many bytes, at most NMEA_OUTPUT_BUFFER_SIZE.
+ * @param flushCount Flush at this many sentences, at most
+ *                   NMEA_OUTPUT_MAX_SENTENCES; 1 writes every sentence at once.
+ * @param maxDelayUs Flush when the oldest sentence has waited this long.
+ */
+void nmeaOutputInit(NmeaOutputWriter *writer, int fd, NmeaOutputKind kind, size_t flushBytes, uint16_t flushCount,
+                    uint32_t maxDelayUs);
+
+/**
+ * @brief Encodes a sentence straight into the batch.
+ *
+ * @return false if the sentence cannot be encoded, if it was dropped or if
+ *         a flush it triggered failed (errno set).
+ */
+bool nmeaOutputEncode(NmeaOutputWriter *writer, const NmeaSentence *sentence);
+
+/**
+ * @brief Adds an already encoded sentence, e.g. one being forwarded.
+ *
+ * @param text Complete sentence including checksum and CR/LF, copied.
+ * @return false if the sentence was dropped or a flush failed (errno set).
+ */
+bool nmeaOutputWrite(NmeaOutputWriter *writer, const char *text, size_t length);
+
+/**
+ * @brief Writes the pending sentences now.
+ *
+ * @return false on a write error (errno set). A descriptor that would block
+ *         is not an error; what it did not take stays pending.
+ */
+bool nmeaOutputFlush(NmeaOutputWriter *writer);
+
+/**
+ * @brief Milliseconds until the pending batch is due, rounded up, or -1 if
+ * nothing is pending: the timeout for the poll() of an event loop.
+ */
+int nmeaOutputTimeoutMs(const NmeaOutputWriter *writer);
+
+/**
+ * @brief Flushes the pending batch if its deadline has passed.
+ *
+ * @return false on a write error (errno set).
+ */
+bool nmeaOutputService(NmeaOutputWriter *writer);
+
+/**
+ * @brief NmeaSentenceCallback adapter: pass the writer as the parser context
+ * to re-encode and forward every sentence the parser delivers.
+ */
+void nmeaOutputCallback(const NmeaSentence *sentence, void *context);
+
+#endif
@@ -0,0 +1,179 @@
+#define _DEFAULT_SOURCE /* Baud rates above 38400, TIOCGSERIAL */
+#include "nmeaSerial.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/serial.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define MAX_EVENTS NMEA_SERIAL_MAX_PORTS
+
+/* termios constant of a baud rate, B0 if unsupported */
+static speed_t baudConstant(uint32_t baud)
+{
+  switch (baud)
+  {
+  case 4800:
+    return B4800;
+  case 9600:
+    return B9600;
+  case 19200:
+    return B19200;
+  case 38400:
+    return B38400;
+  case 57600:
+    return B57600;
+  case 115200:
+    return B115200;
+  case 230400:
+    return B230400;
+  case 460800:
+    return B460800;
+  default:
+    return B0;
+  }
+}
+
+/* Best effort: only UARTs driven by the serial core support it */
+static void requestLowLatency(int fd)
+{
+  struct serial_struct serial;
+
+  if (ioctl(fd, TIOCGSERIAL, &serial) == 0)
+  {
+    serial.flags |= ASYNC_LOW_LATENCY;
+    (void)ioctl(fd, TIOCSSERIAL, &serial);
+  }
+}
+
+bool nmeaSerialConfigure(int fd, uint32_t baud)
+{
+  speed_t speed = baudConstant(baud);
+  struct termios attributes;
+
+  if (speed == B0 || tcgetattr(fd, &attributes) != 0)
+  {
+    return false;
+  }
+  attributes.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF);
+  attributes.c_oflag &= ~(tcflag_t)OPOST;
+  attributes.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+  attributes.c_cflag &= ~(tcflag_t)(CSIZE | PARENB | CSTOPB | CRTSCTS);
+  attributes.c_cflag |= CS8 | CREAD | CLOCAL;
+  attributes.c_cc[VMIN] = 1;
+  attributes.c_cc[VTIME] = 0;
+  if (cfsetispeed(&attributes, speed) != 0 || cfsetospeed(&attributes, speed) != 0 ||
+      tcsetattr(fd, TCSANOW, &attributes) != 0)
+  {
+    return false;
+  }
+  requestLowLatency(fd);
+  return true;
+}
+
+int nmeaSerialOpen(const char *path, uint32_t baud)
+{
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+
+  if (fd < 0)
+  {
+    return -1;
+  }
+  if (!nmeaSerialConfigure(fd, baud))
+  {
+    int error = errno != 0 ? errno : EINVAL;
+
+    close(fd);
+    errno = error;
+    return -1;
+  }
+  return fd;
+}
+
+bool nmeaSerialReaderInit(NmeaSerialReader *reader)
+{
+  reader->portCount = 0;
+  reader->epollFd = epoll_create1(EPOLL_CLOEXEC);
+  return reader->epollFd >= 0;
+}
+
+int nmeaSerialReaderAdd(NmeaSerialReader *reader, int fd, NmeaSentenceCallback callback, void *context)
+{
+  NmeaSerialPort *port;
+  struct epoll_event event;
+
+  if (reader->portCount >= NMEA_SERIAL_MAX_PORTS)
+  {
+    return -1;
+  }
+  /* Level triggered: a port with more than one read pending is simply
+   * reported again by the next epoll_wait() */
+  event.events = EPOLLIN;
+  event.data.u32 = reader->portCount;
+  if (epoll_ctl(reader->epollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+  {
+    return -1;
+  }
+  port = &reader->ports[reader->portCount];
+  port->fd = fd;
+  port->removed = false;
+  port->bytes = 0;
+  port->reads = 0;
+  nmeaParserInit(&port->parser, callback, context);
+  return reader->portCount++;
+}
+
+/* Stops watching a port that hung up or failed */
+static void removePort(NmeaSerialReader *reader, NmeaSerialPort *port)
+{
+  (void)epoll_ctl(reader->epollFd, EPOLL_CTL_DEL, port->fd, NULL);
+  port->removed = true;
+}
+
+int32_t nmeaSerialReaderPoll(NmeaSerialReader *reader, int timeoutMs)
+{
+  struct epoll_event events[MAX_EVENTS];
+  int32_t total = 0;
+  int count;
+  int i;
+
+  count = epoll_wait(reader->epollFd, events, MAX_EVENTS, timeoutMs);
+  if (count < 0)
+  {
+    return errno == EINTR ? 0 : -1;
+  }
+  for (i = 0; i < count; i++)
+  {
+    NmeaSerialPort *port = &reader->ports[events[i].data.u32];
+    ssize_t length;
+
+    if (port->removed)
+    {
+      continue;
+    }
+    /* Read before looking at EPOLLHUP, so data received before the
+     * hangup is not lost */
+    length = read(port->fd, reader->buffer, NMEA_SERIAL_READ_SIZE);
+    if (length > 0)
+    {
+      nmeaFeed(&port->parser, reader->buffer, (size_t)length);
+      port->bytes += (uint64_t)length;
+      port->reads++;
+      total += (int32_t)length;
+    }
+    else if (length == 0 || (errno != EAGAIN && errno != EINTR) || (events[i].events & (EPOLLHUP | EPOLLERR)))
+    {
+      removePort(reader, port);
+    }
+  }
+  return total;
+}
+
+void nmeaSerialReaderClose(NmeaSerialReader *reader)
+{
+  close(reader->epollFd);
+  reader->epollFd = -1;
+}
@@ -0,0 +1,95 @@
+#ifndef PLATFORM_LINUX_NMEA_SERIAL_H_
+#define PLATFORM_LINUX_NMEA_SERIAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+
+/**
+ * @brief One serial port of a reader, with its own parser.
+ */
+typedef struct NmeaSerialPort
+{
+  int fd;            /**< Port file descriptor, still open after a hangup */
+  bool removed;      /**< The port hung up or failed and is no longer read */
+  NmeaParser parser; /**< Parser fed from this port */
+  uint64_t bytes;    /**< Bytes read so far */
+  uint32_t reads;    /**< read() calls that returned data */
+} NmeaSerialPort;
+
+/**
+ * @brief Reads many serial ports from one thread (Linux).
+ *
+ * All ports are multiplexed with one epoll instance; every ready port is
+ * drained with a read() of up to NMEA_SERIAL_READ_SIZE bytes into its own
+ * parser, so a port busy with a burst does not hold up the others for more
+ * than one read.
+ */
+typedef struct NmeaSerialReader
+{
+  int epollFd;                                 /**< epoll instance */
+  uint8_t portCount;                           /**< Entries in ports */
+  NmeaSerialPort ports[NMEA_SERIAL_MAX_PORTS]; /**< Ports added so far */
+  uint8_t buffer[NMEA_SERIAL_READ_SIZE];       /**< Receive buffer shared by the ports, internal */
+} NmeaSerialReader;
+
+/**
+ * @brief Configures a serial port for low latency reception of NMEA data.
+ *
+ * Sets raw 8N1 mode at the given baud rate without flow control, VMIN 1 and
+ * VTIME 0: poll and epoll report the port ready with the first byte
+ * received, so the end of a sentence never waits for more input (with
+ * VMIN > 1 and VTIME 0 they would). Requests ASYNC_LOW_LATENCY from the
+ * driver where it supports it, so received bytes are passed on without the
+ * deferred flip buffer push; ports that do not (USB adapters, ptys) are
+ * configured without it.
+ *
+ * @param baud 4800, 9600, 19200, 38400, 57600, 115200, 230400 or 460800.
+ * @return false if the baud rate is not supported or termios fails.
+ */
+bool nmeaSerialConfigure(int fd, uint32_t baud);
+
+/**
+ * @brief Opens a serial device non-blocking and configures it with
+ * nmeaSerialConfigure().
+ *
+ * @return The file descriptor, or -1 with errno set.
+ */
+int nmeaSerialOpen(const char *path, uint32_t baud);
+
+/**
+ * @brief Initialises a reader without ports.
+ *
+ * @return false if no epoll instance could be created.
+ */
+bool nmeaSerialReaderInit(NmeaSerialReader *reader);
+
+/**
+ * @brief Adds a port, which should be non-blocking.
+ *
+ * The reader does not take ownership: close the port after
+ * nmeaSerialReaderClose().
+ *
+ * @param callback Receives the sentences of this port.
+ * @return The port index, or -1 if the reader is full or epoll fails.
+ */
+int nmeaSerialReaderAdd(NmeaSerialReader *reader, int fd, NmeaSentenceCallback callback, void *context);
+
+/**
+ * @brief Waits for data and feeds every ready port once.
+ *
+ * A port that hangs up or fails is removed from the reader and marked
+ * removed in its port entry; its fd is left open for the caller to close.
+ *
+ * @param timeoutMs Longest wait, -1 to wait indefinitely.
+ * @return Bytes fed in total (0 on timeout or signal), -1 if epoll fails.
+ */
+int32_t nmeaSerialReaderPoll(NmeaSerialReader *reader, int timeoutMs);
+
+/**
+ * @brief Releases the epoll instance. The ports stay open.
+ */
+void nmeaSerialReaderClose(NmeaSerialReader *reader);
+
+#endif
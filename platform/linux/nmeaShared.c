@@ -0,0 +1,280 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* memfd_create() */
+#endif
+#include "nmeaShared.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "nmeaShared.c needs the GCC/Clang __atomic builtins"
+#endif
+
+#if (NMEA_SHARED_SLOTS & (NMEA_SHARED_SLOTS - 1)) != 0
+#error "NMEA_SHARED_SLOTS must be a power of two"
+#endif
+
+/* The slots start on their own page, so readers can map them read-only */
+#define PAGE_SIZE_MIN 4096u
+#define SLOTS_OFFSET ((sizeof(NmeaSharedHeader) + PAGE_SIZE_MIN - 1u) & ~(size_t)(PAGE_SIZE_MIN - 1u))
+#define MAPPING_SIZE (SLOTS_OFFSET + NMEA_SHARED_SLOTS * sizeof(NmeaSharedSlot))
+
+static NmeaSharedSlot *slotAt(void *mapping)
+{
+  return (NmeaSharedSlot *)((char *)mapping + SLOTS_OFFSET);
+}
+
+bool nmeaSharedCreate(NmeaSharedPublisher *publisher, const char *name, mode_t mode)
+{
+  void *mapping;
+
+  publisher->header = NULL;
+  publisher->name[0] = '\0';
+  if (name == NULL)
+  {
+    publisher->fd = memfd_create("nmea", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  }
+  else
+  {
+    snprintf(publisher->name, sizeof(publisher->name), "%s", name);
+    /* A fresh object: readers of a previous publisher keep theirs */
+    (void)shm_unlink(name);
+    publisher->fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+  }
+  if (publisher->fd < 0)
+  {
+    return false;
+  }
+  /* The umask applied to shm_open() could take away the readers' write access */
+  if (name != NULL && fchmod(publisher->fd, mode) != 0)
+  {
+    nmeaSharedDestroy(publisher);
+    return false;
+  }
+  if (ftruncate(publisher->fd, (off_t)MAPPING_SIZE) != 0)
+  {
+    nmeaSharedDestroy(publisher);
+    return false;
+  }
+  if (name == NULL)
+  {
+    /* Nobody can shrink it under the readers' mappings */
+    (void)fcntl(publisher->fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+  }
+  mapping = mmap(NULL, MAPPING_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, publisher->fd, 0);
+  if (mapping == MAP_FAILED)
+  {
+    nmeaSharedDestroy(publisher);
+    return false;
+  }
+  publisher->header = (NmeaSharedHeader *)mapping;
+  publisher->slots = slotAt(mapping);
+  publisher->header->slotSize = sizeof(NmeaSharedSlot);
+  publisher->header->slotCount = NMEA_SHARED_SLOTS;
+  __atomic_store_n(&publisher->header->magic, NMEA_SHARED_MAGIC, __ATOMIC_RELEASE);
+  return true;
+}
+
+void nmeaSharedPublish(NmeaSharedPublisher *publisher, const NmeaSentence *sentence)
+{
+  NmeaSharedHeader *header = publisher->header;
+  uint64_t sequence = header->head;
+  NmeaSharedSlot *slot = &publisher->slots[sequence & (NMEA_SHARED_SLOTS - 1u)];
+
+  /* Odd stamp before the record is modified, even once it is complete */
+  __atomic_store_n(&slot->stamp, 2u * sequence + 1u, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(&slot->sentence, sentence, sizeof(slot->sentence));
+  __atomic_store_n(&slot->stamp, 2u * sequence + 2u, __ATOMIC_RELEASE);
+  __atomic_store_n(&header->head, sequence + 1u, __ATOMIC_RELEASE);
+  __atomic_store_n(&header->wake, (uint32_t)(sequence + 1u), __ATOMIC_RELEASE);
+
+  /* Pairs with nmeaSharedWait(): either the reader sees the new head or
+   * the publisher sees the reader waiting */
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&header->waiters, __ATOMIC_RELAXED) != 0)
+  {
+    (void)syscall(SYS_futex, &header->wake, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+  }
+}
+
+void nmeaSharedCallback(const NmeaSentence *sentence, void *context)
+{
+  nmeaSharedPublish((NmeaSharedPublisher *)context, sentence);
+}
+
+void nmeaSharedDestroy(NmeaSharedPublisher *publisher)
+{
+  if (publisher->header != NULL)
+  {
+    munmap(publisher->header, MAPPING_SIZE);
+    publisher->header = NULL;
+  }
+  if (publisher->fd >= 0)
+  {
+    close(publisher->fd);
+    publisher->fd = -1;
+  }
+  if (publisher->name[0] != '\0')
+  {
+    (void)shm_unlink(publisher->name);
+    publisher->name[0] = '\0';
+  }
+}
+
+bool nmeaSharedAttach(NmeaSharedReader *reader, int fd)
+{
+  struct stat status;
+  void *mapping;
+  NmeaSharedHeader *header;
+
+  if (fstat(fd, &status) != 0)
+  {
+    return false;
+  }
+  if ((size_t)status.st_size != MAPPING_SIZE)
+  {
+    errno = EPROTO;
+    return false;
+  }
+  mapping = mmap(NULL, MAPPING_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED)
+  {
+    return false;
+  }
+  if (mprotect(mapping, SLOTS_OFFSET, PROT_READ | PROT_WRITE) != 0)
+  {
+    int error = errno;
+
+    munmap(mapping, MAPPING_SIZE);
+    errno = error;
+    return false;
+  }
+  header = (NmeaSharedHeader *)mapping;
+  if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != NMEA_SHARED_MAGIC ||
+      header->slotSize != sizeof(NmeaSharedSlot) || header->slotCount != NMEA_SHARED_SLOTS)
+  {
+    munmap(mapping, MAPPING_SIZE);
+    errno = EPROTO;
+    return false;
+  }
+  reader->header = header;
+  reader->slots = slotAt(mapping);
+  reader->cursor = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+  reader->lost = 0;
+  return true;
+}
+
+bool nmeaSharedOpen(NmeaSharedReader *reader, const char *name)
+{
+  int fd = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+  bool attached;
+  int error;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+  attached = nmeaSharedAttach(reader, fd);
+  error = errno;
+  close(fd);
+  errno = error;
+  return attached;
+}
+
+const NmeaSentence *nmeaSharedPeek(NmeaSharedReader *reader)
+{
+  for (;;)
+  {
+    uint64_t head = __atomic_load_n(&reader->header->head, __ATOMIC_ACQUIRE);
+    const NmeaSharedSlot *slot;
+
+    if (reader->cursor >= head)
+    {
+      return NULL;
+    }
+    /* Records more than a ring behind have been overwritten */
+    if (head - reader->cursor > NMEA_SHARED_SLOTS)
+    {
+      reader->lost += head - NMEA_SHARED_SLOTS - reader->cursor;
+      reader->cursor = head - NMEA_SHARED_SLOTS;
+    }
+    slot = &reader->slots[reader->cursor & (NMEA_SHARED_SLOTS - 1u)];
+    if (__atomic_load_n(&slot->stamp, __ATOMIC_ACQUIRE) == 2u * reader->cursor + 2u)
+    {
+      return &slot->sentence;
+    }
+    /* Overwritten since head was read */
+    reader->lost++;
+    reader->cursor++;
+  }
+}
+
+bool nmeaSharedConsume(NmeaSharedReader *reader)
+{
+  const NmeaSharedSlot *slot = &reader->slots[reader->cursor & (NMEA_SHARED_SLOTS - 1u)];
+  bool intact;
+
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  intact = __atomic_load_n(&slot->stamp, __ATOMIC_RELAXED) == 2u * reader->cursor + 2u;
+  if (!intact)
+  {
+    reader->lost++;
+  }
+  reader->cursor++;
+  return intact;
+}
+
+bool nmeaSharedRead(NmeaSharedReader *reader, NmeaSentence *sentence)
+{
+  const NmeaSentence *record;
+
+  while ((record = nmeaSharedPeek(reader)) != NULL)
+  {
+    memcpy(sentence, record, sizeof(*sentence));
+    if (nmeaSharedConsume(reader))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool nmeaSharedWait(NmeaSharedReader *reader, int timeoutMs)
+{
+  NmeaSharedHeader *header = reader->header;
+  struct timespec timeout;
+  uint32_t wake;
+
+  if (__atomic_load_n(&header->head, __ATOMIC_ACQUIRE) > reader->cursor)
+  {
+    return true;
+  }
+  __atomic_fetch_add(&header->waiters, 1u, __ATOMIC_SEQ_CST);
+  wake = __atomic_load_n(&header->wake, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&header->head, __ATOMIC_SEQ_CST) <= reader->cursor)
+  {
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = (long)(timeoutMs % 1000) * 1000000L;
+    /* Returns at once if a record was published since wake was read */
+    (void)syscall(SYS_futex, &header->wake, FUTEX_WAIT, wake, timeoutMs < 0 ? NULL : &timeout, NULL, 0);
+  }
+  __atomic_fetch_sub(&header->waiters, 1u, __ATOMIC_SEQ_CST);
+  return __atomic_load_n(&header->head, __ATOMIC_ACQUIRE) > reader->cursor;
+}
+
+void nmeaSharedDetach(NmeaSharedReader *reader)
+{
+  munmap(reader->header, MAPPING_SIZE);
+  reader->header = NULL;
+  reader->slots = NULL;
+}
@@ -0,0 +1,155 @@
+#ifndef PLATFORM_LINUX_NMEA_SHARED_H_
+#define PLATFORM_LINUX_NMEA_SHARED_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "nmea0183.h"
+#include "nmeaConfig.h"
+
+#define NMEA_SHARED_MAGIC 0x4E4D4541u /* "NMEA" */
+
+/**
+ * @brief One published sentence in shared memory.
+ *
+ * stamp is 2n + 1 while record n is being written into the slot and 2n + 2
+ * once it is complete, so a reader can tell whether the slot holds the
+ * record it wants, an older one or a newer one.
+ */
+typedef struct NmeaSharedSlot
+{
+  uint64_t stamp;        /**< Sequence stamp, see above */
+  NmeaSentence sentence; /**< The record */
+} NmeaSharedSlot;
+
+/**
+ * @brief Start of the shared memory, followed by the slots on the next page.
+ *
+ * Readers map the header page writable, to register as waiters, and the
+ * slots read-only.
+ */
+typedef struct NmeaSharedHeader
+{
+  uint32_t magic;     /**< NMEA_SHARED_MAGIC */
+  uint32_t slotSize;  /**< sizeof(NmeaSharedSlot) of the publisher's build */
+  uint32_t slotCount; /**< NMEA_SHARED_SLOTS of the publisher's build */
+  uint32_t wake;      /**< Futex word, changes with every record */
+  uint64_t head;      /**< Records published so far */
+  uint32_t waiters;   /**< Readers sleeping in nmeaSharedWait() */
+} NmeaSharedHeader;
+
+/**
+ * @brief Publishing side of a shared-memory broadcast ring (Linux).
+ *
+ * The parser process publishes every decoded sentence once; any number of
+ * reader processes map the same memory and follow it with their own
+ * cursors, reading the records in place. There is no lock and no back
+ * pressure: the publisher never waits for readers, and a reader that falls
+ * more than NMEA_SHARED_SLOTS records behind loses the oldest ones and is
+ * told so. The publisher only makes a system call to wake readers when one
+ * is asleep.
+ */
+typedef struct NmeaSharedPublisher
+{
+  int fd;                   /**< Shared memory, pass it to readers (fork or SCM_RIGHTS) */
+  char name[64];            /**< POSIX shared memory name, empty for an anonymous memfd */
+  NmeaSharedHeader *header; /**< Mapping, internal */
+  NmeaSharedSlot *slots;    /**< Slots after the header, internal */
+} NmeaSharedPublisher;
+
+/**
+ * @brief Reading side: one cursor into a publisher's ring.
+ */
+typedef struct NmeaSharedReader
+{
+  NmeaSharedHeader *header;    /**< Mapping, internal */
+  const NmeaSharedSlot *slots; /**< Read-only slots after the header, internal */
+  uint64_t cursor;             /**< Sequence number of the next record to read */
+  uint64_t lost;               /**< Records overwritten before they were read */
+} NmeaSharedReader;
+
+/**
+ * @brief Creates the shared memory and maps it.
+ *
+ * @param name NULL for an anonymous memfd, shared by inheriting or passing
+ *             publisher->fd; otherwise a POSIX shared memory name such as
+ *             "/nmea" that unrelated readers open with nmeaSharedOpen().
+ * @param mode Permissions of a named ring, applied regardless of the umask.
+ *             Readers open it for reading and writing to register as
+ *             waiters, so readers under another uid need e.g. 0660 and the
+ *             publisher's group, or 0666. Ignored for a memfd.
+ * @return false with errno set if it could not be created.
+ */
+bool nmeaSharedCreate(NmeaSharedPublisher *publisher, const char *name, mode_t mode);
+
+/**
+ * @brief Copies a sentence into the ring and wakes waiting readers.
+ */
+void nmeaSharedPublish(NmeaSharedPublisher *publisher, const NmeaSentence *sentence);
+
+/**
+ * @brief NmeaSentenceCallback adapter: pass the publisher as the parser
+ * context to publish every sentence the parser delivers.
+ */
+void nmeaSharedCallback(const NmeaSentence *sentence, void *context);
+
+/**
+ * @brief Unmaps and closes the ring, removing its name if it has one.
+ *
+ * Readers that have it mapped keep their mapping.
+ */
+void nmeaSharedDestroy(NmeaSharedPublisher *publisher);
+
+/**
+ * @brief Maps a ring from a descriptor received from the publisher, which
+ * must be open for reading and writing. The reader starts at the newest
+ * record; @p fd may be closed afterwards.
+ *
+ * @return false with errno set if it cannot be mapped, EPROTO if it was
+ *         published by a build with a different layout.
+ */
+bool nmeaSharedAttach(NmeaSharedReader *reader, int fd);
+
+/**
+ * @brief Opens a named ring and attaches to it.
+ */
+bool nmeaSharedOpen(NmeaSharedReader *reader, const char *name);
+
+/**
+ * @brief Zero-copy read: the next record in place, NULL if there is none.
+ *
+ * The record stays in shared memory and may be overwritten by the publisher
+ * while it is used; call nmeaSharedConsume() afterwards to find out. If the
+ * reader fell behind, the lost records are counted and skipped.
+ */
+const NmeaSentence *nmeaSharedPeek(NmeaSharedReader *reader);
+
+/**
+ * @brief Moves past the record returned by nmeaSharedPeek().
+ *
+ * @return false if the record was overwritten while it was being used, in
+ *         which case whatever was read from it must be discarded.
+ */
+bool nmeaSharedConsume(NmeaSharedReader *reader);
+
+/**
+ * @brief Copies the next record out of the ring.
+ *
+ * @return false if there is no record; overwritten records are skipped.
+ */
+bool nmeaSharedRead(NmeaSharedReader *reader, NmeaSentence *sentence);
+
+/**
+ * @brief Sleeps until a record newer than the cursor is published.
+ *
+ * @param timeoutMs Longest wait, -1 to wait indefinitely.
+ * @return true if there is a record to read.
+ */
+bool nmeaSharedWait(NmeaSharedReader *reader, int timeoutMs);
+
+/**
+ * @brief Unmaps the ring.
+ */
+void nmeaSharedDetach(NmeaSharedReader *reader);
+
+#endif
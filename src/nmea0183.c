@@ -0,0 +1,291 @@
+#include "nmea0183.h"
+
+/* Characters from the start delimiter up to, but excluding, the '*' checksum
+ * delimiter; the remaining five characters are "*hh<CR><LF>". */
+#define MAX_BODY_LENGTH (NMEA_MAX_SENTENCE_LENGTH - 5)
+
+/* Length of the start delimiter plus the address field, e.g. "$GPAAM" */
+#define ADDRESS_LENGTH 6
+
+typedef enum ParserState
+{
+  STATE_IDLE,          /**< Waiting for a '$' or '!' start delimiter */
+  STATE_BODY,          /**< Collecting address and data fields */
+  STATE_CHECKSUM_HIGH, /**< Expecting the first checksum digit */
+  STATE_CHECKSUM_LOW   /**< Expecting the second checksum digit */
+} ParserState;
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+static int8_t hexValue(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return (int8_t)(c - '0');
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return (int8_t)(c - 'A' + 10);
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return (int8_t)(c - 'a' + 10);
+  }
+  return -1;
+}
+
+/**
+ * @brief Decodes the address and data fields of a checksum-verified sentence.
+ *
+ * @param data     Sentence from the start delimiter up to, excluding, '*'.
+ * @param length   Number of characters in @p data.
+ * @param checksum The verified checksum, stored in the decoded structure.
+ */
+static NmeaStatus decodeBody(const char *data, size_t length, uint8_t checksum, NmeaSentence *sentence)
+{
+  NmeaCursor cursor;
+
+  if (length < ADDRESS_LENGTH || (length > ADDRESS_LENGTH && data[ADDRESS_LENGTH] != ','))
+  {
+    return NMEA_ERROR_FRAMING;
+  }
+  if (data[1] == 'P')
+  {
+    /* Proprietary sentences carry a manufacturer code, not a talker ID */
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+
+  sentence->addressField.talkerId = (TalkerID)(((uint32_t)(uint8_t)data[1] << 8) | (uint8_t)data[2]);
+  sentence->addressField.sentenceId =
+      (SentenceID)(((uint32_t)(uint8_t)data[3] << 16) | ((uint32_t)(uint8_t)data[4] << 8) | (uint8_t)data[5]);
+
+  cursor.next = data + (length > ADDRESS_LENGTH ? ADDRESS_LENGTH + 1 : ADDRESS_LENGTH);
+  cursor.end = data + length;
+  return nmeaDecodeFields(&cursor, checksum, sentence);
+}
+
+uint8_t nmeaChecksum(const char *data, size_t length)
+{
+  uint8_t checksum = 0;
+
+  while (length-- > 0)
+  {
+    checksum ^= (uint8_t)*data++;
+  }
+  return checksum;
+}
+
+NmeaStatus nmeaDecode(const char *data, size_t length, NmeaSentence *sentence)
+{
+  size_t star;
+  int8_t high;
+  int8_t low;
+  uint8_t checksum;
+
+  while (length > 0 && (data[length - 1] == '\r' || data[length - 1] == '\n'))
+  {
+    length--;
+  }
+  if (length < ADDRESS_LENGTH || (data[0] != '$' && data[0] != '!'))
+  {
+    return NMEA_ERROR_FRAMING;
+  }
+  if (length > NMEA_MAX_SENTENCE_LENGTH - 2)
+  {
+    return NMEA_ERROR_FRAMING;
+  }
+
+  star = length - 3;
+  if (data[star] != '*')
+  {
+    return NMEA_ERROR_CHECKSUM;
+  }
+  high = hexValue(data[star + 1]);
+  low = hexValue(data[star + 2]);
+  checksum = nmeaChecksum(data + 1, star - 1);
+  if (high < 0 || low < 0 || (uint8_t)((high << 4) | low) != checksum)
+  {
+    return NMEA_ERROR_CHECKSUM;
+  }
+
+  return decodeBody(data, star, checksum, sentence);
+}
+
+NmeaStatus nmeaDecodeFrame(const char *frame, size_t length, uint8_t checksum, NmeaSentence *sentence)
+{
+  return decodeBody(frame, length, checksum, sentence);
+}
+
+NmeaStatus nmeaEncode(const NmeaSentence *sentence, char *buffer, size_t size, size_t *length)
+{
+  NmeaWriter writer;
+  uint32_t talkerId = (uint32_t)sentence->addressField.talkerId;
+  uint32_t sentenceId = (uint32_t)sentence->addressField.sentenceId;
+  char delimiter = nmeaSentenceDelimiter(sentence->addressField.sentenceId);
+  uint8_t checksum;
+
+  *length = 0;
+  if (delimiter == '\0')
+  {
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+  if (size == 0)
+  {
+    return NMEA_ERROR_BUFFER_SIZE;
+  }
+
+  /* The start delimiter is not part of the checksum */
+  buffer[0] = delimiter;
+  nmeaWriterInit(&writer, buffer + 1, size - 1);
+
+  if (talkerId > 0xFF)
+  {
+    nmeaPutChar(&writer, (char)(talkerId >> 8));
+  }
+  nmeaPutChar(&writer, (char)talkerId);
+  nmeaPutChar(&writer, (char)(sentenceId >> 16));
+  nmeaPutChar(&writer, (char)(sentenceId >> 8));
+  nmeaPutChar(&writer, (char)sentenceId);
+  nmeaEncodeFields(sentence, &writer);
+
+  checksum = writer.checksum;
+  nmeaPutChar(&writer, '*');
+  nmeaPutChar(&writer, HEX_DIGITS[checksum >> 4]);
+  nmeaPutChar(&writer, HEX_DIGITS[checksum & 0x0F]);
+  nmeaPutChar(&writer, '\r');
+  nmeaPutChar(&writer, '\n');
+
+  if (writer.overflow)
+  {
+    return NMEA_ERROR_BUFFER_SIZE;
+  }
+  *length = (size_t)(writer.next - buffer);
+  return NMEA_OK;
+}
+
+void nmeaParserInit(NmeaParser *parser, NmeaSentenceCallback callback, void *context)
+{
+  NmeaStatistics cleared = {0};
+
+  parser->callback = callback;
+  parser->context = context;
+  parser->filter = NULL;
+  parser->filterContext = NULL;
+  parser->statistics = cleared;
+  parser->state = STATE_IDLE;
+  parser->length = 0;
+  parser->checksum = 0;
+  parser->receivedChecksum = 0;
+}
+
+void nmeaParserSetFilter(NmeaParser *parser, NmeaFrameFilter filter, void *context)
+{
+  parser->filter = filter;
+  parser->filterContext = context;
+}
+
+static void completeSentence(NmeaParser *parser)
+{
+  NmeaStatus status = decodeBody(parser->buffer, parser->length, parser->checksum, &parser->sentence);
+
+  switch (status)
+  {
+  case NMEA_OK:
+    parser->statistics.sentences++;
+    if (parser->callback != NULL)
+    {
+      parser->callback(&parser->sentence, parser->context);
+    }
+    break;
+  case NMEA_ERROR_UNSUPPORTED:
+    parser->statistics.unsupportedSentences++;
+    break;
+  case NMEA_ERROR_FIELD:
+    parser->statistics.fieldErrors++;
+    break;
+  default:
+    parser->statistics.framingErrors++;
+    break;
+  }
+}
+
+void nmeaFeedByte(NmeaParser *parser, uint8_t byte)
+{
+  char c = (char)byte;
+  int8_t digit;
+
+  if (c == '$' || c == '!')
+  {
+    /* A start delimiter always resynchronises, even mid-sentence */
+    if (parser->state != STATE_IDLE)
+    {
+      parser->statistics.framingErrors++;
+    }
+    parser->buffer[0] = c;
+    parser->length = 1;
+    parser->checksum = 0;
+    parser->state = STATE_BODY;
+    return;
+  }
+
+  switch (parser->state)
+  {
+  case STATE_BODY:
+    if (c == '*')
+    {
+      parser->state = STATE_CHECKSUM_HIGH;
+    }
+    else if (c == '\r' || c == '\n' || parser->length >= MAX_BODY_LENGTH)
+    {
+      parser->statistics.framingErrors++;
+      parser->state = STATE_IDLE;
+    }
+    else
+    {
+      parser->buffer[parser->length++] = c;
+      parser->checksum ^= byte;
+    }
+    break;
+
+  case STATE_CHECKSUM_HIGH:
+    digit = hexValue(c);
+    if (digit < 0)
+    {
+      parser->statistics.checksumErrors++;
+      parser->state = STATE_IDLE;
+      break;
+    }
+    parser->receivedChecksum = (uint8_t)(digit << 4);
+    parser->state = STATE_CHECKSUM_LOW;
+    break;
+
+  case STATE_CHECKSUM_LOW:
+    digit = hexValue(c);
+    parser->state = STATE_IDLE;
+    if (digit < 0 || (uint8_t)(parser->receivedChecksum | digit) != parser->checksum)
+    {
+      parser->statistics.checksumErrors++;
+      break;
+    }
+    if (parser->filter != NULL &&
+        !parser->filter(parser->buffer, parser->length, parser->checksum, parser->filterContext))
+    {
+      parser->statistics.filteredSentences++;
+      break;
+    }
+    completeSentence(parser);
+    break;
+
+  default:
+    /* Idle: discard everything up to the next start delimiter */
+    break;
+  }
+}
+
+void nmeaFeed(NmeaParser *parser, const uint8_t *data, size_t length)
+{
+  while (length-- > 0)
+  {
+    nmeaFeedByte(parser, *data++);
+  }
+}
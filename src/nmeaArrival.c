@@ -0,0 +1,308 @@
+#include "nmeaArrival.h"
+
+#include <math.h>
+#include <string.h>
+
+#define DEGREES_TO_RADIANS (3.14159265358979323846 / 180.0)
+#define RADIANS_TO_DEGREES (180.0 / 3.14159265358979323846)
+
+/* A nautical mile is one minute of latitude */
+#define NM_TO_DEGREES (1.0 / 60.0)
+
+#define EARTH_RADIUS_NM_F ((float)NMEA_EARTH_RADIUS_NM)
+
+/* End of a bucket list */
+#define NO_WAYPOINT 0xFFFFu
+
+static int32_t gridRows(void)
+{
+  return (int32_t)ceil(180.0 / NMEA_ARRIVAL_CELL_DEGREES);
+}
+
+static int32_t gridColumns(void)
+{
+  return (int32_t)ceil(360.0 / NMEA_ARRIVAL_CELL_DEGREES);
+}
+
+static int32_t rowOf(double latitude)
+{
+  int32_t row = (int32_t)floor((latitude + 90.0) / NMEA_ARRIVAL_CELL_DEGREES);
+
+  if (row < 0)
+  {
+    return 0;
+  }
+  return row < gridRows() ? row : gridRows() - 1;
+}
+
+/* Column of a cell, wrapped around the antimeridian */
+static int32_t wrapColumn(int32_t column)
+{
+  int32_t columns = gridColumns();
+
+  column %= columns;
+  return column < 0 ? column + columns : column;
+}
+
+static int32_t columnOf(double longitude)
+{
+  return wrapColumn((int32_t)floor((longitude + 180.0) / NMEA_ARRIVAL_CELL_DEGREES));
+}
+
+static uint16_t bucketOf(int32_t row, int32_t column)
+{
+  return (uint16_t)(((uint32_t)row * 2654435761u ^ (uint32_t)column * 40503u) % NMEA_ARRIVAL_GRID_BUCKETS);
+}
+
+/* Appends the idle waypoints of one grid cell to the candidates */
+static uint16_t collectCell(NmeaArrivalDetector *detector, int32_t row, int32_t column, uint16_t candidates)
+{
+  uint16_t i;
+
+  for (i = detector->buckets[bucketOf(row, column)]; i != NO_WAYPOINT; i = detector->next[i])
+  {
+    /* Buckets are shared by several cells, and active waypoints are already in */
+    if (detector->cellRow[i] == row && detector->cellColumn[i] == column && detector->state[i] == 0)
+    {
+      detector->candidates[candidates++] = i;
+    }
+  }
+  return candidates;
+}
+
+/* Collects the active waypoints and the idle ones within searchRange of the
+ * position, or possibly so, as whole grid cells are taken */
+static uint16_t collectCandidates(NmeaArrivalDetector *detector, const NmeaFix *fix)
+{
+  double range = detector->searchRange * NM_TO_DEGREES;
+  int32_t firstRow = rowOf(fix->latitude - range);
+  int32_t lastRow = rowOf(fix->latitude + range);
+  int32_t firstColumn = 0;
+  int32_t lastColumn = gridColumns() - 1;
+  double rangeSine = sin(range * DEGREES_TO_RADIANS);
+  double latitudeCosine = cos(fix->latitude * DEGREES_TO_RADIANS);
+  uint16_t candidates = 0;
+  int32_t row;
+  int32_t column;
+  uint16_t i;
+
+  for (i = 0; i < detector->activeCount; i++)
+  {
+    detector->candidates[candidates++] = detector->active[i];
+  }
+
+  /* Longitude span of the range circle, all of them if it contains a pole */
+  if (fabs(fix->latitude) + range < 90.0 && rangeSine < latitudeCosine)
+  {
+    double span = asin(rangeSine / latitudeCosine) * RADIANS_TO_DEGREES;
+
+    firstColumn = (int32_t)floor((fix->longitude - span + 180.0) / NMEA_ARRIVAL_CELL_DEGREES);
+    lastColumn = (int32_t)floor((fix->longitude + span + 180.0) / NMEA_ARRIVAL_CELL_DEGREES);
+    if (lastColumn - firstColumn >= gridColumns())
+    {
+      firstColumn = 0;
+      lastColumn = gridColumns() - 1;
+    }
+  }
+
+  /* Visiting more cells than there are waypoints costs more than testing them all */
+  if ((uint32_t)(lastRow - firstRow + 1) * (uint32_t)(lastColumn - firstColumn + 1) > detector->count)
+  {
+    for (i = 0; i < detector->count; i++)
+    {
+      if (detector->state[i] == 0)
+      {
+        detector->candidates[candidates++] = i;
+      }
+    }
+    return candidates;
+  }
+
+  for (row = firstRow; row <= lastRow; row++)
+  {
+    for (column = firstColumn; column <= lastColumn; column++)
+    {
+      candidates = collectCell(detector, row, wrapColumn(column), candidates);
+    }
+  }
+  return candidates;
+}
+
+/* Passes the AAM of a waypoint to the callback, with the fields of its field mask */
+static void emit(NmeaArrivalDetector *detector, uint16_t index)
+{
+#if CFG_SENTENCE_AAM_ENABLED
+  SENTENCE_AAM *aam = &detector->sentence.aam;
+
+  (void)index;
+  aam->presentFields = CFG_SENTENCE_AAM_FIELDS;
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT
+  aam->arrivalCircledEntered = (detector->state[index] & NMEA_ARRIVAL_ENTERED) ? STATUS_VALID : STATUS_INVALID;
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  aam->perpendicularPassedAtWaypoint =
+      (detector->state[index] & NMEA_ARRIVAL_PASSED) ? STATUS_VALID : STATUS_INVALID;
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT
+  aam->arrivalCircleRadius = detector->radius[index];
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_RADIUS_UNITS_PRESENT
+  aam->radiusUnits = 'N';
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_WAYPOINT_ID_PRESENT
+  {
+    const char *id = detector->waypoints[index].id;
+    size_t length = strlen(id);
+
+    if (length >= sizeof(aam->waypointID))
+    {
+      length = sizeof(aam->waypointID) - 1u;
+    }
+    memcpy(aam->waypointID, id, length);
+    aam->waypointID[length] = '\0';
+  }
+#endif
+  detector->sentence.addressField.talkerId = detector->talkerId;
+  detector->sentence.addressField.sentenceId = AAM;
+  detector->callback(&detector->sentence, detector->context);
+#else
+  (void)detector;
+  (void)index;
+#endif
+}
+
+void nmeaArrivalInit(NmeaArrivalDetector *detector, TalkerID talkerId, NmeaSentenceCallback callback,
+                     void *context, double approachRange)
+{
+  uint16_t i;
+
+  detector->callback = callback;
+  detector->context = context;
+  detector->talkerId = talkerId;
+  detector->approachRange = approachRange;
+  detector->searchRange = approachRange;
+  detector->count = 0;
+  detector->activeCount = 0;
+  for (i = 0; i < NMEA_ARRIVAL_GRID_BUCKETS; i++)
+  {
+    detector->buckets[i] = NO_WAYPOINT;
+  }
+}
+
+bool nmeaArrivalAdd(NmeaArrivalDetector *detector, const NmeaWaypoint *waypoint, const NmeaWaypoint *previous,
+                    double arrivalRadius)
+{
+  uint16_t i = detector->count;
+  NmeaVector position;
+  NmeaVector forward = {0.0, 0.0, 0.0};
+  uint16_t bucket;
+
+  if (i >= NMEA_ARRIVAL_MAX_WAYPOINTS)
+  {
+    return false;
+  }
+  position = nmeaGeoVector(waypoint->latitude, waypoint->longitude);
+  if (previous != NULL)
+  {
+    NmeaVector origin = nmeaGeoVector(previous->latitude, previous->longitude);
+    NmeaVector normal = nmeaGeoCross(&origin, &position);
+
+    /* Stays zero for a zero length leg, which is never passed */
+    normal = nmeaGeoNormalise(&normal);
+    forward = nmeaGeoCross(&normal, &position);
+  }
+
+  detector->waypoints[i] = *waypoint;
+  detector->radius[i] = (float)arrivalRadius;
+  detector->state[i] = 0;
+  detector->x[i] = (float)position.x;
+  detector->y[i] = (float)position.y;
+  detector->z[i] = (float)position.z;
+  detector->forwardX[i] = (float)forward.x;
+  detector->forwardY[i] = (float)forward.y;
+  detector->forwardZ[i] = (float)forward.z;
+  detector->cellRow[i] = rowOf(waypoint->latitude);
+  detector->cellColumn[i] = columnOf(waypoint->longitude);
+
+  bucket = bucketOf(detector->cellRow[i], detector->cellColumn[i]);
+  detector->next[i] = detector->buckets[bucket];
+  detector->buckets[bucket] = i;
+  if (arrivalRadius > detector->searchRange)
+  {
+    detector->searchRange = arrivalRadius;
+  }
+  detector->count++;
+  return true;
+}
+
+uint16_t nmeaArrivalAddRoute(NmeaArrivalDetector *detector, const NmeaWaypoint *route, uint16_t count,
+                             double arrivalRadius)
+{
+  uint16_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (!nmeaArrivalAdd(detector, &route[i], i > 0 ? &route[i - 1u] : NULL, arrivalRadius))
+    {
+      break;
+    }
+  }
+  return i;
+}
+
+uint16_t nmeaArrivalUpdate(NmeaArrivalDetector *detector, const NmeaFix *fix)
+{
+  NmeaVector position = nmeaGeoVector(fix->latitude, fix->longitude);
+  float px = (float)position.x;
+  float py = (float)position.y;
+  float pz = (float)position.z;
+  float approachRange = (float)detector->approachRange;
+  float hysteresis = (float)NMEA_ARRIVAL_HYSTERESIS;
+  uint16_t candidates = collectCandidates(detector, fix);
+  uint16_t transitions = 0;
+  uint16_t k;
+
+  for (k = 0; k < candidates; k++)
+  {
+    uint16_t i = detector->candidates[k];
+
+    detector->candidateX[k] = detector->x[i];
+    detector->candidateY[k] = detector->y[i];
+    detector->candidateZ[k] = detector->z[i];
+  }
+  nmeaGreatCircleBatch(&position, detector->candidateX, detector->candidateY, detector->candidateZ, candidates,
+                       detector->distance, NULL);
+
+  detector->activeCount = 0;
+  for (k = 0; k < candidates; k++)
+  {
+    uint16_t i = detector->candidates[k];
+    float distance = detector->distance[k];
+    /* Nautical miles past the perpendicular, as the forward vector is a unit vector */
+    float ahead = (detector->forwardX[i] * px + detector->forwardY[i] * py + detector->forwardZ[i] * pz) *
+                  EARTH_RADIUS_NM_F;
+    float enteredMargin = (detector->state[i] & NMEA_ARRIVAL_ENTERED) ? hysteresis : 0.0f;
+    float passedMargin = (detector->state[i] & NMEA_ARRIVAL_PASSED) ? hysteresis : 0.0f;
+    uint8_t state = 0;
+
+    if (distance <= detector->radius[i] + enteredMargin)
+    {
+      state |= NMEA_ARRIVAL_ENTERED;
+    }
+    if (distance <= approachRange + passedMargin && ahead > -passedMargin)
+    {
+      state |= NMEA_ARRIVAL_PASSED;
+    }
+    if (state != 0)
+    {
+      detector->active[detector->activeCount++] = i;
+    }
+    if (state != detector->state[i])
+    {
+      detector->state[i] = state;
+      transitions++;
+      emit(detector, i);
+    }
+  }
+  return transitions;
+}
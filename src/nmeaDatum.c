@@ -0,0 +1,364 @@
+#include "nmeaDatum.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Fixed point position units */
+#define UNITS_PER_MINUTE 10000
+#define UNIT_DECIMALS 4 /* Decimals of the minutes a unit resolves */
+
+/* Presence bits of a position, e.g. POSITION_FIELDS(GGA_). A position is only
+ * shifted if the field mask keeps all four, as with CFG_OMIT_MASKED_FIELDS
+ * the others are not part of the structure. */
+#define POSITION_FIELDS(prefix)                                                                                    \
+  (prefix##LATITUDE_PRESENT | prefix##LATITUDE_POLARITY_PRESENT | prefix##LONGITUDE_PRESENT |                     \
+   prefix##LONGITUDE_POLARITY_PRESENT)
+#define UNITS_PER_DEGREE (60 * UNITS_PER_MINUTE)
+
+static int32_t minutesToUnits(double minutes)
+{
+  return (int32_t)floor(minutes * UNITS_PER_MINUTE + 0.5);
+}
+
+/* Converts a (d)ddmm.mm field and its polarity to signed units */
+static int32_t fieldToUnits(float field, Polarity polarity, Polarity negative)
+{
+  double value = (double)field;
+  double degrees = floor(value / 100.0);
+  int32_t units = (int32_t)degrees * UNITS_PER_DEGREE + minutesToUnits(value - degrees * 100.0);
+
+  return polarity == negative ? -units : units;
+}
+
+/* Converts signed units to a (d)ddmm.mm field and its polarity, with the
+ * minutes rounded to the encoded decimals so that they never print as 60 */
+static float unitsToField(int32_t units, uint8_t decimals, Polarity positive, Polarity negative, Polarity *polarity)
+{
+  uint32_t magnitude = units < 0 ? (uint32_t)-units : (uint32_t)units;
+  uint32_t step = 1u;
+  uint8_t i;
+
+  for (i = decimals; i < UNIT_DECIMALS; i++)
+  {
+    step *= 10u;
+  }
+  /* Rounding up to a whole degree carries through the division below */
+  magnitude = (magnitude + step / 2u) / step * step;
+  *polarity = units < 0 ? negative : positive;
+  return (float)((double)(magnitude / UNITS_PER_DEGREE) * 100.0 +
+                 (double)(magnitude % UNITS_PER_DEGREE) / UNITS_PER_MINUTE);
+}
+
+static void shiftLatitude(const NmeaDatum *datum, float *latitude, Polarity *polarity)
+{
+  int32_t units = fieldToUnits(*latitude, *polarity, SOUTH) - datum->latitudeOffset;
+
+  if (units > 90 * UNITS_PER_DEGREE)
+  {
+    units = 90 * UNITS_PER_DEGREE;
+  }
+  else if (units < -90 * UNITS_PER_DEGREE)
+  {
+    units = -90 * UNITS_PER_DEGREE;
+  }
+  *latitude = unitsToField(units, NMEA_LATITUDE_DECIMALS, NORTH, SOUTH, polarity);
+}
+
+static void shiftLongitude(const NmeaDatum *datum, float *longitude, Polarity *polarity)
+{
+  int32_t units = fieldToUnits(*longitude, *polarity, WEST) - datum->longitudeOffset;
+
+  if (units >= 180 * UNITS_PER_DEGREE)
+  {
+    units -= 360 * UNITS_PER_DEGREE;
+  }
+  else if (units < -180 * UNITS_PER_DEGREE)
+  {
+    units += 360 * UNITS_PER_DEGREE;
+  }
+  *longitude = unitsToField(units, NMEA_LONGITUDE_DECIMALS, EAST, WEST, polarity);
+}
+
+/* Shifts a position whose value and polarity fields are both present */
+static inline void shiftPosition(const NmeaDatum *datum, uint32_t presentFields, uint32_t latitudeFields,
+                                 uint32_t longitudeFields, float *latitude, Polarity *latitudePolarity,
+                                 float *longitude, Polarity *longitudePolarity)
+{
+  if ((presentFields & latitudeFields) == latitudeFields)
+  {
+    shiftLatitude(datum, latitude, latitudePolarity);
+  }
+  if ((presentFields & longitudeFields) == longitudeFields)
+  {
+    shiftLongitude(datum, longitude, longitudePolarity);
+  }
+}
+
+/* Copies a datum code, truncating it to fit */
+static void copyCode(char *target, const char *code)
+{
+  size_t length = strlen(code);
+
+  if (length > 3u)
+  {
+    length = 3u;
+  }
+  memcpy(target, code, length);
+  target[length] = '\0';
+}
+
+#if CFG_SENTENCE_DTM_ENABLED
+#define OFFSET_FIELDS                                                                                              \
+  (DTM_LATITUDE_OFFSET_PRESENT | DTM_LATITUDE_OFFSET_POLARITY_PRESENT | DTM_LONGITUDE_OFFSET_PRESENT |             \
+   DTM_LONGITUDE_OFFSET_POLARITY_PRESENT)
+
+/* Makes the datum announced by a DTM sentence the active one */
+static void selectDatum(NmeaDatumStage *stage, const SENTENCE_DTM *dtm)
+{
+  NmeaDatum *active = &stage->active;
+  uint8_t i;
+
+  /* Fields the field mask leaves out are taken as null */
+  (void)dtm;
+  copyCode(active->code, "");
+  active->subdivision = '\0';
+  active->latitudeOffset = 0;
+  active->longitudeOffset = 0;
+  active->altitudeOffset = 0;
+  stage->known = false;
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_PRESENT
+  if (dtm->presentFields & DTM_LOCAL_DATUM_PRESENT)
+  {
+    copyCode(active->code, dtm->localDatum);
+  }
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT
+  if (dtm->presentFields & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT)
+  {
+    active->subdivision = dtm->localDatumSubdivision;
+  }
+#endif
+
+  /* A missing reference datum is taken as WGS-84 */
+#if CFG_SENTENCE_DTM_FIELDS & DTM_REFERENCE_DATUM_PRESENT
+  if ((dtm->presentFields & DTM_REFERENCE_DATUM_PRESENT) && strcmp(dtm->referenceDatum, "W84") != 0)
+  {
+    return;
+  }
+#endif
+#if (CFG_SENTENCE_DTM_FIELDS & OFFSET_FIELDS) == OFFSET_FIELDS
+  if ((dtm->presentFields & OFFSET_FIELDS) == OFFSET_FIELDS)
+  {
+    active->latitudeOffset = minutesToUnits((double)dtm->latitudeOffset);
+    active->longitudeOffset = minutesToUnits((double)dtm->longitudeOffset);
+    if (dtm->latitudeOffsetPolarity == SOUTH)
+    {
+      active->latitudeOffset = -active->latitudeOffset;
+    }
+    if (dtm->longitudeOffsetPolarity == WEST)
+    {
+      active->longitudeOffset = -active->longitudeOffset;
+    }
+#if CFG_SENTENCE_DTM_FIELDS & DTM_ALTITUDE_OFFSET_PRESENT
+    if (dtm->presentFields & DTM_ALTITUDE_OFFSET_PRESENT)
+    {
+      active->altitudeOffset = (int32_t)floor((double)dtm->altitudeOffset * 100.0 + 0.5);
+    }
+#endif
+    stage->known = true;
+    return;
+  }
+#endif
+  if (strcmp(active->code, "W84") == 0)
+  {
+    stage->known = true;
+    return;
+  }
+  for (i = 0; i < stage->count; i++)
+  {
+    if (strcmp(stage->datums[i].code, active->code) == 0 && stage->datums[i].subdivision == active->subdivision)
+    {
+      *active = stage->datums[i];
+      stage->known = true;
+      return;
+    }
+  }
+}
+
+/* Turns a DTM into the one of the converted positions: WGS-84, no offsets */
+static void toWgs84(SENTENCE_DTM *dtm)
+{
+  dtm->presentFields = CFG_SENTENCE_DTM_FIELDS & ~DTM_LOCAL_DATUM_SUBDIVISION_PRESENT;
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_PRESENT
+  copyCode(dtm->localDatum, "W84");
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_PRESENT
+  dtm->latitudeOffset = 0.0f;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_POLARITY_PRESENT
+  dtm->latitudeOffsetPolarity = NORTH;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_PRESENT
+  dtm->longitudeOffset = 0.0f;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_POLARITY_PRESENT
+  dtm->longitudeOffsetPolarity = EAST;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_ALTITUDE_OFFSET_PRESENT
+  dtm->altitudeOffset = 0.0f;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_REFERENCE_DATUM_PRESENT
+  copyCode(dtm->referenceDatum, "W84");
+#endif
+}
+#endif
+
+/* Copies a sentence with positions into the scratch and shifts them, false
+ * if it has none */
+static bool shiftSentence(NmeaDatumStage *stage, const NmeaSentence *sentence)
+{
+  const NmeaDatum *datum = &stage->active;
+  NmeaSentence *target = &stage->sentence;
+
+  /* Only the member is copied, not the whole union */
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+    target->gga = sentence->gga;
+#if (CFG_SENTENCE_GGA_FIELDS & POSITION_FIELDS(GGA_)) == POSITION_FIELDS(GGA_)
+    shiftPosition(datum, target->gga.presentFields, GGA_LATITUDE_PRESENT | GGA_LATITUDE_POLARITY_PRESENT,
+                  GGA_LONGITUDE_PRESENT | GGA_LONGITUDE_POLARITY_PRESENT, &target->gga.latitude,
+                  &target->gga.latitudePolarity, &target->gga.longitude, &target->gga.longitudePolarity);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_PRESENT
+    if (target->gga.presentFields & GGA_ALTITUDE_PRESENT)
+    {
+      target->gga.altitude = (float)((double)target->gga.altitude - (double)datum->altitudeOffset / 100.0);
+    }
+#endif
+    return true;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+    target->rmc = sentence->rmc;
+#if (CFG_SENTENCE_RMC_FIELDS & POSITION_FIELDS(RMC_)) == POSITION_FIELDS(RMC_)
+    shiftPosition(datum, target->rmc.presentFields, RMC_LATITUDE_PRESENT | RMC_LATITUDE_POLARITY_PRESENT,
+                  RMC_LONGITUDE_PRESENT | RMC_LONGITUDE_POLARITY_PRESENT, &target->rmc.latitude,
+                  &target->rmc.latitudePolarity, &target->rmc.longitude, &target->rmc.longitudePolarity);
+#endif
+    return true;
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  case BWC:
+    target->bwc = sentence->bwc;
+#if (CFG_SENTENCE_BWC_FIELDS & POSITION_FIELDS(BWC_WAYPOINT_)) == POSITION_FIELDS(BWC_WAYPOINT_)
+    shiftPosition(datum, target->bwc.presentFields,
+                  BWC_WAYPOINT_LATITUDE_PRESENT | BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT,
+                  BWC_WAYPOINT_LONGITUDE_PRESENT | BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT,
+                  &target->bwc.waypointLatitude, &target->bwc.waypointLatitudePolarity,
+                  &target->bwc.waypointLongitude, &target->bwc.waypointLongitudePolarity);
+#endif
+    return true;
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  case RMB:
+    target->rmb = sentence->rmb;
+#if (CFG_SENTENCE_RMB_FIELDS & POSITION_FIELDS(RMB_DESTINATION_)) == POSITION_FIELDS(RMB_DESTINATION_)
+    shiftPosition(datum, target->rmb.presentFields,
+                  RMB_DESTINATION_LATITUDE_PRESENT | RMB_DESTINATION_LATITUDE_POLARITY_PRESENT,
+                  RMB_DESTINATION_LONGITUDE_PRESENT | RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT,
+                  &target->rmb.destinationLatitude, &target->rmb.destinationLatitudePolarity,
+                  &target->rmb.destinationLongitude, &target->rmb.destinationLongitudePolarity);
+#endif
+    return true;
+#endif
+  default:
+    (void)datum;
+    (void)target;
+    return false;
+  }
+}
+
+void nmeaDatumInit(NmeaDatumStage *stage, NmeaSentenceCallback callback, void *context)
+{
+  memset(stage, 0, sizeof(*stage));
+  stage->callback = callback;
+  stage->context = context;
+  copyCode(stage->active.code, "W84");
+  stage->known = true;
+}
+
+bool nmeaDatumDefine(NmeaDatumStage *stage, const char *code, char subdivision, double latitudeOffset,
+                     double longitudeOffset, double altitudeOffset)
+{
+  NmeaDatum *datum;
+
+  if (stage->count >= NMEA_DATUM_MAX_DEFINITIONS)
+  {
+    return false;
+  }
+  datum = &stage->datums[stage->count++];
+  copyCode(datum->code, code);
+  datum->subdivision = subdivision;
+  datum->latitudeOffset = minutesToUnits(latitudeOffset);
+  datum->longitudeOffset = minutesToUnits(longitudeOffset);
+  datum->altitudeOffset = (int32_t)floor(altitudeOffset * 100.0 + 0.5);
+  return true;
+}
+
+void nmeaDatumCallback(const NmeaSentence *sentence, void *context)
+{
+  NmeaDatumStage *stage = (NmeaDatumStage *)context;
+  const NmeaDatum *active = &stage->active;
+
+#if CFG_SENTENCE_DTM_ENABLED
+  if (sentence->addressField.sentenceId == DTM)
+  {
+    selectDatum(stage, &sentence->dtm);
+    if (stage->known)
+    {
+      stage->sentence.dtm = sentence->dtm;
+      toWgs84(&stage->sentence.dtm);
+      sentence = &stage->sentence;
+    }
+    stage->callback(sentence, stage->context);
+    return;
+  }
+#endif
+
+  /* WGS-84 positions need no copy */
+  if (stage->known && active->latitudeOffset == 0 && active->longitudeOffset == 0 && active->altitudeOffset == 0)
+  {
+    stage->callback(sentence, stage->context);
+    return;
+  }
+  if (!stage->known)
+  {
+    switch (sentence->addressField.sentenceId)
+    {
+#if CFG_SENTENCE_GGA_ENABLED
+    case GGA:
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+    case RMC:
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+    case BWC:
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+    case RMB:
+#endif
+      stage->untransformed++;
+      break;
+    default:
+      break;
+    }
+  }
+  else if (shiftSentence(stage, sentence))
+  {
+    stage->transformed++;
+    sentence = &stage->sentence;
+  }
+  stage->callback(sentence, stage->context);
+}
@@ -0,0 +1,335 @@
+#include "nmeaDecimal.h"
+#include "nmeaDigits.h"
+
+#include <string.h>
+
+/* Digits that always fit in the uint64_t mantissa */
+#define MAX_DIGITS 19
+
+/* Powers of ten that are exact in a float (up to 10^10) and a double (up to 10^22) */
+static const float FLOAT_POWERS_OF_TEN[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                            1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+static const double DOUBLE_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                              1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                              1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static const uint64_t INTEGER_POWERS_OF_TEN[] = {1u,
+                                                 10u,
+                                                 100u,
+                                                 1000u,
+                                                 10000u,
+                                                 100000u,
+                                                 1000000u,
+                                                 10000000u,
+                                                 100000000u,
+                                                 1000000000u,
+                                                 10000000000u,
+                                                 100000000000u,
+                                                 1000000000000u,
+                                                 10000000000000u,
+                                                 100000000000000u,
+                                                 1000000000000000u,
+                                                 10000000000000000u,
+                                                 100000000000000000u,
+                                                 1000000000000000000u,
+                                                 10000000000000000000u};
+
+/* "00" to "99", two characters per entry */
+static const char DIGIT_PAIRS[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+/**
+ * @brief Writes the digits of value so that the last one lands at end[-1].
+ *
+ * @return The number of digits written, at least one.
+ */
+static uint8_t writeDigitsBackwards(char *end, uint64_t value)
+{
+  char *p = end;
+
+  while (value >= 100u)
+  {
+    const char *pair = &DIGIT_PAIRS[2u * (value % 100u)];
+    value /= 100u;
+    *--p = pair[1];
+    *--p = pair[0];
+  }
+  if (value >= 10u)
+  {
+    *--p = DIGIT_PAIRS[2u * value + 1u];
+    *--p = DIGIT_PAIRS[2u * value];
+  }
+  else
+  {
+    *--p = (char)('0' + value);
+  }
+  return (uint8_t)(end - p);
+}
+
+/**
+ * @brief Appends the run of digits starting at *cursor to *mantissa.
+ *
+ * Each step loads up to eight characters, finds how many of them are digits
+ * and converts that whole run at once.
+ *
+ * @return The number of digits consumed.
+ */
+static uint8_t accumulateDigits(const char **cursor, const char *end, uint64_t *mantissa)
+{
+  const char *p = *cursor;
+  uint64_t m = *mantissa;
+  uint8_t count;
+
+  for (;;)
+  {
+    size_t available = (size_t)(end - p);
+    uint64_t chunk = available >= 8 ? nmeaLoad8(p) : nmeaLoadPartial(p, available);
+    uint8_t run = nmeaDigitRunLength(chunk);
+
+    if (run == 0)
+    {
+      break;
+    }
+    m = m * INTEGER_POWERS_OF_TEN[run] + nmeaLeadingDigitsValue(chunk, run);
+    p += run;
+    if (run < 8)
+    {
+      break;
+    }
+  }
+
+  count = (uint8_t)(p - *cursor);
+  *cursor = p;
+  *mantissa = m;
+  return count;
+}
+
+bool nmeaParseDecimal(const char *data, uint8_t length, NmeaDecimal *decimal)
+{
+  const char *p = data;
+  const char *end = data + length;
+  uint64_t mantissa = 0;
+  uint8_t integerDigits;
+  uint8_t fractionDigits = 0;
+  bool negative = false;
+
+  if (p < end && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    p++;
+  }
+  integerDigits = accumulateDigits(&p, end, &mantissa);
+  if (p < end && *p == '.')
+  {
+    p++;
+    fractionDigits = accumulateDigits(&p, end, &mantissa);
+  }
+
+  if (p != end || integerDigits + fractionDigits == 0 || integerDigits + fractionDigits > MAX_DIGITS)
+  {
+    return false;
+  }
+  decimal->mantissa = mantissa;
+  decimal->fractionDigits = fractionDigits;
+  decimal->negative = negative;
+  return true;
+}
+
+float nmeaDecimalToFloat(const NmeaDecimal *decimal)
+{
+  float value;
+
+  if (decimal->mantissa <= (1u << 24) && decimal->fractionDigits <= 10)
+  {
+    /* Both operands are exact, so the single division rounds correctly */
+    value = (float)decimal->mantissa / FLOAT_POWERS_OF_TEN[decimal->fractionDigits];
+  }
+  else
+  {
+    /* For mantissas up to 2^53 the double quotient cannot land on a float
+     * rounding midpoint unless the exact quotient does, for up to eight
+     * fraction digits, so rounding it again to float is still correct. Longer
+     * mantissas are rounded once more on the conversion to double. */
+    value = (float)((double)decimal->mantissa / DOUBLE_POWERS_OF_TEN[decimal->fractionDigits]);
+  }
+  return decimal->negative ? -value : value;
+}
+
+double nmeaDecimalToDouble(const NmeaDecimal *decimal)
+{
+  double value = (double)decimal->mantissa / DOUBLE_POWERS_OF_TEN[decimal->fractionDigits];
+
+  return decimal->negative ? -value : value;
+}
+
+bool nmeaDecimalToScaled(const NmeaDecimal *decimal, uint8_t decimals, int32_t *value)
+{
+  uint64_t magnitude = decimal->mantissa;
+  uint8_t i;
+
+  if (decimals >= decimal->fractionDigits)
+  {
+    for (i = decimal->fractionDigits; i < decimals; i++)
+    {
+      if (magnitude > INT32_MAX)
+      {
+        return false;
+      }
+      magnitude *= 10u;
+    }
+  }
+  else
+  {
+    uint64_t divisor = INTEGER_POWERS_OF_TEN[decimal->fractionDigits - decimals];
+    magnitude = (magnitude + divisor / 2) / divisor;
+  }
+
+  if (magnitude > INT32_MAX)
+  {
+    return false;
+  }
+  *value = decimal->negative ? -(int32_t)magnitude : (int32_t)magnitude;
+  return true;
+}
+
+bool nmeaParseUint32(const char *data, uint8_t length, uint32_t *value)
+{
+  const char *p = data;
+  uint64_t result = 0;
+  uint64_t low;
+  uint64_t high;
+  uint8_t highDigits;
+
+  if (length == 0)
+  {
+    return false;
+  }
+
+  if (length <= 8)
+  {
+    /* Counters, identifiers and instances: one validated run */
+    low = (length == 8) ? nmeaLoad8(data) : nmeaLoadPartial(data, length);
+    if (nmeaDigitRunLength(low) != length)
+    {
+      return false;
+    }
+    *value = nmeaLeadingDigitsValue(low, length);
+    return true;
+  }
+
+  if (length <= 10)
+  {
+    /* MMSIs: the last eight digits in one step, the rest as a short run */
+    highDigits = (uint8_t)(length - 8);
+    high = nmeaLoadPartial(data, highDigits);
+    low = nmeaLoad8(data + highDigits);
+    if (nmeaDigitRunLength(high) != highDigits || nmeaDigitRunLength(low) != 8)
+    {
+      return false;
+    }
+    result = (uint64_t)nmeaLeadingDigitsValue(high, highDigits) * 100000000u + nmeaEightDigitsValue(low);
+  }
+  else if (length > MAX_DIGITS || accumulateDigits(&p, data + length, &result) != length)
+  {
+    /* Only reachable with leading zeros */
+    return false;
+  }
+
+  if (result > UINT32_MAX)
+  {
+    return false;
+  }
+  *value = (uint32_t)result;
+  return true;
+}
+
+uint8_t nmeaFormatDecimal(char *text, float value, uint8_t minDigits, uint8_t decimals)
+{
+  char digits[20 + NMEA_FORMAT_MAX_DECIMALS];
+  uint32_t bits;
+  uint32_t biasedExponent;
+  uint64_t significand;
+  uint64_t scaled;
+  int exponent;
+  uint8_t count;
+  uint8_t width;
+  uint8_t length = 0;
+
+  if (decimals > NMEA_FORMAT_MAX_DECIMALS || minDigits > 20)
+  {
+    return 0;
+  }
+
+  memcpy(&bits, &value, sizeof(bits));
+  biasedExponent = (bits >> 23) & 0xFFu;
+  if (biasedExponent == 0xFFu)
+  {
+    return 0;
+  }
+  significand = bits & 0x7FFFFFu;
+  if (biasedExponent != 0)
+  {
+    significand |= 0x800000u;
+  }
+  exponent = (biasedExponent != 0 ? (int)biasedExponent : 1) - 150;
+
+  /* |value| * 10^decimals = significand * 10^decimals * 2^exponent, where the
+   * first product is exact (< 2^54); a single rounding shift then gives the
+   * correctly rounded result, ties to even like the C library. */
+  scaled = significand * INTEGER_POWERS_OF_TEN[decimals];
+  if (exponent >= 0)
+  {
+    if (exponent >= 64 || scaled > (UINT64_MAX >> exponent))
+    {
+      return 0;
+    }
+    scaled <<= exponent;
+  }
+  else if (exponent > -64)
+  {
+    unsigned shift = (unsigned)-exponent;
+    uint64_t remainder = scaled & ((UINT64_C(1) << shift) - 1u);
+    uint64_t half = UINT64_C(1) << (shift - 1u);
+
+    scaled >>= shift;
+    if (remainder > half || (remainder == half && (scaled & 1u)))
+    {
+      scaled++;
+    }
+  }
+  else
+  {
+    scaled = 0;
+  }
+
+  /* All digits at once, then the point goes in front of the last decimals */
+  count = writeDigitsBackwards(digits + sizeof(digits), scaled);
+  width = (uint8_t)(decimals + (minDigits > 0 ? minDigits : 1));
+  while (count < width)
+  {
+    digits[sizeof(digits) - ++count] = '0';
+  }
+
+  if (bits >> 31)
+  {
+    text[length++] = '-';
+  }
+  memcpy(text + length, digits + sizeof(digits) - count, (size_t)(count - decimals));
+  length = (uint8_t)(length + count - decimals);
+  if (decimals > 0)
+  {
+    text[length++] = '.';
+    memcpy(text + length, digits + sizeof(digits) - decimals, decimals);
+    length = (uint8_t)(length + decimals);
+  }
+  return length;
+}
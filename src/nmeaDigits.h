@@ -0,0 +1,98 @@
+#ifndef SRC_NMEA_DIGITS_H_
+#define SRC_NMEA_DIGITS_H_
+
+/*
+ * SWAR (SIMD within a register) helpers for converting runs of ASCII digits.
+ *
+ * Characters are loaded little-endian regardless of the target byte order, so
+ * the first character of the run is always the least significant byte. The
+ * loads are byte-wise; compilers fold them into a single (unaligned) load on
+ * targets that support it.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static inline uint32_t nmeaLoad4(const char *p)
+{
+  const uint8_t *b = (const uint8_t *)p;
+  return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+static inline uint64_t nmeaLoad8(const char *p)
+{
+  return (uint64_t)nmeaLoad4(p) | ((uint64_t)nmeaLoad4(p + 4) << 32);
+}
+
+/*
+ * Loads count (0..7) characters without reading outside [p, p + count). The
+ * missing bytes are zero, which is never a digit. Overlapping loads keep this
+ * branch-light: the overlapped bytes are identical, so OR'ing them is harmless.
+ */
+static inline uint64_t nmeaLoadPartial(const char *p, size_t count)
+{
+  const uint8_t *b = (const uint8_t *)p;
+
+  if (count >= 4)
+  {
+    return (uint64_t)nmeaLoad4(p) | ((uint64_t)nmeaLoad4(p + count - 4) << (8 * (count - 4)));
+  }
+  if (count > 0)
+  {
+    return (uint64_t)b[0] | ((uint64_t)b[count / 2] << (8 * (count / 2))) |
+           ((uint64_t)b[count - 1] << (8 * (count - 1)));
+  }
+  return 0;
+}
+
+static inline uint8_t nmeaCountTrailingZeros64(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return (uint8_t)__builtin_ctzll(v);
+#else
+  uint8_t count = 0;
+  while ((v & 1u) == 0)
+  {
+    v >>= 1;
+    count++;
+  }
+  return count;
+#endif
+}
+
+/*
+ * Number of leading digit characters (0..8) in a word.
+ *
+ * Each byte is XOR'ed with '0', leaving 0..9 for digits; a byte is a non-digit
+ * if its high nibble is set, or becomes set when 6 is added. The carry out of
+ * a byte >= 0xFA can only corrupt later bytes, never the first non-digit.
+ */
+static inline uint8_t nmeaDigitRunLength(uint64_t v)
+{
+  uint64_t x = v ^ 0x3030303030303030u;
+  uint64_t nonDigits = (x | (x + 0x0606060606060606u)) & 0xF0F0F0F0F0F0F0F0u;
+
+  return nonDigits ? (uint8_t)(nmeaCountTrailingZeros64(nonDigits) / 8) : 8;
+}
+
+/* Value of eight validated digits, e.g. "12345678" -> 12345678 */
+static inline uint32_t nmeaEightDigitsValue(uint64_t v)
+{
+  v = ((v & 0x0F0F0F0F0F0F0F0Fu) * 2561u) >> 8;                 /* pairs */
+  v = ((v & 0x00FF00FF00FF00FFu) * 6553601u) >> 16;             /* quads */
+  return (uint32_t)(((v & 0x0000FFFF0000FFFFu) * 42949672960001u) >> 32);
+}
+
+/* Value of the first count (1..8) characters of a word, all validated digits */
+static inline uint32_t nmeaLeadingDigitsValue(uint64_t v, uint8_t count)
+{
+  if (count < 8)
+  {
+    /* Move the digits to the top and pad the low bytes with leading '0's */
+    v = (v << (8 * (8 - count))) | (0x3030303030303030u >> (8 * count));
+  }
+  return nmeaEightDigitsValue(v);
+}
+
+#endif
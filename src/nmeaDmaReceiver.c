@@ -0,0 +1,63 @@
+#include "nmeaDmaReceiver.h"
+
+#include <string.h>
+
+/* Buffer position the DMA writes next */
+static size_t writeIndex(const NmeaDmaReceiver *receiver)
+{
+  size_t remaining = receiver->hal->remaining(receiver->port);
+
+  /* Right after wrapping the counter may read as the full size, or 0
+   * before it is reloaded */
+  if (remaining == 0 || remaining >= NMEA_DMA_BUFFER_SIZE)
+  {
+    return 0;
+  }
+  return NMEA_DMA_BUFFER_SIZE - remaining;
+}
+
+static void feed(NmeaDmaReceiver *receiver, size_t end)
+{
+  nmeaFeed(&receiver->parser, &receiver->buffer[receiver->readIndex], end - receiver->readIndex);
+  receiver->statistics.bytes += (uint32_t)(end - receiver->readIndex);
+  receiver->readIndex = end == NMEA_DMA_BUFFER_SIZE ? 0 : end;
+}
+
+/* Feeds everything between the read position and the DMA */
+static void catchUp(NmeaDmaReceiver *receiver)
+{
+  size_t end = writeIndex(receiver);
+
+  if (end < receiver->readIndex)
+  {
+    /* The DMA wrapped: the tail of the buffer first */
+    feed(receiver, NMEA_DMA_BUFFER_SIZE);
+  }
+  if (end > receiver->readIndex)
+  {
+    feed(receiver, end);
+  }
+}
+
+bool nmeaDmaInit(NmeaDmaReceiver *receiver, const NmeaDmaHal *hal, void *port, NmeaSentenceCallback callback,
+                 void *context)
+{
+  receiver->hal = hal;
+  receiver->port = port;
+  receiver->readIndex = 0;
+  memset(&receiver->statistics, 0, sizeof(receiver->statistics));
+  nmeaParserInit(&receiver->parser, callback, context);
+  return hal->start(port, receiver->buffer, NMEA_DMA_BUFFER_SIZE);
+}
+
+void nmeaDmaService(NmeaDmaReceiver *receiver, NmeaDmaEvent event)
+{
+  receiver->statistics.events[event]++;
+  catchUp(receiver);
+}
+
+void nmeaDmaStop(NmeaDmaReceiver *receiver)
+{
+  receiver->hal->stop(receiver->port);
+  catchUp(receiver);
+}
@@ -0,0 +1,172 @@
+#include "nmeaEpoch.h"
+
+/* UTC time carried by a sentence, false if it has none or its field mask
+ * leaves the time out */
+static bool sentenceTime(const NmeaSentence *sentence, float *utcTime)
+{
+  (void)utcTime;
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_GGA_ENABLED && (CFG_SENTENCE_GGA_FIELDS & GGA_UTC_TIME_PRESENT)
+  case GGA:
+    *utcTime = sentence->gga.utcTime;
+    return (sentence->gga.presentFields & GGA_UTC_TIME_PRESENT) != 0;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED && (CFG_SENTENCE_RMC_FIELDS & RMC_UTC_TIME_PRESENT)
+  case RMC:
+    *utcTime = sentence->rmc.utcTime;
+    return (sentence->rmc.presentFields & RMC_UTC_TIME_PRESENT) != 0;
+#endif
+#if CFG_SENTENCE_GST_ENABLED && (CFG_SENTENCE_GST_FIELDS & GST_UTC_TIME_PRESENT)
+  case GST:
+    *utcTime = sentence->gst.utcTime;
+    return (sentence->gst.presentFields & GST_UTC_TIME_PRESENT) != 0;
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED && (CFG_SENTENCE_ZDA_FIELDS & ZDA_UTC_TIME_PRESENT)
+  case ZDA:
+    *utcTime = sentence->zda.utcTime;
+    return (sentence->zda.presentFields & ZDA_UTC_TIME_PRESENT) != 0;
+#endif
+  default:
+    return false;
+  }
+}
+
+/* Copies the sentence into the epoch, false if it is not part of a fix */
+static bool merge(NmeaEpoch *epoch, const NmeaSentence *sentence)
+{
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+    epoch->gga = sentence->gga;
+    epoch->sentences |= NMEA_EPOCH_GGA;
+    return true;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+    epoch->rmc = sentence->rmc;
+    epoch->sentences |= NMEA_EPOCH_RMC;
+    return true;
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  case GSA:
+    epoch->gsa = sentence->gsa;
+    epoch->sentences |= NMEA_EPOCH_GSA;
+    return true;
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  case GSV:
+  {
+    uint8_t i;
+
+    for (i = 0; i < sentence->gsv.satelliteCount && epoch->satelliteCount < NMEA_EPOCH_MAX_SATELLITES; i++)
+    {
+      epoch->satellites[epoch->satelliteCount++] = sentence->gsv.satellites[i];
+    }
+    epoch->sentences |= NMEA_EPOCH_GSV;
+    return true;
+  }
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  case GST:
+    epoch->gst = sentence->gst;
+    epoch->sentences |= NMEA_EPOCH_GST;
+    return true;
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  case VTG:
+    epoch->vtg = sentence->vtg;
+    epoch->sentences |= NMEA_EPOCH_VTG;
+    return true;
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  case ZDA:
+    epoch->zda = sentence->zda;
+    epoch->sentences |= NMEA_EPOCH_ZDA;
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+/* True if the sentence is the configured end of an epoch */
+static bool isTerminator(const NmeaEpochGrouper *grouper, const NmeaSentence *sentence)
+{
+  if (grouper->terminator == 0 || sentence->addressField.sentenceId != grouper->terminator)
+  {
+    return false;
+  }
+#if CFG_SENTENCE_GSV_ENABLED
+  if (sentence->addressField.sentenceId == GSV)
+  {
+    /* Without the sentence numbers the end of the series is unknown */
+#if (CFG_SENTENCE_GSV_FIELDS & (GSV_SENTENCE_NUMBER_PRESENT | GSV_TOTAL_SENTENCES_PRESENT)) ==                    \
+    (GSV_SENTENCE_NUMBER_PRESENT | GSV_TOTAL_SENTENCES_PRESENT)
+    return sentence->gsv.sentenceNumber >= sentence->gsv.totalSentences;
+#else
+    return false;
+#endif
+  }
+#endif
+  return true;
+}
+
+static void reset(NmeaEpoch *epoch)
+{
+  epoch->hasTime = false;
+  epoch->sentences = 0;
+#if CFG_SENTENCE_GSV_ENABLED
+  epoch->satelliteCount = 0;
+#endif
+}
+
+void nmeaEpochInit(NmeaEpochGrouper *grouper, NmeaEpochCallback callback, void *context, SentenceID terminator)
+{
+  grouper->callback = callback;
+  grouper->context = context;
+  grouper->terminator = terminator;
+  grouper->epochs = 0;
+  reset(&grouper->epoch);
+}
+
+void nmeaEpochAdd(NmeaEpochGrouper *grouper, const NmeaSentence *sentence)
+{
+  NmeaEpoch *epoch = &grouper->epoch;
+  float utcTime = 0.0f;
+  bool hasTime = sentenceTime(sentence, &utcTime);
+
+  if (hasTime && epoch->hasTime && utcTime != epoch->utcTime)
+  {
+    nmeaEpochFlush(grouper);
+  }
+  if (!merge(epoch, sentence))
+  {
+    return;
+  }
+  if (hasTime && !epoch->hasTime)
+  {
+    epoch->utcTime = utcTime;
+    epoch->hasTime = true;
+  }
+  if (isTerminator(grouper, sentence))
+  {
+    nmeaEpochFlush(grouper);
+  }
+}
+
+void nmeaEpochFlush(NmeaEpochGrouper *grouper)
+{
+  if (grouper->epoch.sentences != 0)
+  {
+    grouper->epochs++;
+    grouper->callback(&grouper->epoch, grouper->context);
+  }
+  reset(&grouper->epoch);
+}
+
+void nmeaEpochCallback(const NmeaSentence *sentence, void *context)
+{
+  nmeaEpochAdd((NmeaEpochGrouper *)context, sentence);
+}
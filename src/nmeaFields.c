@@ -0,0 +1,165 @@
+#include "nmeaFields.h"
+#include "nmeaDecimal.h"
+
+/* ddmm.mmmm and dddmm.mmmm are stored as floats: further digits are noise */
+#if NMEA_LATITUDE_DECIMALS > 4 || NMEA_LONGITUDE_DECIMALS > 4
+#error "NMEA_LATITUDE_DECIMALS and NMEA_LONGITUDE_DECIMALS must be at most 4"
+#endif
+
+NmeaField nmeaNextField(NmeaCursor *cursor)
+{
+  NmeaField field;
+  const char *p = cursor->next;
+
+  field.data = p;
+  while (p < cursor->end && *p != ',')
+  {
+    p++;
+  }
+  field.length = (uint8_t)(p - field.data);
+
+  /* Step over the delimiter, but never past the end of the data */
+  cursor->next = (p < cursor->end) ? p + 1 : p;
+  return field;
+}
+
+bool nmeaFieldToChar(NmeaField field, char *value)
+{
+  *value = field.length ? field.data[0] : '\0';
+  return field.length <= 1;
+}
+
+bool nmeaFieldToUint32(NmeaField field, uint32_t *value)
+{
+  *value = 0;
+  return field.length == 0 || nmeaParseUint32(field.data, field.length, value);
+}
+
+bool nmeaFieldToUint16(NmeaField field, uint16_t *value)
+{
+  uint32_t result;
+  bool ok = nmeaFieldToUint32(field, &result) && result <= UINT16_MAX;
+
+  *value = ok ? (uint16_t)result : 0;
+  return ok;
+}
+
+bool nmeaFieldToUint8(NmeaField field, uint8_t *value)
+{
+  uint32_t result;
+  bool ok = nmeaFieldToUint32(field, &result) && result <= UINT8_MAX;
+
+  *value = ok ? (uint8_t)result : 0;
+  return ok;
+}
+
+bool nmeaFieldToFloat(NmeaField field, float *value)
+{
+  NmeaDecimal decimal;
+
+  *value = 0.0f;
+  if (field.length == 0)
+  {
+    return true;
+  }
+  if (!nmeaParseDecimal(field.data, field.length, &decimal))
+  {
+    return false;
+  }
+  *value = nmeaDecimalToFloat(&decimal);
+  return true;
+}
+
+bool nmeaFieldToText(NmeaField field, char *text, size_t size)
+{
+  size_t length = field.length;
+  bool fits = length < size;
+  size_t i;
+
+  if (!fits)
+  {
+    length = size - 1;
+  }
+  for (i = 0; i < length; i++)
+  {
+    text[i] = field.data[i];
+  }
+  text[length] = '\0';
+  return fits;
+}
+
+void nmeaWriterInit(NmeaWriter *writer, char *buffer, size_t size)
+{
+  writer->next = buffer;
+  writer->end = buffer + size;
+  writer->checksum = 0;
+  writer->overflow = false;
+}
+
+void nmeaPutChar(NmeaWriter *writer, char c)
+{
+  if (writer->next < writer->end)
+  {
+    *writer->next++ = c;
+    writer->checksum ^= (uint8_t)c;
+  }
+  else
+  {
+    writer->overflow = true;
+  }
+}
+
+void nmeaPutFieldChar(NmeaWriter *writer, char c)
+{
+  if (c != '\0')
+  {
+    nmeaPutChar(writer, c);
+  }
+}
+
+void nmeaPutUint(NmeaWriter *writer, uint32_t value, uint8_t minDigits)
+{
+  char digits[10];
+  uint8_t count = 0;
+
+  do
+  {
+    digits[count++] = (char)('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  while (minDigits > count)
+  {
+    nmeaPutChar(writer, '0');
+    minDigits--;
+  }
+  while (count > 0)
+  {
+    nmeaPutChar(writer, digits[--count]);
+  }
+}
+
+void nmeaPutFloat(NmeaWriter *writer, float value, uint8_t minDigits, uint8_t decimals)
+{
+  char text[NMEA_FORMAT_MAX_LENGTH];
+  uint8_t length = nmeaFormatDecimal(text, value, minDigits, decimals);
+  uint8_t i;
+
+  if (length == 0)
+  {
+    writer->overflow = true;
+    return;
+  }
+  for (i = 0; i < length; i++)
+  {
+    nmeaPutChar(writer, text[i]);
+  }
+}
+
+void nmeaPutText(NmeaWriter *writer, const char *text)
+{
+  while (*text != '\0')
+  {
+    nmeaPutChar(writer, *text++);
+  }
+}
@@ -0,0 +1,230 @@
+#include "nmeaGeodesy.h"
+
+#include <math.h>
+
+#define PI 3.14159265358979323846
+#define DEGREES_TO_RADIANS (PI / 180.0)
+#define RADIANS_TO_DEGREES (180.0 / PI)
+
+#define HALF_PI_F 1.57079632679489662f
+#define PI_F 3.14159265358979324f
+#define RADIANS_TO_DEGREES_F 57.2957795130823209f
+#define EARTH_RADIUS_NM_F ((float)NMEA_EARTH_RADIUS_NM)
+
+/* Below this change of Mercator latitude a rhumb line is treated as an east-west line */
+#define MIN_MERCATOR_CHANGE 1e-12
+
+/* Wraps radians to [-pi, pi) */
+static double wrapPi(double radians)
+{
+  return radians - 2.0 * PI * floor((radians + PI) / (2.0 * PI));
+}
+
+/* Converts radians to a bearing in [0, 360) */
+static double toBearing(double radians)
+{
+  double degrees = radians * RADIANS_TO_DEGREES;
+
+  return degrees < 0.0 ? degrees + 360.0 : degrees;
+}
+
+/* Latitude on the Mercator projection (isometric latitude) */
+static double mercatorLatitude(double latitude)
+{
+  return log(tan(PI / 4.0 + latitude / 2.0));
+}
+
+NmeaVector nmeaGeoVector(double latitude, double longitude)
+{
+  double phi = latitude * DEGREES_TO_RADIANS;
+  double lambda = longitude * DEGREES_TO_RADIANS;
+  NmeaVector v;
+
+  v.x = cos(phi) * cos(lambda);
+  v.y = cos(phi) * sin(lambda);
+  v.z = sin(phi);
+  return v;
+}
+
+double nmeaGeoDot(const NmeaVector *a, const NmeaVector *b)
+{
+  return a->x * b->x + a->y * b->y + a->z * b->z;
+}
+
+NmeaVector nmeaGeoCross(const NmeaVector *a, const NmeaVector *b)
+{
+  NmeaVector v;
+
+  v.x = a->y * b->z - a->z * b->y;
+  v.y = a->z * b->x - a->x * b->z;
+  v.z = a->x * b->y - a->y * b->x;
+  return v;
+}
+
+NmeaVector nmeaGeoNormalise(const NmeaVector *v)
+{
+  double length = sqrt(nmeaGeoDot(v, v));
+  NmeaVector unit = *v;
+
+  if (length > 0.0)
+  {
+    unit.x /= length;
+    unit.y /= length;
+    unit.z /= length;
+  }
+  return unit;
+}
+
+double nmeaGreatCircleDistance(const NmeaVector *from, const NmeaVector *to)
+{
+  NmeaVector cross = nmeaGeoCross(from, to);
+
+  /* atan2 stays accurate for both tiny and near antipodal separations */
+  return atan2(sqrt(nmeaGeoDot(&cross, &cross)), nmeaGeoDot(from, to)) * NMEA_EARTH_RADIUS_NM;
+}
+
+double nmeaGreatCircleBearing(const NmeaVector *from, const NmeaVector *to)
+{
+  /* Components of the target along the local east and north directions */
+  double east = to->y * from->x - to->x * from->y;
+  double north = to->z * (from->x * from->x + from->y * from->y) - from->z * (to->x * from->x + to->y * from->y);
+
+  /* Both components are scaled by cos(latitude), which atan2 ignores */
+  return toBearing(atan2(east, north));
+}
+
+double nmeaGreatCircleOffset(const NmeaVector *normal, const NmeaVector *position)
+{
+  double sine = nmeaGeoDot(normal, position);
+
+  if (sine > 1.0)
+  {
+    sine = 1.0;
+  }
+  else if (sine < -1.0)
+  {
+    sine = -1.0;
+  }
+  return asin(sine) * NMEA_EARTH_RADIUS_NM;
+}
+
+double nmeaRhumbBearing(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+{
+  double mercatorChange =
+      mercatorLatitude(toLatitude * DEGREES_TO_RADIANS) - mercatorLatitude(fromLatitude * DEGREES_TO_RADIANS);
+  double longitudeChange = wrapPi((toLongitude - fromLongitude) * DEGREES_TO_RADIANS);
+
+  return toBearing(atan2(longitudeChange, mercatorChange));
+}
+
+double nmeaRhumbDistance(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+{
+  double phi1 = fromLatitude * DEGREES_TO_RADIANS;
+  double phi2 = toLatitude * DEGREES_TO_RADIANS;
+  double latitudeChange = phi2 - phi1;
+  double mercatorChange = mercatorLatitude(phi2) - mercatorLatitude(phi1);
+  double longitudeChange = wrapPi((toLongitude - fromLongitude) * DEGREES_TO_RADIANS);
+  /* Stretch of the meridian distance along the line, cos(latitude) on an east-west line */
+  double q = fabs(mercatorChange) > MIN_MERCATOR_CHANGE ? latitudeChange / mercatorChange : cos(phi1);
+
+  return sqrt(latitudeChange * latitudeChange + q * q * longitudeChange * longitudeChange) * NMEA_EARTH_RADIUS_NM;
+}
+
+/*
+ * atan(t) for 0 <= t <= 1 (Abramowitz and Stegun 4.4.49, error 2e-8), then
+ * the octant is restored with selects rather than branches.
+ */
+static inline float polynomialAtan2(float y, float x)
+{
+  float ax = fabsf(x);
+  float ay = fabsf(y);
+  float high = ax > ay ? ax : ay;
+  float low = ax > ay ? ay : ax;
+  float t = low / (high > 0.0f ? high : 1.0f);
+  float s = t * t;
+  float r = t * (1.0f +
+                 s * (-0.3333314528f +
+                      s * (0.1999355085f +
+                           s * (-0.1420889944f +
+                                s * (0.1065626393f +
+                                     s * (-0.0752896400f +
+                                          s * (0.0429096138f + s * (-0.0161657367f + s * 0.0028662257f))))))));
+
+  r = ay > ax ? HALF_PI_F - r : r;
+  r = x < 0.0f ? PI_F - r : r;
+  return y < 0.0f ? -r : r;
+}
+
+float nmeaFastAtan2(float y, float x)
+{
+  return polynomialAtan2(y, x);
+}
+
+void nmeaGeoVectorBatch(const double *latitude, const double *longitude, size_t count, float *x, float *y,
+                        float *z)
+{
+  size_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    NmeaVector v = nmeaGeoVector(latitude[i], longitude[i]);
+
+    x[i] = (float)v.x;
+    y[i] = (float)v.y;
+    z[i] = (float)v.z;
+  }
+}
+
+void nmeaGreatCircleBatch(const NmeaVector *from, const float *x, const float *y, const float *z, size_t count,
+                          float *distance, float *bearing)
+{
+  float fx = (float)from->x;
+  float fy = (float)from->y;
+  float fz = (float)from->z;
+  float horizontal = fx * fx + fy * fy;
+  size_t i;
+
+  /* Same formulas as nmeaGreatCircleDistance() and nmeaGreatCircleBearing() */
+  for (i = 0; i < count; i++)
+  {
+    float cx = fy * z[i] - fz * y[i];
+    float cy = fz * x[i] - fx * z[i];
+    float cz = fx * y[i] - fy * x[i];
+    float dot = fx * x[i] + fy * y[i] + fz * z[i];
+
+    distance[i] = polynomialAtan2(sqrtf(cx * cx + cy * cy + cz * cz), dot) * EARTH_RADIUS_NM_F;
+  }
+  if (bearing == NULL)
+  {
+    return;
+  }
+  for (i = 0; i < count; i++)
+  {
+    float east = y[i] * fx - x[i] * fy;
+    float north = z[i] * horizontal - fz * (x[i] * fx + y[i] * fy);
+    float degrees = polynomialAtan2(east, north) * RADIANS_TO_DEGREES_F;
+
+    bearing[i] = degrees < 0.0f ? degrees + 360.0f : degrees;
+  }
+}
+
+void nmeaGreatCircleOffsetBatch(const NmeaVector *normal, const float *x, const float *y, const float *z,
+                                size_t count, float *offset)
+{
+  float nx = (float)normal->x;
+  float ny = (float)normal->y;
+  float nz = (float)normal->z;
+  size_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    float sine = nx * x[i] + ny * y[i] + nz * z[i];
+    float cx = ny * z[i] - nz * y[i];
+    float cy = nz * x[i] - nx * z[i];
+    float cz = nx * y[i] - ny * x[i];
+
+    /* asin(sine), with the cosine taken from the cross product, which unlike
+     * sqrt(1 - sine^2) keeps its precision far from the great circle */
+    offset[i] = polynomialAtan2(sine, sqrtf(cx * cx + cy * cy + cz * cz)) * EARTH_RADIUS_NM_F;
+  }
+}
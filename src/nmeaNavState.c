@@ -0,0 +1,260 @@
+#include "nmeaNavState.h"
+
+#include <string.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "nmeaNavState.c needs the GCC/Clang __atomic builtins"
+#endif
+
+/* With CFG_OMIT_MASKED_FIELDS the field masks must keep the fields read here */
+#if CFG_OMIT_MASKED_FIELDS
+#define GGA_READ_FIELDS                                                                                            \
+  (GGA_UTC_TIME_PRESENT | GGA_LATITUDE_PRESENT | GGA_LATITUDE_POLARITY_PRESENT | GGA_LONGITUDE_PRESENT |           \
+   GGA_LONGITUDE_POLARITY_PRESENT | GGA_QUALITY_INDICATOR_PRESENT | GGA_SATELLITES_IN_USE_PRESENT |               \
+   GGA_HDOP_PRESENT | GGA_ALTITUDE_PRESENT)
+#define RMC_READ_FIELDS                                                                                            \
+  (RMC_UTC_TIME_PRESENT | RMC_STATUS_PRESENT | RMC_LATITUDE_PRESENT | RMC_LATITUDE_POLARITY_PRESENT |              \
+   RMC_LONGITUDE_PRESENT | RMC_LONGITUDE_POLARITY_PRESENT | RMC_SPEED_OVER_GROUND_PRESENT |                       \
+   RMC_COURSE_OVER_GROUND_PRESENT | RMC_DATE_PRESENT)
+#define VTG_READ_FIELDS (VTG_COURSE_OVER_GROUND_TRUE_PRESENT | VTG_SPEED_OVER_GROUND_KNOTS_PRESENT)
+#if CFG_SENTENCE_GGA_ENABLED && (CFG_SENTENCE_GGA_FIELDS & GGA_READ_FIELDS) != GGA_READ_FIELDS
+#error "nmeaNavState.c reads GGA time, position, quality, satellites, HDOP and altitude"
+#endif
+#if CFG_SENTENCE_RMC_ENABLED && (CFG_SENTENCE_RMC_FIELDS & RMC_READ_FIELDS) != RMC_READ_FIELDS
+#error "nmeaNavState.c reads RMC time, status, position, speed, course and date"
+#endif
+#if CFG_SENTENCE_VTG_ENABLED && (CFG_SENTENCE_VTG_FIELDS & VTG_READ_FIELDS) != VTG_READ_FIELDS
+#error "nmeaNavState.c reads VTG true course and speed in knots"
+#endif
+#if CFG_SENTENCE_HDT_ENABLED && (CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_PRESENT) == 0
+#error "nmeaNavState.c reads the HDT heading"
+#endif
+#endif
+
+/* Makes the sequence odd before the record is modified */
+static void beginWrite(uint32_t *sequence)
+{
+  __atomic_store_n(sequence, *sequence + 1u, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/* Counts the update and makes the sequence even again, publishing the
+ * modified record */
+static void endWrite(uint32_t *sequence, uint32_t *updates)
+{
+  (*updates)++;
+  __atomic_store_n(sequence, *sequence + 1u, __ATOMIC_RELEASE);
+}
+
+/* Overwrites a record and sets its update count; the sequence still moves
+ * forward, so a reader that started before cannot mistake the new record for
+ * the old one */
+static void restoreRecord(uint32_t *sequence, uint32_t *updates, void *record, const void *copy, size_t size,
+                          uint32_t restored)
+{
+  beginWrite(sequence);
+  memcpy(record, copy, size);
+  *updates = restored;
+  __atomic_store_n(sequence, *sequence + 1u, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Copies a record written by a single update.
+ *
+ * @return The number of completed updates of the record.
+ */
+static uint32_t readRecord(const uint32_t *sequence, const uint32_t *updates, const void *record, void *copy,
+                           size_t size)
+{
+  uint32_t before;
+  uint32_t after;
+  uint32_t count;
+
+  do
+  {
+    before = __atomic_load_n(sequence, __ATOMIC_ACQUIRE);
+    memcpy(copy, record, size);
+    count = *updates;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    after = __atomic_load_n(sequence, __ATOMIC_RELAXED);
+  } while ((before & 1u) != 0 || before != after);
+
+  return count;
+}
+
+#if CFG_SENTENCE_GGA_ENABLED || CFG_SENTENCE_RMC_ENABLED
+static void updateCoordinates(NmeaNavPosition *position, float latitude, Polarity latitudePolarity, float longitude,
+                              Polarity longitudePolarity)
+{
+  position->latitude = nmeaDegrees(latitude, latitudePolarity);
+  position->longitude = nmeaDegrees(longitude, longitudePolarity);
+}
+#endif
+
+double nmeaDegrees(float value, Polarity polarity)
+{
+  double degrees = (double)(uint32_t)(value / 100.0f);
+  double result = degrees + ((double)value - degrees * 100.0) / 60.0;
+
+  return (polarity == SOUTH || polarity == WEST) ? -result : result;
+}
+
+#if CFG_SENTENCE_RMC_ENABLED || CFG_SENTENCE_VTG_ENABLED
+/* Writes the course and speed that are present; false if neither is */
+static bool updateMotion(NmeaNavState *state, uint32_t hasCourse, float course, uint32_t hasSpeed, float speed)
+{
+  if (hasCourse == 0 && hasSpeed == 0)
+  {
+    return false;
+  }
+  beginWrite(&state->motionSequence);
+  if (hasCourse != 0)
+  {
+    state->motion.courseOverGround = course;
+  }
+  if (hasSpeed != 0)
+  {
+    state->motion.speedOverGround = speed;
+  }
+  endWrite(&state->motionSequence, &state->motionUpdates);
+  return true;
+}
+#endif
+
+void nmeaNavStateInit(NmeaNavState *state)
+{
+  memset(state, 0, sizeof(*state));
+}
+
+bool nmeaNavStateUpdate(NmeaNavState *state, const NmeaSentence *sentence)
+{
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+  {
+    const SENTENCE_GGA *gga = &sentence->gga;
+    NmeaNavPosition *position = &state->position;
+
+    /* Without a fix the receiver still sends the time and the quality, so
+     * only the coordinates wait for a position */
+    beginWrite(&state->positionSequence);
+    if ((gga->presentFields & GGA_UTC_TIME_PRESENT) != 0)
+    {
+      position->utcTime = gga->utcTime;
+    }
+    if ((gga->presentFields & (GGA_LATITUDE_PRESENT | GGA_LONGITUDE_PRESENT)) ==
+        (GGA_LATITUDE_PRESENT | GGA_LONGITUDE_PRESENT))
+    {
+      updateCoordinates(position, gga->latitude, gga->latitudePolarity, gga->longitude, gga->longitudePolarity);
+    }
+    if ((gga->presentFields & GGA_ALTITUDE_PRESENT) != 0)
+    {
+      position->altitude = gga->altitude;
+    }
+    if ((gga->presentFields & GGA_HDOP_PRESENT) != 0)
+    {
+      position->hdop = gga->hdop;
+    }
+    if ((gga->presentFields & GGA_SATELLITES_IN_USE_PRESENT) != 0)
+    {
+      position->satellites = gga->satellitesInUse;
+    }
+    position->quality = (uint8_t)gga->qualityIndicator;
+    position->valid = gga->qualityIndicator != GPS_FIX_NOT_AVAILABLE;
+    endWrite(&state->positionSequence, &state->positionUpdates);
+    return true;
+  }
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+  {
+    const SENTENCE_RMC *rmc = &sentence->rmc;
+    NmeaNavPosition *position = &state->position;
+
+    beginWrite(&state->positionSequence);
+    if ((rmc->presentFields & RMC_UTC_TIME_PRESENT) != 0)
+    {
+      position->utcTime = rmc->utcTime;
+    }
+    if ((rmc->presentFields & (RMC_LATITUDE_PRESENT | RMC_LONGITUDE_PRESENT)) ==
+        (RMC_LATITUDE_PRESENT | RMC_LONGITUDE_PRESENT))
+    {
+      updateCoordinates(position, rmc->latitude, rmc->latitudePolarity, rmc->longitude, rmc->longitudePolarity);
+    }
+    if ((rmc->presentFields & RMC_DATE_PRESENT) != 0)
+    {
+      position->date = rmc->date;
+    }
+    position->valid = rmc->status == STATUS_VALID;
+    endWrite(&state->positionSequence, &state->positionUpdates);
+
+    updateMotion(state, rmc->presentFields & RMC_COURSE_OVER_GROUND_PRESENT, rmc->courseOverGround,
+                 rmc->presentFields & RMC_SPEED_OVER_GROUND_PRESENT, rmc->speedOverGround);
+    return true;
+  }
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  case VTG:
+  {
+    const SENTENCE_VTG *vtg = &sentence->vtg;
+
+    return updateMotion(state, vtg->presentFields & VTG_COURSE_OVER_GROUND_TRUE_PRESENT, vtg->courseOverGroundTrue,
+                        vtg->presentFields & VTG_SPEED_OVER_GROUND_KNOTS_PRESENT, vtg->speedOverGroundKnots);
+  }
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+  case HDT:
+    if ((sentence->hdt.presentFields & HDT_HEADING_PRESENT) == 0)
+    {
+      return false;
+    }
+    beginWrite(&state->headingSequence);
+    state->heading.heading = sentence->hdt.heading;
+    endWrite(&state->headingSequence, &state->headingUpdates);
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+void nmeaNavStateCallback(const NmeaSentence *sentence, void *context)
+{
+  nmeaNavStateUpdate((NmeaNavState *)context, sentence);
+}
+
+uint32_t nmeaNavStateReadPosition(const NmeaNavState *state, NmeaNavPosition *position)
+{
+  return readRecord(&state->positionSequence, &state->positionUpdates, &state->position, position,
+                    sizeof(*position));
+}
+
+uint32_t nmeaNavStateReadMotion(const NmeaNavState *state, NmeaNavMotion *motion)
+{
+  return readRecord(&state->motionSequence, &state->motionUpdates, &state->motion, motion,
+                    sizeof(*motion));
+}
+
+uint32_t nmeaNavStateReadHeading(const NmeaNavState *state, NmeaNavHeading *heading)
+{
+  return readRecord(&state->headingSequence, &state->headingUpdates, &state->heading, heading,
+                    sizeof(*heading));
+}
+
+void nmeaNavStateSnapshot(const NmeaNavState *state, NmeaNavSnapshot *snapshot)
+{
+  snapshot->positionUpdates = nmeaNavStateReadPosition(state, &snapshot->position);
+  snapshot->motionUpdates = nmeaNavStateReadMotion(state, &snapshot->motion);
+  snapshot->headingUpdates = nmeaNavStateReadHeading(state, &snapshot->heading);
+}
+
+void nmeaNavStateRestore(NmeaNavState *state, const NmeaNavSnapshot *snapshot)
+{
+  restoreRecord(&state->positionSequence, &state->positionUpdates, &state->position, &snapshot->position,
+                sizeof(state->position), snapshot->positionUpdates);
+  restoreRecord(&state->motionSequence, &state->motionUpdates, &state->motion, &snapshot->motion,
+                sizeof(state->motion), snapshot->motionUpdates);
+  restoreRecord(&state->headingSequence, &state->headingUpdates, &state->heading, &snapshot->heading,
+                sizeof(state->heading), snapshot->headingUpdates);
+}
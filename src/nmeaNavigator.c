@@ -0,0 +1,427 @@
+#include "nmeaNavigator.h"
+#include "nmea0183.h"
+
+#include <math.h>
+#include <string.h>
+
+#define DEGREES_TO_RADIANS (3.14159265358979323846 / 180.0)
+
+/* Wraps a bearing to [0, 360) */
+static inline double wrap360(double degrees)
+{
+  return degrees - 360.0 * floor(degrees / 360.0);
+}
+
+/* Wraps an angle difference to [-180, 180) */
+static double wrap180(double degrees)
+{
+  return degrees - 360.0 * floor((degrees + 180.0) / 360.0);
+}
+
+/* Copies a NUL terminated ID, truncating it to fit */
+static inline void copyId(char *target, size_t size, const char *id)
+{
+  size_t length = strlen(id);
+
+  if (length >= size)
+  {
+    length = size - 1u;
+  }
+  memcpy(target, id, length);
+  target[length] = '\0';
+}
+
+/* Converts the magnitude of signed degrees to a (d)ddmm.mm field, with the
+ * minutes rounded to the encoded decimals so that they never print as 60 */
+static inline float toField(double degrees, uint8_t decimals)
+{
+  double scale = pow(10.0, decimals);
+  double magnitude = fabs(degrees);
+  double whole = floor(magnitude);
+  double minutes = floor((magnitude - whole) * 60.0 * scale + 0.5);
+
+  if (minutes >= 60.0 * scale)
+  {
+    whole += 1.0;
+    minutes -= 60.0 * scale;
+  }
+  return (float)(whole * 100.0 + minutes / scale);
+}
+
+static inline Polarity polarityOf(double degrees, Polarity positive, Polarity negative)
+{
+  return degrees < 0.0 ? negative : positive;
+}
+
+static inline char steerDirection(const NmeaLegStatus *status)
+{
+  return status->crossTrackError > 0.0 ? 'L' : 'R';
+}
+
+static inline StatusField arrivalState(bool state)
+{
+  return state ? STATUS_VALID : STATUS_INVALID;
+}
+
+void nmeaNavigatorInit(NmeaNavigator *navigator, TalkerID talkerId)
+{
+  memset(navigator, 0, sizeof(*navigator));
+  navigator->talkerId = talkerId;
+  navigator->modeIndicator = 'A';
+}
+
+void nmeaNavigatorSetLeg(NmeaNavigator *navigator, const NmeaWaypoint *origin, const NmeaWaypoint *destination,
+                         NmeaLegType legType, double arrivalRadius)
+{
+  NmeaVector normal;
+
+  navigator->origin = *origin;
+  navigator->destination = *destination;
+  navigator->legType = legType;
+  navigator->arrivalRadius = arrivalRadius;
+  navigator->originVector = nmeaGeoVector(origin->latitude, origin->longitude);
+  navigator->destinationVector = nmeaGeoVector(destination->latitude, destination->longitude);
+
+  normal = nmeaGeoCross(&navigator->originVector, &navigator->destinationVector);
+  navigator->legNormal = nmeaGeoNormalise(&normal);
+  navigator->legForward = nmeaGeoCross(&navigator->legNormal, &navigator->destinationVector);
+
+  if (legType == NMEA_LEG_RHUMB_LINE)
+  {
+    navigator->legBearing =
+        nmeaRhumbBearing(origin->latitude, origin->longitude, destination->latitude, destination->longitude);
+    navigator->legLength =
+        nmeaRhumbDistance(origin->latitude, origin->longitude, destination->latitude, destination->longitude);
+  }
+  else
+  {
+    navigator->legBearing = nmeaGreatCircleBearing(&navigator->originVector, &navigator->destinationVector);
+    navigator->legLength = nmeaGreatCircleDistance(&navigator->originVector, &navigator->destinationVector);
+  }
+  navigator->hasLeg = true;
+  navigator->hasStatus = false;
+}
+
+void nmeaNavigatorSetVariation(NmeaNavigator *navigator, double variation)
+{
+  navigator->magneticVariation = variation;
+  navigator->hasVariation = true;
+}
+
+bool nmeaNavigatorUpdate(NmeaNavigator *navigator, const NmeaFix *fix, float utcTime)
+{
+  const NmeaWaypoint *destination = &navigator->destination;
+  NmeaLegStatus *status = &navigator->status;
+  NmeaVector position;
+
+  if (!navigator->hasLeg)
+  {
+    return false;
+  }
+
+  position = nmeaGeoVector(fix->latitude, fix->longitude);
+  status->greatCircleBearing = nmeaGreatCircleBearing(&position, &navigator->destinationVector);
+  status->greatCircleDistance = nmeaGreatCircleDistance(&position, &navigator->destinationVector);
+
+  if (navigator->legType == NMEA_LEG_RHUMB_LINE)
+  {
+    const NmeaWaypoint *origin = &navigator->origin;
+    double fromOrigin = nmeaRhumbDistance(origin->latitude, origin->longitude, fix->latitude, fix->longitude);
+    double offTrack = wrap180(nmeaRhumbBearing(origin->latitude, origin->longitude, fix->latitude, fix->longitude) -
+                              navigator->legBearing) *
+                      DEGREES_TO_RADIANS;
+
+    status->crossTrackError = fromOrigin * sin(offTrack);
+    status->perpendicularPassed = fromOrigin * cos(offTrack) >= navigator->legLength;
+    status->bearingToDestination =
+        nmeaRhumbBearing(fix->latitude, fix->longitude, destination->latitude, destination->longitude);
+    status->distanceToDestination =
+        nmeaRhumbDistance(fix->latitude, fix->longitude, destination->latitude, destination->longitude);
+  }
+  else
+  {
+    /* The leg normal points left of the track */
+    status->crossTrackError = -nmeaGreatCircleOffset(&navigator->legNormal, &position);
+    status->perpendicularPassed = nmeaGeoDot(&navigator->legForward, &position) > 0.0;
+    status->bearingToDestination = status->greatCircleBearing;
+    status->distanceToDestination = status->greatCircleDistance;
+  }
+
+  status->closingVelocity = 0.0;
+  if (fix->hasMotion)
+  {
+    status->closingVelocity = (double)fix->speedOverGround *
+                              cos(wrap180((double)fix->courseOverGround - status->bearingToDestination) *
+                                  DEGREES_TO_RADIANS);
+  }
+  status->arrivalCircleEntered = status->distanceToDestination <= navigator->arrivalRadius;
+  navigator->utcTime = utcTime;
+  navigator->hasStatus = true;
+  return true;
+}
+
+/*
+ * The fill functions only write the fields of the sentence's field mask, as
+ * with CFG_OMIT_MASKED_FIELDS the others are not part of the structure.
+ */
+
+#if CFG_SENTENCE_APB_ENABLED
+static void fillApb(const NmeaNavigator *navigator, SENTENCE_APB *apb)
+{
+  const NmeaLegStatus *status = &navigator->status;
+
+  (void)status;
+  apb->presentFields = CFG_SENTENCE_APB_FIELDS;
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS1_PRESENT
+  apb->status1 = STATUS_VALID;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS2_PRESENT
+  apb->status2 = STATUS_VALID;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_MAGNITUDE_PRESENT
+  apb->xteMagnitude = (float)fabs(status->crossTrackError);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_DIRECTION_PRESENT
+  apb->xteDirection = steerDirection(status);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_UNITS_PRESENT
+  apb->xteUnits = 'N';
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_ARRIVAL_CIRCLE_ENTERED_PRESENT
+  apb->arrivalCircleEntered = arrivalState(status->arrivalCircleEntered);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  apb->perpendicularPassedAtWaypoint = arrivalState(status->perpendicularPassed);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT
+  apb->bearingOriginToDestination = (float)navigator->legBearing;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT
+  apb->bearingOriginToDestinationReference = 'T';
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_DESTINATION_WAYPOINT_ID_PRESENT
+  copyId(apb->destinationWaypointID, sizeof(apb->destinationWaypointID), navigator->destination.id);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT
+  apb->bearingPresentPositionToDestination = (float)status->bearingToDestination;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT
+  apb->bearingPresentPositionToDestinationReference = 'T';
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT
+  apb->headingToSteerToDestinationWaypoint = (float)status->bearingToDestination;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT
+  apb->headingToSteerToDestinationWaypointReference = 'T';
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_MODE_INDICATOR_PRESENT
+  apb->modeIndicator = navigator->modeIndicator;
+#endif
+}
+#endif
+
+#if CFG_SENTENCE_XTE_ENABLED
+static void fillXte(const NmeaNavigator *navigator, SENTENCE_XTE *xte)
+{
+  (void)navigator;
+  xte->presentFields = CFG_SENTENCE_XTE_FIELDS;
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS1_PRESENT
+  xte->status1 = STATUS_VALID;
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS2_PRESENT
+  xte->status2 = STATUS_VALID;
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_MAGNITUDE_PRESENT
+  xte->xteMagnitude = (float)fabs(navigator->status.crossTrackError);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_DIRECTION_TO_STEER_PRESENT
+  xte->directionToSteer = steerDirection(&navigator->status);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_UNITS_PRESENT
+  xte->xteUnits = 'N';
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_MODE_INDICATOR_PRESENT
+  xte->modeIndicator = navigator->modeIndicator;
+#endif
+}
+#endif
+
+#if CFG_SENTENCE_BWC_ENABLED
+static void fillBwc(const NmeaNavigator *navigator, SENTENCE_BWC *bwc)
+{
+  const NmeaWaypoint *destination = &navigator->destination;
+
+  (void)destination;
+  bwc->presentFields = CFG_SENTENCE_BWC_FIELDS;
+  if (!navigator->hasVariation)
+  {
+    bwc->presentFields &= ~(BWC_BEARING_MAGNETIC_PRESENT | BWC_BEARING_MAGNETIC_REFERENCE_PRESENT);
+  }
+#if CFG_SENTENCE_BWC_FIELDS & BWC_UTC_TIME_PRESENT
+  bwc->utcTime = navigator->utcTime;
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_PRESENT
+  bwc->waypointLatitude = toField(destination->latitude, NMEA_LATITUDE_DECIMALS);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT
+  bwc->waypointLatitudePolarity = polarityOf(destination->latitude, NORTH, SOUTH);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_PRESENT
+  bwc->waypointLongitude = toField(destination->longitude, NMEA_LONGITUDE_DECIMALS);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT
+  bwc->waypointLongitudePolarity = polarityOf(destination->longitude, EAST, WEST);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_PRESENT
+  bwc->bearingTrue = (float)navigator->status.greatCircleBearing;
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_REFERENCE_PRESENT
+  bwc->bearingTrueReference = 'T';
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_PRESENT
+  bwc->bearingMagnetic = (float)wrap360(navigator->status.greatCircleBearing - navigator->magneticVariation);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_REFERENCE_PRESENT
+  bwc->bearingMagneticReference = 'M';
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_PRESENT
+  bwc->distance = (float)navigator->status.greatCircleDistance;
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_UNITS_PRESENT
+  bwc->distanceUnits = 'N';
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_ID_PRESENT
+  copyId(bwc->waypointID, sizeof(bwc->waypointID), destination->id);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_MODE_INDICATOR_PRESENT
+  bwc->modeIndicator = navigator->modeIndicator;
+#endif
+}
+#endif
+
+#if CFG_SENTENCE_RMB_ENABLED
+static void fillRmb(const NmeaNavigator *navigator, SENTENCE_RMB *rmb)
+{
+  const NmeaLegStatus *status = &navigator->status;
+  const NmeaWaypoint *destination = &navigator->destination;
+
+  (void)status;
+  (void)destination;
+  rmb->presentFields = CFG_SENTENCE_RMB_FIELDS;
+#if CFG_SENTENCE_RMB_FIELDS & RMB_STATUS_PRESENT
+  rmb->status = STATUS_VALID;
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_XTE_MAGNITUDE_PRESENT
+  rmb->xteMagnitude = (float)fabs(status->crossTrackError);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DIRECTION_TO_STEER_PRESENT
+  rmb->directionToSteer = steerDirection(status);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ORIGIN_WAYPOINT_ID_PRESENT
+  copyId(rmb->originWaypointID, sizeof(rmb->originWaypointID), navigator->origin.id);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_WAYPOINT_ID_PRESENT
+  copyId(rmb->destinationWaypointID, sizeof(rmb->destinationWaypointID), destination->id);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_PRESENT
+  rmb->destinationLatitude = toField(destination->latitude, NMEA_LATITUDE_DECIMALS);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_POLARITY_PRESENT
+  rmb->destinationLatitudePolarity = polarityOf(destination->latitude, NORTH, SOUTH);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_PRESENT
+  rmb->destinationLongitude = toField(destination->longitude, NMEA_LONGITUDE_DECIMALS);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT
+  rmb->destinationLongitudePolarity = polarityOf(destination->longitude, EAST, WEST);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_RANGE_TO_DESTINATION_PRESENT
+  rmb->rangeToDestination = (float)status->distanceToDestination;
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_BEARING_TO_DESTINATION_PRESENT
+  rmb->bearingToDestination = (float)status->bearingToDestination;
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_CLOSING_VELOCITY_PRESENT
+  rmb->closingVelocity = (float)status->closingVelocity;
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ARRIVAL_STATUS_PRESENT
+  rmb->arrivalStatus = arrivalState(status->arrivalCircleEntered || status->perpendicularPassed);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_MODE_INDICATOR_PRESENT
+  rmb->modeIndicator = navigator->modeIndicator;
+#endif
+}
+#endif
+
+#if CFG_SENTENCE_BOD_ENABLED
+static void fillBod(const NmeaNavigator *navigator, SENTENCE_BOD *bod)
+{
+  bod->presentFields = CFG_SENTENCE_BOD_FIELDS;
+  if (!navigator->hasVariation)
+  {
+    bod->presentFields &= ~(BOD_BEARING_MAGNETIC_PRESENT | BOD_BEARING_MAGNETIC_REFERENCE_PRESENT);
+  }
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_PRESENT
+  bod->bearingTrue = (float)navigator->legBearing;
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_REFERENCE_PRESENT
+  bod->bearingTrueReference = 'T';
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_PRESENT
+  bod->bearingMagnetic = (float)wrap360(navigator->legBearing - navigator->magneticVariation);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_REFERENCE_PRESENT
+  bod->bearingMagneticReference = 'M';
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_DESTINATION_WAYPOINT_ID_PRESENT
+  copyId(bod->destinationWaypointID, sizeof(bod->destinationWaypointID), navigator->destination.id);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_ORIGIN_WAYPOINT_ID_PRESENT
+  copyId(bod->originWaypointID, sizeof(bod->originWaypointID), navigator->origin.id);
+#endif
+}
+#endif
+
+NmeaStatus nmeaNavigatorEncode(NmeaNavigator *navigator, SentenceID sentenceId, char *buffer, size_t size,
+                               size_t *length)
+{
+  NmeaSentence *sentence = &navigator->sentence;
+
+  if (!navigator->hasStatus)
+  {
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+  switch (sentenceId)
+  {
+#if CFG_SENTENCE_APB_ENABLED
+  case APB:
+    fillApb(navigator, &sentence->apb);
+    break;
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+  case XTE:
+    fillXte(navigator, &sentence->xte);
+    break;
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  case BWC:
+    fillBwc(navigator, &sentence->bwc);
+    break;
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  case RMB:
+    fillRmb(navigator, &sentence->rmb);
+    break;
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+  case BOD:
+    fillBod(navigator, &sentence->bod);
+    break;
+#endif
+  default:
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+  sentence->addressField.talkerId = navigator->talkerId;
+  sentence->addressField.sentenceId = sentenceId;
+  return nmeaEncode(sentence, buffer, size, length);
+}
@@ -0,0 +1,231 @@
+#include "nmeaPositionHistory.h"
+#include "nmeaNavState.h"
+
+#include <math.h>
+#include <string.h>
+
+#if CFG_SENTENCE_RMC_ENABLED
+/* Course and speed are optional: a mask without them gives fixes without motion */
+#define RMC_MOTION_FIELDS (RMC_COURSE_OVER_GROUND_PRESENT | RMC_SPEED_OVER_GROUND_PRESENT)
+
+/* With CFG_OMIT_MASKED_FIELDS the RMC field mask must keep the fields read here */
+#if CFG_OMIT_MASKED_FIELDS
+#define RMC_READ_FIELDS                                                                                            \
+  (RMC_STATUS_PRESENT | RMC_LATITUDE_PRESENT | RMC_LATITUDE_POLARITY_PRESENT | RMC_LONGITUDE_PRESENT |             \
+   RMC_LONGITUDE_POLARITY_PRESENT)
+#if (CFG_SENTENCE_RMC_FIELDS & RMC_READ_FIELDS) != RMC_READ_FIELDS
+#error "nmeaPositionHistory.c reads RMC status and position"
+#endif
+#endif
+#endif
+
+#define DEGREES_TO_RADIANS (3.14159265358979323846 / 180.0)
+
+/* A knot is one minute of latitude per hour */
+#define KNOTS_TO_DEGREES_PER_MS (1.0 / (60.0 * 3600000.0))
+
+/* Keeps the east velocity finite at the poles */
+#define MIN_LATITUDE_COSINE 1e-6
+
+/* Wraps an angle difference to [-180, 180) */
+static double wrap180(double degrees)
+{
+  return degrees - 360.0 * floor((degrees + 180.0) / 360.0);
+}
+
+/* Wraps a course to [0, 360) */
+static double wrap360(double degrees)
+{
+  return degrees - 360.0 * floor(degrees / 360.0);
+}
+
+/* The fix at position index (0 = oldest) of the ring */
+static const NmeaFix *fixAt(const NmeaPositionHistory *history, uint16_t index)
+{
+  uint32_t oldest = (uint32_t)history->newest + NMEA_POSITION_HISTORY_LENGTH + 1u - history->count;
+
+  return &history->fixes[(oldest + index) % NMEA_POSITION_HISTORY_LENGTH];
+}
+
+/* Velocity of a fix in degrees of latitude and longitude per millisecond,
+ * zero for a fix without motion */
+static void velocity(const NmeaFix *fix, double *north, double *east)
+{
+  double course = (double)fix->courseOverGround * DEGREES_TO_RADIANS;
+  double speed = fix->hasMotion ? (double)fix->speedOverGround * KNOTS_TO_DEGREES_PER_MS : 0.0;
+  double latitudeCosine = cos(fix->latitude * DEGREES_TO_RADIANS);
+
+  if (latitudeCosine < MIN_LATITUDE_COSINE)
+  {
+    latitudeCosine = MIN_LATITUDE_COSINE;
+  }
+  *north = speed * cos(course);
+  *east = speed * sin(course) / latitudeCosine;
+}
+
+static void deadReckon(const NmeaFix *fix, int64_t timeMs, NmeaFix *position)
+{
+  double elapsed = (double)(timeMs - fix->timeMs);
+  double north;
+  double east;
+
+  velocity(fix, &north, &east);
+  *position = *fix;
+  position->timeMs = timeMs;
+  position->latitude = fix->latitude + north * elapsed;
+  position->longitude = wrap180(fix->longitude + east * elapsed);
+}
+
+static void interpolate(const NmeaFix *from, const NmeaFix *to, int64_t timeMs, NmeaInterpolation method,
+                        NmeaFix *position)
+{
+  double interval = (double)(to->timeMs - from->timeMs);
+  double s = (double)(timeMs - from->timeMs) / interval;
+  double latitudeChange = to->latitude - from->latitude;
+  /* The short way round, also across the antimeridian */
+  double longitudeChange = wrap180(to->longitude - from->longitude);
+
+  position->timeMs = timeMs;
+  if (method == NMEA_INTERPOLATE_HERMITE)
+  {
+    /* Cubic Hermite basis with the fix velocities as tangents */
+    double s2 = s * s;
+    double s3 = s2 * s;
+    double h10 = (s3 - 2.0 * s2 + s) * interval;
+    double h01 = 3.0 * s2 - 2.0 * s3;
+    double h11 = (s3 - s2) * interval;
+    double fromNorth;
+    double fromEast;
+    double toNorth;
+    double toEast;
+
+    velocity(from, &fromNorth, &fromEast);
+    velocity(to, &toNorth, &toEast);
+    /* Unknown motion: the chord, which leaves the curve straight at that end */
+    if (!from->hasMotion)
+    {
+      fromNorth = latitudeChange / interval;
+      fromEast = longitudeChange / interval;
+    }
+    if (!to->hasMotion)
+    {
+      toNorth = latitudeChange / interval;
+      toEast = longitudeChange / interval;
+    }
+    position->latitude = from->latitude + h10 * fromNorth + h01 * latitudeChange + h11 * toNorth;
+    position->longitude = wrap180(from->longitude + h10 * fromEast + h01 * longitudeChange + h11 * toEast);
+  }
+  else
+  {
+    position->latitude = from->latitude + s * latitudeChange;
+    position->longitude = wrap180(from->longitude + s * longitudeChange);
+  }
+  /* Course and speed of the fix that has them, if only one does */
+  if (!from->hasMotion || !to->hasMotion)
+  {
+    const NmeaFix *moving = from->hasMotion ? from : to;
+
+    position->courseOverGround = moving->courseOverGround;
+    position->speedOverGround = moving->speedOverGround;
+    position->hasMotion = moving->hasMotion;
+    return;
+  }
+  position->courseOverGround = (float)wrap360(
+      (double)from->courseOverGround + s * wrap180((double)to->courseOverGround - (double)from->courseOverGround));
+  position->speedOverGround =
+      (float)((double)from->speedOverGround + s * ((double)to->speedOverGround - (double)from->speedOverGround));
+  position->hasMotion = true;
+}
+
+void nmeaHistoryInit(NmeaPositionHistory *history)
+{
+  memset(history, 0, sizeof(*history));
+  history->newest = NMEA_POSITION_HISTORY_LENGTH - 1u;
+}
+
+bool nmeaHistoryAdd(NmeaPositionHistory *history, const NmeaFix *fix)
+{
+  if (history->count > 0 && fix->timeMs <= history->fixes[history->newest].timeMs)
+  {
+    return false;
+  }
+  history->newest = (uint16_t)((history->newest + 1u) % NMEA_POSITION_HISTORY_LENGTH);
+  history->fixes[history->newest] = *fix;
+  if (history->count < NMEA_POSITION_HISTORY_LENGTH)
+  {
+    history->count++;
+  }
+  return true;
+}
+
+bool nmeaHistoryAddSentence(NmeaPositionHistory *history, const NmeaSentence *sentence, int64_t timeMs)
+{
+#if CFG_SENTENCE_RMC_ENABLED
+  const SENTENCE_RMC *rmc = &sentence->rmc;
+  NmeaFix fix;
+
+  if (sentence->addressField.sentenceId != RMC || rmc->status != STATUS_VALID ||
+      (rmc->presentFields & (RMC_LATITUDE_PRESENT | RMC_LONGITUDE_PRESENT)) !=
+          (RMC_LATITUDE_PRESENT | RMC_LONGITUDE_PRESENT))
+  {
+    return false;
+  }
+  fix.timeMs = timeMs;
+  fix.latitude = nmeaDegrees(rmc->latitude, rmc->latitudePolarity);
+  fix.longitude = nmeaDegrees(rmc->longitude, rmc->longitudePolarity);
+  /* A null course or speed would read as 0, which is not the same as standing still */
+  fix.hasMotion = false;
+  fix.courseOverGround = 0.0f;
+  fix.speedOverGround = 0.0f;
+#if (CFG_SENTENCE_RMC_FIELDS & RMC_MOTION_FIELDS) == RMC_MOTION_FIELDS
+  if ((rmc->presentFields & RMC_MOTION_FIELDS) == RMC_MOTION_FIELDS)
+  {
+    fix.hasMotion = true;
+    fix.courseOverGround = rmc->courseOverGround;
+    fix.speedOverGround = rmc->speedOverGround;
+  }
+#endif
+  return nmeaHistoryAdd(history, &fix);
+#else
+  (void)history;
+  (void)sentence;
+  (void)timeMs;
+  return false;
+#endif
+}
+
+NmeaPositionSource nmeaHistoryPositionAt(const NmeaPositionHistory *history, int64_t timeMs,
+                                         NmeaInterpolation method, NmeaFix *position)
+{
+  const NmeaFix *newest = &history->fixes[history->newest];
+  uint16_t low = 0;
+  uint16_t high;
+
+  if (history->count == 0 || timeMs < fixAt(history, 0)->timeMs)
+  {
+    return NMEA_POSITION_UNAVAILABLE;
+  }
+  if (timeMs >= newest->timeMs)
+  {
+    deadReckon(newest, timeMs, position);
+    return timeMs == newest->timeMs ? NMEA_POSITION_INTERPOLATED : NMEA_POSITION_EXTRAPOLATED;
+  }
+
+  /* Last fix at or before timeMs: fixAt(low) <= timeMs < fixAt(high) */
+  high = (uint16_t)(history->count - 1u);
+  while (high - low > 1)
+  {
+    uint16_t middle = (uint16_t)((low + high) / 2u);
+
+    if (fixAt(history, middle)->timeMs <= timeMs)
+    {
+      low = middle;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  interpolate(fixAt(history, low), fixAt(history, high), timeMs, method, position);
+  return NMEA_POSITION_INTERPOLATED;
+}
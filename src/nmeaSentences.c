@@ -0,0 +1,4422 @@
+/* Generated by tools/nmeagen.py from spec/sentences.json, do not edit. */
+
+#include "nmeaSentences.h"
+
+#if CFG_SENTENCE_AAM_ENABLED
+static bool decodeAAM(NmeaCursor *cursor, uint8_t checksum, SENTENCE_AAM *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & (AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT | AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->arrivalCircledEntered = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->perpendicularPassedAtWaypoint = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->arrivalCircleRadius);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_RADIUS_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AAM_RADIUS_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->radiusUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AAM_FIELDS & AAM_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AAM_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->waypointID, sizeof(sentence->waypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeAAM(const SENTENCE_AAM *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT
+  if (sentence->presentFields & AAM_ARRIVAL_CIRCLED_ENTERED_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->arrivalCircledEntered);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AAM_FIELDS & AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  if (sentence->presentFields & AAM_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->perpendicularPassedAtWaypoint);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AAM_FIELDS & AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT
+  if (sentence->presentFields & AAM_ARRIVAL_CIRCLE_RADIUS_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->arrivalCircleRadius, 1, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AAM_FIELDS & AAM_RADIUS_UNITS_PRESENT
+  if (sentence->presentFields & AAM_RADIUS_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->radiusUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AAM_FIELDS & AAM_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & AAM_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->waypointID);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_AAM_ENABLED
+
+#if CFG_SENTENCE_ABK_ENABLED
+static bool decodeABK(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ABK *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ABK_FIELDS & ABK_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ABK_FIELDS & (ABK_MMSI_CHANNEL_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_ADDRESS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABK_MMSI_ADDRESS_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->mmsiAddress);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_CHANNEL_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABK_MMSI_CHANNEL_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->mmsiChannel = (AISChannel)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABK_FIELDS & ABK_M1373_MESSAGE_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABK_M1373_MESSAGE_ID_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->m1373MessageId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageSequenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABK_FIELDS & ABK_ACKNOWLEDGEMENT_TYPE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABK_ACKNOWLEDGEMENT_TYPE_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->acknowledgementType);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeABK(const SENTENCE_ABK *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_ADDRESS_PRESENT
+  if (sentence->presentFields & ABK_MMSI_ADDRESS_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->mmsiAddress, 9);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MMSI_CHANNEL_PRESENT
+  if (sentence->presentFields & ABK_MMSI_CHANNEL_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->mmsiChannel);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABK_FIELDS & ABK_M1373_MESSAGE_ID_PRESENT
+  if (sentence->presentFields & ABK_M1373_MESSAGE_ID_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->m1373MessageId, 1, 0);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABK_FIELDS & ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ABK_MESSAGE_SEQUENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageSequenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABK_FIELDS & ABK_ACKNOWLEDGEMENT_TYPE_PRESENT
+  if (sentence->presentFields & ABK_ACKNOWLEDGEMENT_TYPE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->acknowledgementType, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ABK_ENABLED
+
+#if CFG_SENTENCE_ABM_ENABLED
+static bool decodeABM(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ABM *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ABM_FIELDS & ABM_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_ABM_FIELDS & ABM_TOTAL_SENTENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_TOTAL_SENTENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->totalSentenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_SENTENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_SENTENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sentenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_SEQUENTIAL_MESSAGE_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_SEQUENTIAL_MESSAGE_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sequentialMessageId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_MMSI_ADDRESS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_MMSI_ADDRESS_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->mmsiAddress);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_AIS_CHANNEL_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_AIS_CHANNEL_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->aisChannel);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_M1373_MESSAGE_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_M1373_MESSAGE_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->m1373MessageId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_ENCAPSULATED_DATA_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_ENCAPSULATED_DATA_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->encapsulatedData, sizeof(sentence->encapsulatedData));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ABM_FIELDS & ABM_NUMBER_FILL_BITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ABM_NUMBER_FILL_BITS_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->numberFillBits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeABM(const SENTENCE_ABM *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_TOTAL_SENTENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ABM_TOTAL_SENTENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->totalSentenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_SENTENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ABM_SENTENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sentenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_SEQUENTIAL_MESSAGE_ID_PRESENT
+  if (sentence->presentFields & ABM_SEQUENTIAL_MESSAGE_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sequentialMessageId, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_MMSI_ADDRESS_PRESENT
+  if (sentence->presentFields & ABM_MMSI_ADDRESS_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->mmsiAddress, 9);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_AIS_CHANNEL_PRESENT
+  if (sentence->presentFields & ABM_AIS_CHANNEL_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->aisChannel, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_M1373_MESSAGE_ID_PRESENT
+  if (sentence->presentFields & ABM_M1373_MESSAGE_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->m1373MessageId, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_ENCAPSULATED_DATA_PRESENT
+  if (sentence->presentFields & ABM_ENCAPSULATED_DATA_PRESENT)
+  {
+    nmeaPutText(writer, sentence->encapsulatedData);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ABM_FIELDS & ABM_NUMBER_FILL_BITS_PRESENT
+  if (sentence->presentFields & ABM_NUMBER_FILL_BITS_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->numberFillBits, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ABM_ENABLED
+
+#if CFG_SENTENCE_ACA_ENABLED
+static bool decodeACA(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ACA *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ACA_FIELDS & ACA_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & (ACA_NE_LATITUDE_POLARITY_PRESENT | ACA_NE_LONGITUDE_POLARITY_PRESENT | \
+    ACA_SW_LATITUDE_POLARITY_PRESENT | ACA_SW_LONGITUDE_POLARITY_PRESENT | ACA_INFO_SOURCE_PRESENT)
+  char c;
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & (ACA_CHANNEL_ABANDWIDTH_PRESENT | ACA_CHANNEL_BBANDWIDTH_PRESENT | \
+    ACA_TX_RX_MODE_PRESENT | ACA_POWER_LEVEL_PRESENT)
+  uint8_t u8;
+#endif
+
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SEQUENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_SEQUENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sequenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_NE_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->neLatitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_NE_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->neLatitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_NE_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->neLongitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_NE_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->neLongitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_SW_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->swLatitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_SW_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->swLatitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_SW_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->swLongitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_SW_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->swLongitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_TRANSITION_ZONE_SIZE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_TRANSITION_ZONE_SIZE_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->transitionZoneSize);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_A_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_CHANNEL_A_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->channelA);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_ABANDWIDTH_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_CHANNEL_ABANDWIDTH_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &u8);
+  sentence->channelABandwidth = (ChannelBandwidth)u8;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_B_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_CHANNEL_B_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->channelB);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_BBANDWIDTH_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_CHANNEL_BBANDWIDTH_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &u8);
+  sentence->channelBBandwidth = (ChannelBandwidth)u8;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_TX_RX_MODE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_TX_RX_MODE_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &u8);
+  sentence->txRxMode = (TxRxModeControl)u8;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_POWER_LEVEL_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_POWER_LEVEL_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &u8);
+  sentence->powerLevel = (TxPowerLevel)u8;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_INFO_SOURCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_INFO_SOURCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->infoSource = (ACAInfoSource)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_FLAG_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_IN_USE_FLAG_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->inUseFlag);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_CHANGE_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACA_IN_USE_CHANGE_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->inUseChangeTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeACA(const SENTENCE_ACA *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SEQUENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ACA_SEQUENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sequenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_PRESENT
+  if (sentence->presentFields & ACA_NE_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->neLatitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & ACA_NE_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->neLatitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_PRESENT
+  if (sentence->presentFields & ACA_NE_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->neLongitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_NE_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & ACA_NE_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->neLongitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_PRESENT
+  if (sentence->presentFields & ACA_SW_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->swLatitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & ACA_SW_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->swLatitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_PRESENT
+  if (sentence->presentFields & ACA_SW_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->swLongitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_SW_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & ACA_SW_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->swLongitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_TRANSITION_ZONE_SIZE_PRESENT
+  if (sentence->presentFields & ACA_TRANSITION_ZONE_SIZE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->transitionZoneSize, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_A_PRESENT
+  if (sentence->presentFields & ACA_CHANNEL_A_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->channelA, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_ABANDWIDTH_PRESENT
+  if (sentence->presentFields & ACA_CHANNEL_ABANDWIDTH_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->channelABandwidth, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_B_PRESENT
+  if (sentence->presentFields & ACA_CHANNEL_B_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->channelB, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_CHANNEL_BBANDWIDTH_PRESENT
+  if (sentence->presentFields & ACA_CHANNEL_BBANDWIDTH_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->channelBBandwidth, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_TX_RX_MODE_PRESENT
+  if (sentence->presentFields & ACA_TX_RX_MODE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->txRxMode, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_POWER_LEVEL_PRESENT
+  if (sentence->presentFields & ACA_POWER_LEVEL_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->powerLevel, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_INFO_SOURCE_PRESENT
+  if (sentence->presentFields & ACA_INFO_SOURCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->infoSource);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_FLAG_PRESENT
+  if (sentence->presentFields & ACA_IN_USE_FLAG_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->inUseFlag, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACA_FIELDS & ACA_IN_USE_CHANGE_TIME_PRESENT
+  if (sentence->presentFields & ACA_IN_USE_CHANGE_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->inUseChangeTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ACA_ENABLED
+
+#if CFG_SENTENCE_ACK_ENABLED
+static bool decodeACK(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ACK *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ACK_FIELDS & ACK_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_ACK_FIELDS & ACK_ALARM_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACK_ALARM_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alarmId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeACK(const SENTENCE_ACK *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACK_FIELDS & ACK_ALARM_ID_PRESENT
+  if (sentence->presentFields & ACK_ALARM_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alarmId, 3);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ACK_ENABLED
+
+#if CFG_SENTENCE_ACN_ENABLED
+static bool decodeACN(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ACN *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & (ACN_ALERT_COMMAND_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ACN_FIELDS & ACN_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->time);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & ACN_MANUFACTURER_MNEMONIC_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_MANUFACTURER_MNEMONIC_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->manufacturerMnemonic, sizeof(sentence->manufacturerMnemonic));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_ALERT_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_INSTANCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_ALERT_INSTANCE_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertInstance);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_COMMAND_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_ALERT_COMMAND_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alertCommand = (AlertAcknowledgedState)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACN_FIELDS & ACN_STATUS_FLAG_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACN_STATUS_FLAG_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->statusFlag);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeACN(const SENTENCE_ACN *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_TIME_PRESENT
+  if (sentence->presentFields & ACN_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->time, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_MANUFACTURER_MNEMONIC_PRESENT
+  if (sentence->presentFields & ACN_MANUFACTURER_MNEMONIC_PRESENT)
+  {
+    nmeaPutText(writer, sentence->manufacturerMnemonic);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_ID_PRESENT
+  if (sentence->presentFields & ACN_ALERT_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertId, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_INSTANCE_PRESENT
+  if (sentence->presentFields & ACN_ALERT_INSTANCE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertInstance, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_ALERT_COMMAND_PRESENT
+  if (sentence->presentFields & ACN_ALERT_COMMAND_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alertCommand);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACN_FIELDS & ACN_STATUS_FLAG_PRESENT
+  if (sentence->presentFields & ACN_STATUS_FLAG_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->statusFlag);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ACN_ENABLED
+
+#if CFG_SENTENCE_ACS_ENABLED
+static bool decodeACS(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ACS *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ACS_FIELDS & ACS_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_ACS_FIELDS & ACS_SEQUENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_SEQUENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sequenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACS_FIELDS & ACS_MMSI_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_MMSI_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->mmsi);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACS_FIELDS & ACS_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->time);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACS_FIELDS & ACS_DAY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_DAY_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->day);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACS_FIELDS & ACS_MONTH_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_MONTH_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->month);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ACS_FIELDS & ACS_YEAR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ACS_YEAR_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->year);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeACS(const SENTENCE_ACS *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_SEQUENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ACS_SEQUENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sequenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_MMSI_PRESENT
+  if (sentence->presentFields & ACS_MMSI_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->mmsi, 9);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_TIME_PRESENT
+  if (sentence->presentFields & ACS_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->time, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_DAY_PRESENT
+  if (sentence->presentFields & ACS_DAY_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->day, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_MONTH_PRESENT
+  if (sentence->presentFields & ACS_MONTH_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->month, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ACS_FIELDS & ACS_YEAR_PRESENT
+  if (sentence->presentFields & ACS_YEAR_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->year, 4);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ACS_ENABLED
+
+#if CFG_SENTENCE_AIR_ENABLED
+static bool decodeAIR(NmeaCursor *cursor, uint8_t checksum, SENTENCE_AIR *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_AIR_FIELDS & AIR_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & (AIR_INTERROGATION_CHANNEL_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MMSI_INTERROGATED_STATION1_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->mmsiInterrogatedStation1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_NUMBER1_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageNumber1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_SUBSECTION1_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageSubsection1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_NUMBER2_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageNumber2);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_SUBSECTION2_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageSubsection2);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MMSI_INTERROGATED_STATION2_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->mmsiInterrogatedStation2);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER3_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_NUMBER3_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageNumber3);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION3_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_SUBSECTION3_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->messageSubsection3);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_INTERROGATION_CHANNEL_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_INTERROGATION_CHANNEL_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->interrogationChannel = (AISChannel)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_ID1_1_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->messageID1_1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_ID1_2_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->messageID1_2);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID2_1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AIR_MESSAGE_ID2_1_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->messageID2_1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeAIR(const SENTENCE_AIR *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION1_PRESENT
+  if (sentence->presentFields & AIR_MMSI_INTERROGATED_STATION1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->mmsiInterrogatedStation1, 9);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER1_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_NUMBER1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageNumber1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION1_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_SUBSECTION1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageSubsection1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER2_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_NUMBER2_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageNumber2, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION2_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_SUBSECTION2_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageSubsection2, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MMSI_INTERROGATED_STATION2_PRESENT
+  if (sentence->presentFields & AIR_MMSI_INTERROGATED_STATION2_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->mmsiInterrogatedStation2, 9);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_NUMBER3_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_NUMBER3_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageNumber3, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_SUBSECTION3_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_SUBSECTION3_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageSubsection3, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_INTERROGATION_CHANNEL_PRESENT
+  if (sentence->presentFields & AIR_INTERROGATION_CHANNEL_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->interrogationChannel);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_1_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_ID1_1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageID1_1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID1_2_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_ID1_2_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageID1_2, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AIR_FIELDS & AIR_MESSAGE_ID2_1_PRESENT
+  if (sentence->presentFields & AIR_MESSAGE_ID2_1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->messageID2_1, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_AIR_ENABLED
+
+#if CFG_SENTENCE_AKD_ENABLED
+static bool decodeAKD(NmeaCursor *cursor, uint8_t checksum, SENTENCE_AKD *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_AKD_FIELDS & AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->timeOfAcknowledgement);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originalSystemIndicator, sizeof(sentence->originalSystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originalSubsystemIndicator, sizeof(sentence->originalSubsystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_INSTANCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_INSTANCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->instanceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ALARM_TYPE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ALARM_TYPE_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->alarmType);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ACK_SYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->ackSystemIndicator, sizeof(sentence->ackSystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->ackSubsystemIndicator, sizeof(sentence->ackSubsystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_INSTANCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? AKD_ACK_INSTANCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->ackInstanceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeAKD(const SENTENCE_AKD *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT
+  if (sentence->presentFields & AKD_TIME_OF_ACKNOWLEDGEMENT_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->timeOfAcknowledgement, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & AKD_ORIGINAL_SYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originalSystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & AKD_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originalSubsystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_INSTANCE_NUMBER_PRESENT
+  if (sentence->presentFields & AKD_INSTANCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->instanceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ALARM_TYPE_PRESENT
+  if (sentence->presentFields & AKD_ALARM_TYPE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alarmType, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & AKD_ACK_SYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->ackSystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & AKD_ACK_SUBSYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->ackSubsystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_AKD_FIELDS & AKD_ACK_INSTANCE_NUMBER_PRESENT
+  if (sentence->presentFields & AKD_ACK_INSTANCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->ackInstanceNumber, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_AKD_ENABLED
+
+#if CFG_SENTENCE_ALA_ENABLED
+static bool decodeALA(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ALA *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & (ALA_ALARM_CONDITION_PRESENT | ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ALA_FIELDS & ALA_EVENT_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_EVENT_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->eventTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originalSystemIndicator, sizeof(sentence->originalSystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originalSubsystemIndicator, sizeof(sentence->originalSubsystemIndicator));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_INSTANCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_INSTANCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->instanceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_TYPE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ALARM_TYPE_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->alarmType);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_CONDITION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ALARM_CONDITION_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alarmCondition = (AlarmCondition)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alarmAcknowledgedState = (AlarmAcknowledgedState)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_DESCRIPTION_TEXT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALA_ALARM_DESCRIPTION_TEXT_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->alarmDescriptionText, sizeof(sentence->alarmDescriptionText));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeALA(const SENTENCE_ALA *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_EVENT_TIME_PRESENT
+  if (sentence->presentFields & ALA_EVENT_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->eventTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & ALA_ORIGINAL_SYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originalSystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT
+  if (sentence->presentFields & ALA_ORIGINAL_SUBSYSTEM_INDICATOR_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originalSubsystemIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_INSTANCE_NUMBER_PRESENT
+  if (sentence->presentFields & ALA_INSTANCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->instanceNumber, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_TYPE_PRESENT
+  if (sentence->presentFields & ALA_ALARM_TYPE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alarmType, 3);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_CONDITION_PRESENT
+  if (sentence->presentFields & ALA_ALARM_CONDITION_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alarmCondition);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT
+  if (sentence->presentFields & ALA_ALARM_ACKNOWLEDGED_STATE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alarmAcknowledgedState);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALA_FIELDS & ALA_ALARM_DESCRIPTION_TEXT_PRESENT
+  if (sentence->presentFields & ALA_ALARM_DESCRIPTION_TEXT_PRESENT)
+  {
+    nmeaPutText(writer, sentence->alarmDescriptionText);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ALA_ENABLED
+
+#if CFG_SENTENCE_ALC_ENABLED
+static bool decodeALC(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ALC *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+  NmeaField field;
+  uint8_t i;
+
+#if CFG_SENTENCE_ALC_FIELDS & ALC_TOTAL_SENTENCES_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALC_TOTAL_SENTENCES_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->totalSentences);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALC_FIELDS & ALC_SENTENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALC_SENTENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sentenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALC_FIELDS & ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sequentialMessageIdentifier);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALC_NUMBER_OF_ALERT_ENTRIES_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->numberOfAlertEntries);
+  if (sentence->numberOfAlertEntries > ALC_MAX_ALERT_ENTRIES)
+  {
+    return false;
+  }
+  for (i = 0; i < sentence->numberOfAlertEntries; i++)
+  {
+    AlertEntry *entry = &sentence->alertEntries[i];
+    ok &= nmeaFieldToText(nmeaNextField(cursor), entry->manufacturerMnemonic, sizeof(entry->manufacturerMnemonic));
+    ok &= nmeaFieldToUint32(nmeaNextField(cursor), &entry->alertIdentifier);
+    ok &= nmeaFieldToUint32(nmeaNextField(cursor), &entry->alertInstance);
+    ok &= nmeaFieldToUint8(nmeaNextField(cursor), &entry->revisionCounter);
+  }
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeALC(const SENTENCE_ALC *sentence, NmeaWriter *writer)
+{
+  uint8_t i;
+
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALC_FIELDS & ALC_TOTAL_SENTENCES_PRESENT
+  if (sentence->presentFields & ALC_TOTAL_SENTENCES_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->totalSentences, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALC_FIELDS & ALC_SENTENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ALC_SENTENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sentenceNumber, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALC_FIELDS & ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT
+  if (sentence->presentFields & ALC_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sequentialMessageIdentifier, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+  if (sentence->presentFields & ALC_NUMBER_OF_ALERT_ENTRIES_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->numberOfAlertEntries, 1);
+  }
+  for (i = 0; i < sentence->numberOfAlertEntries && i < ALC_MAX_ALERT_ENTRIES; i++)
+  {
+    const AlertEntry *entry = &sentence->alertEntries[i];
+    nmeaPutChar(writer, ',');
+    nmeaPutText(writer, entry->manufacturerMnemonic);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->alertIdentifier, 1);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->alertInstance, 1);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->revisionCounter, 1);
+  }
+}
+#endif // CFG_SENTENCE_ALC_ENABLED
+
+#if CFG_SENTENCE_ALF_ENABLED
+static bool decodeALF(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ALF *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & (ALF_ALERT_CATEGORY_PRESENT | ALF_ALERT_PRIORITY_PRESENT | ALF_ALERT_STATE_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ALF_FIELDS & ALF_TOTAL_SENTENCES_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_TOTAL_SENTENCES_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->totalSentences);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_SENTENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_SENTENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sentenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sequentialMessageIdentifier);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_TIME_OF_LAST_CHANGE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_TIME_OF_LAST_CHANGE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->timeOfLastChange);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_CATEGORY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_CATEGORY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alertCategory = (AlertCategory)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_PRIORITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_PRIORITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alertPriority = (AlertPriority)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_STATE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_STATE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alertState = (AlertAcknowledgedState)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->manufacturerMnemonicCode, sizeof(sentence->manufacturerMnemonicCode));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_IDENTIFIER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_IDENTIFIER_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertIdentifier);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_INSTANCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_INSTANCE_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertInstance);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_REVISION_COUNTER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_REVISION_COUNTER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->revisionCounter);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ESCALATION_COUNTER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ESCALATION_COUNTER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->escalationCounter);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_TEXT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALF_ALERT_TEXT_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->alertText, sizeof(sentence->alertText));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeALF(const SENTENCE_ALF *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_TOTAL_SENTENCES_PRESENT
+  if (sentence->presentFields & ALF_TOTAL_SENTENCES_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->totalSentences, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_SENTENCE_NUMBER_PRESENT
+  if (sentence->presentFields & ALF_SENTENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sentenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT
+  if (sentence->presentFields & ALF_SEQUENTIAL_MESSAGE_IDENTIFIER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sequentialMessageIdentifier, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_TIME_OF_LAST_CHANGE_PRESENT
+  if (sentence->presentFields & ALF_TIME_OF_LAST_CHANGE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->timeOfLastChange, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_CATEGORY_PRESENT
+  if (sentence->presentFields & ALF_ALERT_CATEGORY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alertCategory);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_PRIORITY_PRESENT
+  if (sentence->presentFields & ALF_ALERT_PRIORITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alertPriority);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_STATE_PRESENT
+  if (sentence->presentFields & ALF_ALERT_STATE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alertState);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT
+  if (sentence->presentFields & ALF_MANUFACTURER_MNEMONIC_CODE_PRESENT)
+  {
+    nmeaPutText(writer, sentence->manufacturerMnemonicCode);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_IDENTIFIER_PRESENT
+  if (sentence->presentFields & ALF_ALERT_IDENTIFIER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertIdentifier, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_INSTANCE_PRESENT
+  if (sentence->presentFields & ALF_ALERT_INSTANCE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertInstance, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_REVISION_COUNTER_PRESENT
+  if (sentence->presentFields & ALF_REVISION_COUNTER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->revisionCounter, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ESCALATION_COUNTER_PRESENT
+  if (sentence->presentFields & ALF_ESCALATION_COUNTER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->escalationCounter, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALF_FIELDS & ALF_ALERT_TEXT_PRESENT
+  if (sentence->presentFields & ALF_ALERT_TEXT_PRESENT)
+  {
+    nmeaPutText(writer, sentence->alertText);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ALF_ENABLED
+
+#if CFG_SENTENCE_ALR_ENABLED
+static bool decodeALR(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ALR *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ALR_FIELDS & (ALR_ALARM_CONDITION_PRESENT | ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ALR_FIELDS & ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->timeOfAlarmConditionChange);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALR_ALARM_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alarmNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_CONDITION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALR_ALARM_CONDITION_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alarmCondition = (AlarmCondition)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alarmAcknowledgedState = (AlarmAcknowledgedState)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_DESCRIPTION_TEXT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ALR_ALARM_DESCRIPTION_TEXT_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->alarmDescriptionText, sizeof(sentence->alarmDescriptionText));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeALR(const SENTENCE_ALR *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALR_FIELDS & ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT
+  if (sentence->presentFields & ALR_TIME_OF_ALARM_CONDITION_CHANGE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->timeOfAlarmConditionChange, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_NUMBER_PRESENT
+  if (sentence->presentFields & ALR_ALARM_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alarmNumber, 3);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_CONDITION_PRESENT
+  if (sentence->presentFields & ALR_ALARM_CONDITION_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alarmCondition);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT
+  if (sentence->presentFields & ALR_ALARM_ACKNOWLEDGED_STATE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alarmAcknowledgedState);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ALR_FIELDS & ALR_ALARM_DESCRIPTION_TEXT_PRESENT
+  if (sentence->presentFields & ALR_ALARM_DESCRIPTION_TEXT_PRESENT)
+  {
+    nmeaPutText(writer, sentence->alarmDescriptionText);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ALR_ENABLED
+
+#if CFG_SENTENCE_APB_ENABLED
+static bool decodeAPB(NmeaCursor *cursor, uint8_t checksum, SENTENCE_APB *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_APB_FIELDS & APB_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_APB_FIELDS & (APB_STATUS1_PRESENT | APB_STATUS2_PRESENT | APB_ARRIVAL_CIRCLE_ENTERED_PRESENT | \
+    APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_STATUS1_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status1 = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_STATUS2_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status2 = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_MAGNITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_XTE_MAGNITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->xteMagnitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_DIRECTION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_XTE_DIRECTION_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->xteDirection);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_XTE_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->xteUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_ARRIVAL_CIRCLE_ENTERED_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_ARRIVAL_CIRCLE_ENTERED_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->arrivalCircleEntered = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->perpendicularPassedAtWaypoint = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingOriginToDestination);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingOriginToDestinationReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_DESTINATION_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_DESTINATION_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->destinationWaypointID, sizeof(sentence->destinationWaypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingPresentPositionToDestination);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingPresentPositionToDestinationReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->headingToSteerToDestinationWaypoint);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->headingToSteerToDestinationWaypointReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_APB_FIELDS & APB_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? APB_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeAPB(const SENTENCE_APB *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS1_PRESENT
+  if (sentence->presentFields & APB_STATUS1_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_STATUS2_PRESENT
+  if (sentence->presentFields & APB_STATUS2_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_MAGNITUDE_PRESENT
+  if (sentence->presentFields & APB_XTE_MAGNITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->xteMagnitude, 1, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_DIRECTION_PRESENT
+  if (sentence->presentFields & APB_XTE_DIRECTION_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->xteDirection);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_XTE_UNITS_PRESENT
+  if (sentence->presentFields & APB_XTE_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->xteUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_ARRIVAL_CIRCLE_ENTERED_PRESENT
+  if (sentence->presentFields & APB_ARRIVAL_CIRCLE_ENTERED_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->arrivalCircleEntered);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT
+  if (sentence->presentFields & APB_PERPENDICULAR_PASSED_AT_WAYPOINT_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->perpendicularPassedAtWaypoint);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT
+  if (sentence->presentFields & APB_BEARING_ORIGIN_TO_DESTINATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingOriginToDestination, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT
+  if (sentence->presentFields & APB_BEARING_ORIGIN_TO_DESTINATION_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingOriginToDestinationReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_DESTINATION_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & APB_DESTINATION_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->destinationWaypointID);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT
+  if (sentence->presentFields & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingPresentPositionToDestination, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT
+  if (sentence->presentFields & APB_BEARING_PRESENT_POSITION_TO_DESTINATION_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingPresentPositionToDestinationReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT
+  if (sentence->presentFields & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->headingToSteerToDestinationWaypoint, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT
+  if (sentence->presentFields & APB_HEADING_TO_STEER_TO_DESTINATION_WAYPOINT_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->headingToSteerToDestinationWaypointReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_APB_FIELDS & APB_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & APB_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_APB_ENABLED
+
+#if CFG_SENTENCE_ARC_ENABLED
+static bool decodeARC(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ARC *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_ARC_FIELDS & (ARC_ALERT_COMMAND_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_ARC_FIELDS & ARC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ARC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->time);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ARC_FIELDS & ARC_MANUFACTURER_MNEMONIC_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ARC_MANUFACTURER_MNEMONIC_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->manufacturerMnemonic, sizeof(sentence->manufacturerMnemonic));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ARC_ALERT_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_INSTANCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ARC_ALERT_INSTANCE_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->alertInstance);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_COMMAND_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ARC_ALERT_COMMAND_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->alertCommand = (AlertAcknowledgedState)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeARC(const SENTENCE_ARC *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ARC_FIELDS & ARC_TIME_PRESENT
+  if (sentence->presentFields & ARC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->time, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ARC_FIELDS & ARC_MANUFACTURER_MNEMONIC_PRESENT
+  if (sentence->presentFields & ARC_MANUFACTURER_MNEMONIC_PRESENT)
+  {
+    nmeaPutText(writer, sentence->manufacturerMnemonic);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_ID_PRESENT
+  if (sentence->presentFields & ARC_ALERT_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertId, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_INSTANCE_PRESENT
+  if (sentence->presentFields & ARC_ALERT_INSTANCE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->alertInstance, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ARC_FIELDS & ARC_ALERT_COMMAND_PRESENT
+  if (sentence->presentFields & ARC_ALERT_COMMAND_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->alertCommand);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ARC_ENABLED
+
+#if CFG_SENTENCE_BOD_ENABLED
+static bool decodeBOD(NmeaCursor *cursor, uint8_t checksum, SENTENCE_BOD *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_BOD_FIELDS & BOD_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_BEARING_TRUE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingTrue);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_BEARING_TRUE_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingTrueReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_BEARING_MAGNETIC_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingMagnetic);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_BEARING_MAGNETIC_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingMagneticReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_DESTINATION_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_DESTINATION_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->destinationWaypointID, sizeof(sentence->destinationWaypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BOD_FIELDS & BOD_ORIGIN_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BOD_ORIGIN_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originWaypointID, sizeof(sentence->originWaypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeBOD(const SENTENCE_BOD *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_PRESENT
+  if (sentence->presentFields & BOD_BEARING_TRUE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingTrue, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_TRUE_REFERENCE_PRESENT
+  if (sentence->presentFields & BOD_BEARING_TRUE_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingTrueReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_PRESENT
+  if (sentence->presentFields & BOD_BEARING_MAGNETIC_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingMagnetic, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_BEARING_MAGNETIC_REFERENCE_PRESENT
+  if (sentence->presentFields & BOD_BEARING_MAGNETIC_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingMagneticReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_DESTINATION_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & BOD_DESTINATION_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->destinationWaypointID);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BOD_FIELDS & BOD_ORIGIN_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & BOD_ORIGIN_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originWaypointID);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_BOD_ENABLED
+
+#if CFG_SENTENCE_BWC_ENABLED
+static bool decodeBWC(NmeaCursor *cursor, uint8_t checksum, SENTENCE_BWC *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_BWC_FIELDS & BWC_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & (BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT | BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_BWC_FIELDS & BWC_UTC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_UTC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->utcTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_WAYPOINT_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->waypointLatitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->waypointLatitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_WAYPOINT_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->waypointLongitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->waypointLongitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_BEARING_TRUE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingTrue);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_BEARING_TRUE_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingTrueReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_BEARING_MAGNETIC_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingMagnetic);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_BEARING_MAGNETIC_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->bearingMagneticReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_DISTANCE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->distance);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_DISTANCE_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->distanceUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->waypointID, sizeof(sentence->waypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_BWC_FIELDS & BWC_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? BWC_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeBWC(const SENTENCE_BWC *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_UTC_TIME_PRESENT
+  if (sentence->presentFields & BWC_UTC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->utcTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_PRESENT
+  if (sentence->presentFields & BWC_WAYPOINT_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->waypointLatitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & BWC_WAYPOINT_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->waypointLatitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_PRESENT
+  if (sentence->presentFields & BWC_WAYPOINT_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->waypointLongitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & BWC_WAYPOINT_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->waypointLongitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_PRESENT
+  if (sentence->presentFields & BWC_BEARING_TRUE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingTrue, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_TRUE_REFERENCE_PRESENT
+  if (sentence->presentFields & BWC_BEARING_TRUE_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingTrueReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_PRESENT
+  if (sentence->presentFields & BWC_BEARING_MAGNETIC_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingMagnetic, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_BEARING_MAGNETIC_REFERENCE_PRESENT
+  if (sentence->presentFields & BWC_BEARING_MAGNETIC_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->bearingMagneticReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_PRESENT
+  if (sentence->presentFields & BWC_DISTANCE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->distance, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_DISTANCE_UNITS_PRESENT
+  if (sentence->presentFields & BWC_DISTANCE_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->distanceUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & BWC_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->waypointID);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_BWC_FIELDS & BWC_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & BWC_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_BWC_ENABLED
+
+#if CFG_SENTENCE_DTM_ENABLED
+static bool decodeDTM(NmeaCursor *cursor, uint8_t checksum, SENTENCE_DTM *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_DTM_FIELDS & DTM_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & (DTM_LATITUDE_OFFSET_POLARITY_PRESENT | DTM_LONGITUDE_OFFSET_POLARITY_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LOCAL_DATUM_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->localDatum, sizeof(sentence->localDatum));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LOCAL_DATUM_SUBDIVISION_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->localDatumSubdivision);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LATITUDE_OFFSET_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->latitudeOffset);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LATITUDE_OFFSET_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->latitudeOffsetPolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LONGITUDE_OFFSET_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->longitudeOffset);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_LONGITUDE_OFFSET_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->longitudeOffsetPolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_ALTITUDE_OFFSET_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_ALTITUDE_OFFSET_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->altitudeOffset);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_DTM_FIELDS & DTM_REFERENCE_DATUM_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? DTM_REFERENCE_DATUM_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->referenceDatum, sizeof(sentence->referenceDatum));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeDTM(const SENTENCE_DTM *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_PRESENT
+  if (sentence->presentFields & DTM_LOCAL_DATUM_PRESENT)
+  {
+    nmeaPutText(writer, sentence->localDatum);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT
+  if (sentence->presentFields & DTM_LOCAL_DATUM_SUBDIVISION_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->localDatumSubdivision);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_PRESENT
+  if (sentence->presentFields & DTM_LATITUDE_OFFSET_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->latitudeOffset, 1, 4);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LATITUDE_OFFSET_POLARITY_PRESENT
+  if (sentence->presentFields & DTM_LATITUDE_OFFSET_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->latitudeOffsetPolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_PRESENT
+  if (sentence->presentFields & DTM_LONGITUDE_OFFSET_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->longitudeOffset, 1, 4);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_LONGITUDE_OFFSET_POLARITY_PRESENT
+  if (sentence->presentFields & DTM_LONGITUDE_OFFSET_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->longitudeOffsetPolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_ALTITUDE_OFFSET_PRESENT
+  if (sentence->presentFields & DTM_ALTITUDE_OFFSET_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->altitudeOffset, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_DTM_FIELDS & DTM_REFERENCE_DATUM_PRESENT
+  if (sentence->presentFields & DTM_REFERENCE_DATUM_PRESENT)
+  {
+    nmeaPutText(writer, sentence->referenceDatum);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_DTM_ENABLED
+
+#if CFG_SENTENCE_GGA_ENABLED
+static bool decodeGGA(NmeaCursor *cursor, uint8_t checksum, SENTENCE_GGA *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & (GGA_LATITUDE_POLARITY_PRESENT | GGA_LONGITUDE_POLARITY_PRESENT)
+  char c;
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & (GGA_QUALITY_INDICATOR_PRESENT)
+  uint8_t u8;
+#endif
+
+#if CFG_SENTENCE_GGA_FIELDS & GGA_UTC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_UTC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->utcTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->latitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->latitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->longitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->longitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_QUALITY_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_QUALITY_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &u8);
+  sentence->qualityIndicator = (GPSQualityIndicator)u8;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_SATELLITES_IN_USE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_SATELLITES_IN_USE_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satellitesInUse);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_HDOP_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_HDOP_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->hdop);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_ALTITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->altitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_ALTITUDE_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->altitudeUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_GEOIDAL_SEPARATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->geoidalSeparation);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_GEOIDAL_SEPARATION_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->geoidalSeparationUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_DATA_AGE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_DIFFERENTIAL_DATA_AGE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->differentialDataAge);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_STATION_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GGA_DIFFERENTIAL_STATION_ID_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->differentialStationId);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeGGA(const SENTENCE_GGA *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_UTC_TIME_PRESENT
+  if (sentence->presentFields & GGA_UTC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->utcTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_PRESENT
+  if (sentence->presentFields & GGA_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->latitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & GGA_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->latitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_PRESENT
+  if (sentence->presentFields & GGA_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->longitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & GGA_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->longitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_QUALITY_INDICATOR_PRESENT
+  if (sentence->presentFields & GGA_QUALITY_INDICATOR_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->qualityIndicator, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_SATELLITES_IN_USE_PRESENT
+  if (sentence->presentFields & GGA_SATELLITES_IN_USE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satellitesInUse, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_HDOP_PRESENT
+  if (sentence->presentFields & GGA_HDOP_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->hdop, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_PRESENT
+  if (sentence->presentFields & GGA_ALTITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->altitude, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_ALTITUDE_UNITS_PRESENT
+  if (sentence->presentFields & GGA_ALTITUDE_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->altitudeUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_PRESENT
+  if (sentence->presentFields & GGA_GEOIDAL_SEPARATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->geoidalSeparation, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_GEOIDAL_SEPARATION_UNITS_PRESENT
+  if (sentence->presentFields & GGA_GEOIDAL_SEPARATION_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->geoidalSeparationUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_DATA_AGE_PRESENT
+  if (sentence->presentFields & GGA_DIFFERENTIAL_DATA_AGE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->differentialDataAge, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GGA_FIELDS & GGA_DIFFERENTIAL_STATION_ID_PRESENT
+  if (sentence->presentFields & GGA_DIFFERENTIAL_STATION_ID_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->differentialStationId, 4);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_GGA_ENABLED
+
+#if CFG_SENTENCE_GSA_ENABLED
+static bool decodeGSA(NmeaCursor *cursor, uint8_t checksum, SENTENCE_GSA *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_GSA_FIELDS & GSA_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SELECTION_MODE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SELECTION_MODE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->selectionMode);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_FIX_MODE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_FIX_MODE_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->fixMode);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID1_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId1);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID2_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId2);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID3_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID3_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId3);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID4_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID4_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId4);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID5_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID5_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId5);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID6_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID6_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId6);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID7_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID7_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId7);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID8_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID8_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId8);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID9_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID9_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId9);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID10_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID10_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId10);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID11_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID11_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId11);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID12_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_SATELLITE_ID12_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satelliteId12);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_PDOP_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_PDOP_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->pdop);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_HDOP_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_HDOP_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->hdop);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSA_FIELDS & GSA_VDOP_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSA_VDOP_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->vdop);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeGSA(const SENTENCE_GSA *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SELECTION_MODE_PRESENT
+  if (sentence->presentFields & GSA_SELECTION_MODE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->selectionMode);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_FIX_MODE_PRESENT
+  if (sentence->presentFields & GSA_FIX_MODE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->fixMode, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID1_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID1_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId1, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID2_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID2_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId2, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID3_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID3_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId3, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID4_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID4_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId4, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID5_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID5_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId5, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID6_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID6_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId6, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID7_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID7_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId7, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID8_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID8_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId8, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID9_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID9_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId9, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID10_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID10_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId10, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID11_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID11_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId11, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_SATELLITE_ID12_PRESENT
+  if (sentence->presentFields & GSA_SATELLITE_ID12_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satelliteId12, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_PDOP_PRESENT
+  if (sentence->presentFields & GSA_PDOP_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->pdop, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_HDOP_PRESENT
+  if (sentence->presentFields & GSA_HDOP_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->hdop, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSA_FIELDS & GSA_VDOP_PRESENT
+  if (sentence->presentFields & GSA_VDOP_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->vdop, 1, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_GSA_ENABLED
+
+#if CFG_SENTENCE_GST_ENABLED
+static bool decodeGST(NmeaCursor *cursor, uint8_t checksum, SENTENCE_GST *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_GST_FIELDS & GST_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_GST_FIELDS & GST_UTC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_UTC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->utcTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_RANGE_RMS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_RANGE_RMS_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->rangeRms);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ERROR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_SEMI_MAJOR_ERROR_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->semiMajorError);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MINOR_ERROR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_SEMI_MINOR_ERROR_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->semiMinorError);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ORIENTATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_SEMI_MAJOR_ORIENTATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->semiMajorOrientation);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_LATITUDE_ERROR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_LATITUDE_ERROR_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->latitudeError);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_LONGITUDE_ERROR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_LONGITUDE_ERROR_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->longitudeError);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GST_FIELDS & GST_ALTITUDE_ERROR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GST_ALTITUDE_ERROR_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->altitudeError);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeGST(const SENTENCE_GST *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_UTC_TIME_PRESENT
+  if (sentence->presentFields & GST_UTC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->utcTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_RANGE_RMS_PRESENT
+  if (sentence->presentFields & GST_RANGE_RMS_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->rangeRms, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ERROR_PRESENT
+  if (sentence->presentFields & GST_SEMI_MAJOR_ERROR_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->semiMajorError, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MINOR_ERROR_PRESENT
+  if (sentence->presentFields & GST_SEMI_MINOR_ERROR_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->semiMinorError, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_SEMI_MAJOR_ORIENTATION_PRESENT
+  if (sentence->presentFields & GST_SEMI_MAJOR_ORIENTATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->semiMajorOrientation, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_LATITUDE_ERROR_PRESENT
+  if (sentence->presentFields & GST_LATITUDE_ERROR_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->latitudeError, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_LONGITUDE_ERROR_PRESENT
+  if (sentence->presentFields & GST_LONGITUDE_ERROR_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->longitudeError, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GST_FIELDS & GST_ALTITUDE_ERROR_PRESENT
+  if (sentence->presentFields & GST_ALTITUDE_ERROR_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->altitudeError, 1, 1);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_GST_ENABLED
+
+#if CFG_SENTENCE_GSV_ENABLED
+static bool decodeGSV(NmeaCursor *cursor, uint8_t checksum, SENTENCE_GSV *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_GSV_FIELDS & GSV_ALL_PRESENT
+  NmeaField field;
+#endif
+  uint8_t i;
+
+#if CFG_SENTENCE_GSV_FIELDS & GSV_TOTAL_SENTENCES_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSV_TOTAL_SENTENCES_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->totalSentences);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSV_FIELDS & GSV_SENTENCE_NUMBER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSV_SENTENCE_NUMBER_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->sentenceNumber);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_GSV_FIELDS & GSV_SATELLITES_IN_VIEW_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? GSV_SATELLITES_IN_VIEW_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->satellitesInView);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  for (i = 0; i < 4 && cursor->next < cursor->end; i++)
+  {
+    SatelliteInView *entry = &sentence->satellites[i];
+    ok &= nmeaFieldToUint8(nmeaNextField(cursor), &entry->satelliteId);
+    ok &= nmeaFieldToUint8(nmeaNextField(cursor), &entry->elevation);
+    ok &= nmeaFieldToUint16(nmeaNextField(cursor), &entry->azimuth);
+    ok &= nmeaFieldToUint8(nmeaNextField(cursor), &entry->snr);
+  }
+  sentence->satelliteCount = i;
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeGSV(const SENTENCE_GSV *sentence, NmeaWriter *writer)
+{
+  uint8_t i;
+
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSV_FIELDS & GSV_TOTAL_SENTENCES_PRESENT
+  if (sentence->presentFields & GSV_TOTAL_SENTENCES_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->totalSentences, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSV_FIELDS & GSV_SENTENCE_NUMBER_PRESENT
+  if (sentence->presentFields & GSV_SENTENCE_NUMBER_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->sentenceNumber, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_GSV_FIELDS & GSV_SATELLITES_IN_VIEW_PRESENT
+  if (sentence->presentFields & GSV_SATELLITES_IN_VIEW_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->satellitesInView, 2);
+  }
+#endif
+  for (i = 0; i < sentence->satelliteCount && i < 4; i++)
+  {
+    const SatelliteInView *entry = &sentence->satellites[i];
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->satelliteId, 2);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->elevation, 2);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->azimuth, 3);
+    nmeaPutChar(writer, ',');
+    nmeaPutUint(writer, (uint32_t)entry->snr, 2);
+  }
+}
+#endif // CFG_SENTENCE_GSV_ENABLED
+
+#if CFG_SENTENCE_HDT_ENABLED
+static bool decodeHDT(NmeaCursor *cursor, uint8_t checksum, SENTENCE_HDT *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_HDT_FIELDS & HDT_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? HDT_HEADING_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->heading);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? HDT_HEADING_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->headingReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeHDT(const SENTENCE_HDT *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_PRESENT
+  if (sentence->presentFields & HDT_HEADING_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->heading, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_HDT_FIELDS & HDT_HEADING_REFERENCE_PRESENT
+  if (sentence->presentFields & HDT_HEADING_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->headingReference);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_HDT_ENABLED
+
+#if CFG_SENTENCE_RMB_ENABLED
+static bool decodeRMB(NmeaCursor *cursor, uint8_t checksum, SENTENCE_RMB *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & (RMB_STATUS_PRESENT | RMB_DESTINATION_LATITUDE_POLARITY_PRESENT | \
+    RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT | RMB_ARRIVAL_STATUS_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_RMB_FIELDS & RMB_STATUS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_STATUS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_XTE_MAGNITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_XTE_MAGNITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->xteMagnitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DIRECTION_TO_STEER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DIRECTION_TO_STEER_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->directionToSteer);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ORIGIN_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_ORIGIN_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->originWaypointID, sizeof(sentence->originWaypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_WAYPOINT_ID_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DESTINATION_WAYPOINT_ID_PRESENT : 0;
+  ok &= nmeaFieldToText(field, sentence->destinationWaypointID, sizeof(sentence->destinationWaypointID));
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DESTINATION_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->destinationLatitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DESTINATION_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->destinationLatitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DESTINATION_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->destinationLongitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->destinationLongitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_RANGE_TO_DESTINATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_RANGE_TO_DESTINATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->rangeToDestination);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_BEARING_TO_DESTINATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_BEARING_TO_DESTINATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->bearingToDestination);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_CLOSING_VELOCITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_CLOSING_VELOCITY_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->closingVelocity);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ARRIVAL_STATUS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_ARRIVAL_STATUS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->arrivalStatus = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMB_FIELDS & RMB_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMB_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeRMB(const SENTENCE_RMB *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_STATUS_PRESENT
+  if (sentence->presentFields & RMB_STATUS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_XTE_MAGNITUDE_PRESENT
+  if (sentence->presentFields & RMB_XTE_MAGNITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->xteMagnitude, 1, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DIRECTION_TO_STEER_PRESENT
+  if (sentence->presentFields & RMB_DIRECTION_TO_STEER_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->directionToSteer);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ORIGIN_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & RMB_ORIGIN_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->originWaypointID);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_WAYPOINT_ID_PRESENT
+  if (sentence->presentFields & RMB_DESTINATION_WAYPOINT_ID_PRESENT)
+  {
+    nmeaPutText(writer, sentence->destinationWaypointID);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_PRESENT
+  if (sentence->presentFields & RMB_DESTINATION_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->destinationLatitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & RMB_DESTINATION_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->destinationLatitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_PRESENT
+  if (sentence->presentFields & RMB_DESTINATION_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->destinationLongitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & RMB_DESTINATION_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->destinationLongitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_RANGE_TO_DESTINATION_PRESENT
+  if (sentence->presentFields & RMB_RANGE_TO_DESTINATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->rangeToDestination, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_BEARING_TO_DESTINATION_PRESENT
+  if (sentence->presentFields & RMB_BEARING_TO_DESTINATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->bearingToDestination, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_CLOSING_VELOCITY_PRESENT
+  if (sentence->presentFields & RMB_CLOSING_VELOCITY_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->closingVelocity, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_ARRIVAL_STATUS_PRESENT
+  if (sentence->presentFields & RMB_ARRIVAL_STATUS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->arrivalStatus);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMB_FIELDS & RMB_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & RMB_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_RMB_ENABLED
+
+#if CFG_SENTENCE_RMC_ENABLED
+static bool decodeRMC(NmeaCursor *cursor, uint8_t checksum, SENTENCE_RMC *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_RMC_FIELDS & RMC_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & (RMC_STATUS_PRESENT | RMC_LATITUDE_POLARITY_PRESENT | RMC_LONGITUDE_POLARITY_PRESENT | \
+    RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_RMC_FIELDS & RMC_UTC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_UTC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->utcTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_STATUS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_STATUS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_LATITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->latitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_LATITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->latitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_LONGITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->longitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_POLARITY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_LONGITUDE_POLARITY_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->longitudePolarity = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_SPEED_OVER_GROUND_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_SPEED_OVER_GROUND_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->speedOverGround);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_COURSE_OVER_GROUND_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_COURSE_OVER_GROUND_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->courseOverGround);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_DATE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_DATE_PRESENT : 0;
+  ok &= nmeaFieldToUint32(field, &sentence->date);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_MAGNETIC_VARIATION_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->magneticVariation);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->magneticVariationDirection = (Polarity)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_RMC_FIELDS & RMC_NAVIGATIONAL_STATUS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? RMC_NAVIGATIONAL_STATUS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->navigationalStatus);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeRMC(const SENTENCE_RMC *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_UTC_TIME_PRESENT
+  if (sentence->presentFields & RMC_UTC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->utcTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_STATUS_PRESENT
+  if (sentence->presentFields & RMC_STATUS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_PRESENT
+  if (sentence->presentFields & RMC_LATITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->latitude, 4, NMEA_LATITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LATITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & RMC_LATITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->latitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_PRESENT
+  if (sentence->presentFields & RMC_LONGITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->longitude, 5, NMEA_LONGITUDE_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_LONGITUDE_POLARITY_PRESENT
+  if (sentence->presentFields & RMC_LONGITUDE_POLARITY_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->longitudePolarity);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_SPEED_OVER_GROUND_PRESENT
+  if (sentence->presentFields & RMC_SPEED_OVER_GROUND_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->speedOverGround, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_COURSE_OVER_GROUND_PRESENT
+  if (sentence->presentFields & RMC_COURSE_OVER_GROUND_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->courseOverGround, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_DATE_PRESENT
+  if (sentence->presentFields & RMC_DATE_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->date, 6);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_PRESENT
+  if (sentence->presentFields & RMC_MAGNETIC_VARIATION_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->magneticVariation, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT
+  if (sentence->presentFields & RMC_MAGNETIC_VARIATION_DIRECTION_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->magneticVariationDirection);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & RMC_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_RMC_FIELDS & RMC_NAVIGATIONAL_STATUS_PRESENT
+  if (sentence->presentFields & RMC_NAVIGATIONAL_STATUS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->navigationalStatus);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_RMC_ENABLED
+
+#if CFG_SENTENCE_VTG_ENABLED
+static bool decodeVTG(NmeaCursor *cursor, uint8_t checksum, SENTENCE_VTG *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_VTG_FIELDS & VTG_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_COURSE_OVER_GROUND_TRUE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->courseOverGroundTrue);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->courseOverGroundTrueReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->courseOverGroundMagnetic);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->courseOverGroundMagneticReference);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_SPEED_OVER_GROUND_KNOTS_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->speedOverGroundKnots);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->speedOverGroundKnotsUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_SPEED_OVER_GROUND_KMH_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->speedOverGroundKmh);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->speedOverGroundKmhUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_VTG_FIELDS & VTG_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? VTG_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeVTG(const SENTENCE_VTG *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_PRESENT
+  if (sentence->presentFields & VTG_COURSE_OVER_GROUND_TRUE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->courseOverGroundTrue, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT
+  if (sentence->presentFields & VTG_COURSE_OVER_GROUND_TRUE_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->courseOverGroundTrueReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT
+  if (sentence->presentFields & VTG_COURSE_OVER_GROUND_MAGNETIC_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->courseOverGroundMagnetic, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT
+  if (sentence->presentFields & VTG_COURSE_OVER_GROUND_MAGNETIC_REFERENCE_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->courseOverGroundMagneticReference);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_PRESENT
+  if (sentence->presentFields & VTG_SPEED_OVER_GROUND_KNOTS_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->speedOverGroundKnots, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT
+  if (sentence->presentFields & VTG_SPEED_OVER_GROUND_KNOTS_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->speedOverGroundKnotsUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_PRESENT
+  if (sentence->presentFields & VTG_SPEED_OVER_GROUND_KMH_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->speedOverGroundKmh, 1, 1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT
+  if (sentence->presentFields & VTG_SPEED_OVER_GROUND_KMH_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->speedOverGroundKmhUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_VTG_FIELDS & VTG_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & VTG_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_VTG_ENABLED
+
+#if CFG_SENTENCE_XTE_ENABLED
+static bool decodeXTE(NmeaCursor *cursor, uint8_t checksum, SENTENCE_XTE *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_XTE_FIELDS & XTE_ALL_PRESENT
+  NmeaField field;
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & (XTE_STATUS1_PRESENT | XTE_STATUS2_PRESENT)
+  char c;
+#endif
+
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS1_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_STATUS1_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status1 = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS2_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_STATUS2_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &c);
+  sentence->status2 = (StatusField)c;
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_MAGNITUDE_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_XTE_MAGNITUDE_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->xteMagnitude);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_DIRECTION_TO_STEER_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_DIRECTION_TO_STEER_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->directionToSteer);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_UNITS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_XTE_UNITS_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->xteUnits);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_XTE_FIELDS & XTE_MODE_INDICATOR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? XTE_MODE_INDICATOR_PRESENT : 0;
+  ok &= nmeaFieldToChar(field, &sentence->modeIndicator);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeXTE(const SENTENCE_XTE *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS1_PRESENT
+  if (sentence->presentFields & XTE_STATUS1_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status1);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_STATUS2_PRESENT
+  if (sentence->presentFields & XTE_STATUS2_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->status2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_MAGNITUDE_PRESENT
+  if (sentence->presentFields & XTE_XTE_MAGNITUDE_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->xteMagnitude, 1, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_DIRECTION_TO_STEER_PRESENT
+  if (sentence->presentFields & XTE_DIRECTION_TO_STEER_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->directionToSteer);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_XTE_UNITS_PRESENT
+  if (sentence->presentFields & XTE_XTE_UNITS_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->xteUnits);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_XTE_FIELDS & XTE_MODE_INDICATOR_PRESENT
+  if (sentence->presentFields & XTE_MODE_INDICATOR_PRESENT)
+  {
+    nmeaPutFieldChar(writer, (char)sentence->modeIndicator);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_XTE_ENABLED
+
+#if CFG_SENTENCE_ZDA_ENABLED
+static bool decodeZDA(NmeaCursor *cursor, uint8_t checksum, SENTENCE_ZDA *sentence)
+{
+  uint32_t present = 0;
+  bool ok = true;
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_ALL_PRESENT
+  NmeaField field;
+#endif
+
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_UTC_TIME_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_UTC_TIME_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->utcTime);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_DAY_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_DAY_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->day);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_MONTH_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_MONTH_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->month);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_YEAR_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_YEAR_PRESENT : 0;
+  ok &= nmeaFieldToUint16(field, &sentence->year);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_HOURS_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_LOCAL_ZONE_HOURS_PRESENT : 0;
+  ok &= nmeaFieldToFloat(field, &sentence->localZoneHours);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_MINUTES_PRESENT
+  field = nmeaNextField(cursor);
+  present |= field.length ? ZDA_LOCAL_ZONE_MINUTES_PRESENT : 0;
+  ok &= nmeaFieldToUint8(field, &sentence->localZoneMinutes);
+#else
+  (void)nmeaNextField(cursor);
+#endif
+  sentence->presentFields = present;
+  sentence->checksum = checksum;
+  return ok;
+}
+
+static void encodeZDA(const SENTENCE_ZDA *sentence, NmeaWriter *writer)
+{
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_UTC_TIME_PRESENT
+  if (sentence->presentFields & ZDA_UTC_TIME_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->utcTime, 6, NMEA_TIME_DECIMALS);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_DAY_PRESENT
+  if (sentence->presentFields & ZDA_DAY_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->day, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_MONTH_PRESENT
+  if (sentence->presentFields & ZDA_MONTH_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->month, 2);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_YEAR_PRESENT
+  if (sentence->presentFields & ZDA_YEAR_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->year, 4);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_HOURS_PRESENT
+  if (sentence->presentFields & ZDA_LOCAL_ZONE_HOURS_PRESENT)
+  {
+    nmeaPutFloat(writer, sentence->localZoneHours, 2, 0);
+  }
+#endif
+  nmeaPutChar(writer, ',');
+#if CFG_SENTENCE_ZDA_FIELDS & ZDA_LOCAL_ZONE_MINUTES_PRESENT
+  if (sentence->presentFields & ZDA_LOCAL_ZONE_MINUTES_PRESENT)
+  {
+    nmeaPutUint(writer, (uint32_t)sentence->localZoneMinutes, 2);
+  }
+#endif
+}
+#endif // CFG_SENTENCE_ZDA_ENABLED
+
+NmeaStatus nmeaDecodeFields(NmeaCursor *cursor, uint8_t checksum, NmeaSentence *sentence)
+{
+  bool ok;
+
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_AAM_ENABLED
+  case AAM:
+    ok = decodeAAM(cursor, checksum, &sentence->aam);
+    break;
+#endif
+#if CFG_SENTENCE_ABK_ENABLED
+  case ABK:
+    ok = decodeABK(cursor, checksum, &sentence->abk);
+    break;
+#endif
+#if CFG_SENTENCE_ABM_ENABLED
+  case ABM:
+    ok = decodeABM(cursor, checksum, &sentence->abm);
+    break;
+#endif
+#if CFG_SENTENCE_ACA_ENABLED
+  case ACA:
+    ok = decodeACA(cursor, checksum, &sentence->aca);
+    break;
+#endif
+#if CFG_SENTENCE_ACK_ENABLED
+  case ACK:
+    ok = decodeACK(cursor, checksum, &sentence->ack);
+    break;
+#endif
+#if CFG_SENTENCE_ACN_ENABLED
+  case ACN:
+    ok = decodeACN(cursor, checksum, &sentence->acn);
+    break;
+#endif
+#if CFG_SENTENCE_ACS_ENABLED
+  case ACS:
+    ok = decodeACS(cursor, checksum, &sentence->acs);
+    break;
+#endif
+#if CFG_SENTENCE_AIR_ENABLED
+  case AIR:
+    ok = decodeAIR(cursor, checksum, &sentence->air);
+    break;
+#endif
+#if CFG_SENTENCE_AKD_ENABLED
+  case AKD:
+    ok = decodeAKD(cursor, checksum, &sentence->akd);
+    break;
+#endif
+#if CFG_SENTENCE_ALA_ENABLED
+  case ALA:
+    ok = decodeALA(cursor, checksum, &sentence->ala);
+    break;
+#endif
+#if CFG_SENTENCE_ALC_ENABLED
+  case ALC:
+    ok = decodeALC(cursor, checksum, &sentence->alc);
+    break;
+#endif
+#if CFG_SENTENCE_ALF_ENABLED
+  case ALF:
+    ok = decodeALF(cursor, checksum, &sentence->alf);
+    break;
+#endif
+#if CFG_SENTENCE_ALR_ENABLED
+  case ALR:
+    ok = decodeALR(cursor, checksum, &sentence->alr);
+    break;
+#endif
+#if CFG_SENTENCE_APB_ENABLED
+  case APB:
+    ok = decodeAPB(cursor, checksum, &sentence->apb);
+    break;
+#endif
+#if CFG_SENTENCE_ARC_ENABLED
+  case ARC:
+    ok = decodeARC(cursor, checksum, &sentence->arc);
+    break;
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+  case BOD:
+    ok = decodeBOD(cursor, checksum, &sentence->bod);
+    break;
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  case BWC:
+    ok = decodeBWC(cursor, checksum, &sentence->bwc);
+    break;
+#endif
+#if CFG_SENTENCE_DTM_ENABLED
+  case DTM:
+    ok = decodeDTM(cursor, checksum, &sentence->dtm);
+    break;
+#endif
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+    ok = decodeGGA(cursor, checksum, &sentence->gga);
+    break;
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  case GSA:
+    ok = decodeGSA(cursor, checksum, &sentence->gsa);
+    break;
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  case GST:
+    ok = decodeGST(cursor, checksum, &sentence->gst);
+    break;
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  case GSV:
+    ok = decodeGSV(cursor, checksum, &sentence->gsv);
+    break;
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+  case HDT:
+    ok = decodeHDT(cursor, checksum, &sentence->hdt);
+    break;
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  case RMB:
+    ok = decodeRMB(cursor, checksum, &sentence->rmb);
+    break;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+    ok = decodeRMC(cursor, checksum, &sentence->rmc);
+    break;
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  case VTG:
+    ok = decodeVTG(cursor, checksum, &sentence->vtg);
+    break;
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+  case XTE:
+    ok = decodeXTE(cursor, checksum, &sentence->xte);
+    break;
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  case ZDA:
+    ok = decodeZDA(cursor, checksum, &sentence->zda);
+    break;
+#endif
+  default:
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+  return ok ? NMEA_OK : NMEA_ERROR_FIELD;
+}
+
+NmeaStatus nmeaEncodeFields(const NmeaSentence *sentence, NmeaWriter *writer)
+{
+  switch (sentence->addressField.sentenceId)
+  {
+#if CFG_SENTENCE_AAM_ENABLED
+  case AAM:
+    encodeAAM(&sentence->aam, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ABK_ENABLED
+  case ABK:
+    encodeABK(&sentence->abk, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ABM_ENABLED
+  case ABM:
+    encodeABM(&sentence->abm, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ACA_ENABLED
+  case ACA:
+    encodeACA(&sentence->aca, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ACK_ENABLED
+  case ACK:
+    encodeACK(&sentence->ack, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ACN_ENABLED
+  case ACN:
+    encodeACN(&sentence->acn, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ACS_ENABLED
+  case ACS:
+    encodeACS(&sentence->acs, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_AIR_ENABLED
+  case AIR:
+    encodeAIR(&sentence->air, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_AKD_ENABLED
+  case AKD:
+    encodeAKD(&sentence->akd, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ALA_ENABLED
+  case ALA:
+    encodeALA(&sentence->ala, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ALC_ENABLED
+  case ALC:
+    encodeALC(&sentence->alc, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ALF_ENABLED
+  case ALF:
+    encodeALF(&sentence->alf, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ALR_ENABLED
+  case ALR:
+    encodeALR(&sentence->alr, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_APB_ENABLED
+  case APB:
+    encodeAPB(&sentence->apb, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ARC_ENABLED
+  case ARC:
+    encodeARC(&sentence->arc, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+  case BOD:
+    encodeBOD(&sentence->bod, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  case BWC:
+    encodeBWC(&sentence->bwc, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_DTM_ENABLED
+  case DTM:
+    encodeDTM(&sentence->dtm, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+    encodeGGA(&sentence->gga, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  case GSA:
+    encodeGSA(&sentence->gsa, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  case GST:
+    encodeGST(&sentence->gst, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  case GSV:
+    encodeGSV(&sentence->gsv, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+  case HDT:
+    encodeHDT(&sentence->hdt, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  case RMB:
+    encodeRMB(&sentence->rmb, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+    encodeRMC(&sentence->rmc, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  case VTG:
+    encodeVTG(&sentence->vtg, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+  case XTE:
+    encodeXTE(&sentence->xte, writer);
+    return NMEA_OK;
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  case ZDA:
+    encodeZDA(&sentence->zda, writer);
+    return NMEA_OK;
+#endif
+  default:
+    return NMEA_ERROR_UNSUPPORTED;
+  }
+}
+
+char nmeaSentenceDelimiter(SentenceID sentenceId)
+{
+  switch (sentenceId)
+  {
+#if CFG_SENTENCE_AAM_ENABLED
+  case AAM:
+#endif
+#if CFG_SENTENCE_ABK_ENABLED
+  case ABK:
+#endif
+#if CFG_SENTENCE_ACA_ENABLED
+  case ACA:
+#endif
+#if CFG_SENTENCE_ACK_ENABLED
+  case ACK:
+#endif
+#if CFG_SENTENCE_ACN_ENABLED
+  case ACN:
+#endif
+#if CFG_SENTENCE_ACS_ENABLED
+  case ACS:
+#endif
+#if CFG_SENTENCE_AIR_ENABLED
+  case AIR:
+#endif
+#if CFG_SENTENCE_AKD_ENABLED
+  case AKD:
+#endif
+#if CFG_SENTENCE_ALA_ENABLED
+  case ALA:
+#endif
+#if CFG_SENTENCE_ALC_ENABLED
+  case ALC:
+#endif
+#if CFG_SENTENCE_ALF_ENABLED
+  case ALF:
+#endif
+#if CFG_SENTENCE_ALR_ENABLED
+  case ALR:
+#endif
+#if CFG_SENTENCE_APB_ENABLED
+  case APB:
+#endif
+#if CFG_SENTENCE_ARC_ENABLED
+  case ARC:
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+  case BOD:
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+  case BWC:
+#endif
+#if CFG_SENTENCE_DTM_ENABLED
+  case DTM:
+#endif
+#if CFG_SENTENCE_GGA_ENABLED
+  case GGA:
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+  case GSA:
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+  case GST:
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+  case GSV:
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+  case HDT:
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+  case RMB:
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+  case RMC:
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+  case VTG:
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+  case XTE:
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+  case ZDA:
+#endif
+    return '$';
+#if CFG_SENTENCE_ABM_ENABLED
+  case ABM:
+#endif
+    return '!';
+  default:
+    return '\0';
+  }
+}
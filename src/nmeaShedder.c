@@ -0,0 +1,243 @@
+#include "nmeaShedder.h"
+
+#include <string.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "nmeaShedder.c needs the GCC/Clang __atomic builtins"
+#endif
+
+#if (NMEA_SHEDDER_QUEUE_LENGTH & (NMEA_SHEDDER_QUEUE_LENGTH - 1)) != 0
+#error "NMEA_SHEDDER_QUEUE_LENGTH must be a power of two"
+#endif
+
+/* Length of the start delimiter plus the address field, e.g. "$GPAAM" */
+#define ADDRESS_LENGTH 6
+
+static const SentenceID CRITICAL_SENTENCES[] = {NMEA_SHEDDER_CRITICAL_SENTENCES};
+static const SentenceID HIGH_SENTENCES[] = {NMEA_SHEDDER_HIGH_SENTENCES};
+static const SentenceID LOW_SENTENCES[] = {NMEA_SHEDDER_LOW_SENTENCES};
+
+static void addRules(NmeaShedder *shedder, const SentenceID *sentenceIds, size_t count, NmeaPriority priority)
+{
+  size_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    (void)nmeaShedderSetPriority(shedder, sentenceIds[i], priority);
+  }
+}
+
+/* Sentences queued in the class, seen from either side */
+static uint32_t queued(const NmeaShedderQueue *queue)
+{
+  return __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+}
+
+/* Sentences queued in the classes above limit */
+static uint32_t backlog(const NmeaShedder *shedder, int limit)
+{
+  uint32_t total = 0;
+  int priority;
+
+  for (priority = 0; priority < limit; priority++)
+  {
+    total += queued(&shedder->queues[priority]);
+  }
+  return total;
+}
+
+/* Classifies a frame by its address field; proprietary sentences are low */
+static NmeaPriority framePriority(const NmeaShedder *shedder, const char *frame, size_t length)
+{
+  if (length < ADDRESS_LENGTH)
+  {
+    return NMEA_PRIORITY_LOW;
+  }
+  if (frame[1] == 'P')
+  {
+    return NMEA_PRIORITY_LOW;
+  }
+  return nmeaShedderPriority(
+      shedder, (SentenceID)(((uint32_t)(uint8_t)frame[3] << 16) | ((uint32_t)(uint8_t)frame[4] << 8) |
+                            (uint8_t)frame[5]));
+}
+
+/* NmeaFrameFilter of the framer: queues or sheds, never lets it decode */
+static bool enqueue(const char *frame, size_t length, uint8_t checksum, void *context)
+{
+  NmeaShedder *shedder = (NmeaShedder *)context;
+  NmeaPriority priority = framePriority(shedder, frame, length);
+  NmeaShedderQueue *queue = &shedder->queues[priority];
+  uint16_t depth = shedder->shedDepth[priority];
+  uint32_t head = queue->head;
+  NmeaShedderFrame *slot;
+
+  if (priority != NMEA_PRIORITY_CRITICAL &&
+      (priority >= __atomic_load_n(&shedder->level, __ATOMIC_RELAXED) ||
+       (depth != 0 && backlog(shedder, NMEA_PRIORITY_COUNT) >= depth)))
+  {
+    shedder->statistics.shed[priority]++;
+    return false;
+  }
+  if (head - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) == NMEA_SHEDDER_QUEUE_LENGTH)
+  {
+    shedder->statistics.overflowed[priority]++;
+    return false;
+  }
+  slot = &queue->frames[head & (NMEA_SHEDDER_QUEUE_LENGTH - 1u)];
+  slot->length = (uint8_t)length;
+  slot->checksum = checksum;
+  memcpy(slot->text, frame, length);
+  __atomic_store_n(&queue->head, head + 1u, __ATOMIC_RELEASE);
+  shedder->statistics.queued[priority]++;
+  return false;
+}
+
+void nmeaShedderInit(NmeaShedder *shedder, NmeaSentenceCallback callback, void *context, NmeaShedderClock clock)
+{
+  uint16_t capacity = NMEA_PRIORITY_COUNT * NMEA_SHEDDER_QUEUE_LENGTH;
+
+  shedder->callback = callback;
+  shedder->context = context;
+  shedder->clock = clock;
+  shedder->shedDepth[NMEA_PRIORITY_CRITICAL] = 0;
+  shedder->shedDepth[NMEA_PRIORITY_HIGH] = (uint16_t)(capacity * 3u / 4u);
+  shedder->shedDepth[NMEA_PRIORITY_NORMAL] = (uint16_t)(capacity / 2u);
+  shedder->shedDepth[NMEA_PRIORITY_LOW] = (uint16_t)(capacity / 4u);
+  shedder->level = NMEA_PRIORITY_COUNT;
+  shedder->overruns = 0;
+  shedder->ruleCount = 0;
+  memset(&shedder->statistics, 0, sizeof(shedder->statistics));
+  memset(shedder->queues, 0, sizeof(shedder->queues));
+  addRules(shedder, CRITICAL_SENTENCES, sizeof(CRITICAL_SENTENCES) / sizeof(CRITICAL_SENTENCES[0]),
+           NMEA_PRIORITY_CRITICAL);
+  addRules(shedder, HIGH_SENTENCES, sizeof(HIGH_SENTENCES) / sizeof(HIGH_SENTENCES[0]), NMEA_PRIORITY_HIGH);
+  addRules(shedder, LOW_SENTENCES, sizeof(LOW_SENTENCES) / sizeof(LOW_SENTENCES[0]), NMEA_PRIORITY_LOW);
+  nmeaParserInit(&shedder->framer, NULL, NULL);
+  nmeaParserSetFilter(&shedder->framer, enqueue, shedder);
+}
+
+bool nmeaShedderSetPriority(NmeaShedder *shedder, SentenceID sentenceId, NmeaPriority priority)
+{
+  uint8_t i;
+
+  for (i = 0; i < shedder->ruleCount; i++)
+  {
+    if (shedder->rules[i].sentenceId == sentenceId)
+    {
+      shedder->rules[i].priority = (uint8_t)priority;
+      return true;
+    }
+  }
+  if (shedder->ruleCount == NMEA_SHEDDER_MAX_RULES)
+  {
+    return false;
+  }
+  shedder->rules[shedder->ruleCount].sentenceId = sentenceId;
+  shedder->rules[shedder->ruleCount].priority = (uint8_t)priority;
+  shedder->ruleCount++;
+  return true;
+}
+
+NmeaPriority nmeaShedderPriority(const NmeaShedder *shedder, SentenceID sentenceId)
+{
+  uint8_t i;
+
+  for (i = 0; i < shedder->ruleCount; i++)
+  {
+    if (shedder->rules[i].sentenceId == sentenceId)
+    {
+      return (NmeaPriority)shedder->rules[i].priority;
+    }
+  }
+  return NMEA_PRIORITY_NORMAL;
+}
+
+void nmeaShedderFeed(NmeaShedder *shedder, const uint8_t *data, size_t length)
+{
+  nmeaFeed(&shedder->framer, data, length);
+}
+
+/* Decodes and delivers the oldest frame of the highest non-empty class,
+ * false if all queues are empty */
+static bool drainOne(NmeaShedder *shedder)
+{
+  int priority;
+
+  for (priority = 0; priority < NMEA_PRIORITY_COUNT; priority++)
+  {
+    NmeaShedderQueue *queue = &shedder->queues[priority];
+    uint32_t tail = queue->tail;
+    const NmeaShedderFrame *frame;
+    NmeaStatus status;
+
+    if (__atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) == tail)
+    {
+      continue;
+    }
+    /* The framer never decodes, its sentence is free to decode into */
+    frame = &queue->frames[tail & (NMEA_SHEDDER_QUEUE_LENGTH - 1u)];
+    status = nmeaDecodeFrame(frame->text, frame->length, frame->checksum, &shedder->framer.sentence);
+    __atomic_store_n(&queue->tail, tail + 1u, __ATOMIC_RELEASE);
+    if (status != NMEA_OK)
+    {
+      shedder->statistics.rejected++;
+      return true;
+    }
+    shedder->statistics.delivered[priority]++;
+    if (shedder->callback != NULL)
+    {
+      shedder->callback(&shedder->framer.sentence, shedder->context);
+    }
+    return true;
+  }
+  return false;
+}
+
+uint32_t nmeaShedderDrain(NmeaShedder *shedder, uint32_t budget)
+{
+  uint32_t start = shedder->clock != NULL ? shedder->clock() : 0;
+  uint32_t decoded = 0;
+  uint32_t left;
+  uint8_t level = shedder->level;
+
+  while (drainOne(shedder))
+  {
+    decoded++;
+    if ((shedder->clock != NULL ? shedder->clock() - start : decoded) >= budget)
+    {
+      break;
+    }
+  }
+
+  left = backlog(shedder, NMEA_PRIORITY_COUNT);
+  if (left == 0)
+  {
+    if (level < NMEA_PRIORITY_COUNT)
+    {
+      level++;
+    }
+  }
+  else
+  {
+    shedder->statistics.budgetOverruns++;
+  }
+  /* Out of budget with sentences of admitted classes still queued, drain after
+   * drain: shed one more class, never the critical one. What shed classes
+   * queued before is drained later and does not count. */
+  if (left != 0 && backlog(shedder, level) != 0)
+  {
+    shedder->overruns++;
+  }
+  else
+  {
+    shedder->overruns = 0;
+  }
+  if (shedder->overruns >= NMEA_SHEDDER_OVERRUN_DRAINS && level > NMEA_PRIORITY_CRITICAL + 1)
+  {
+    level--;
+    shedder->overruns = 0;
+  }
+  __atomic_store_n(&shedder->level, level, __ATOMIC_RELAXED);
+  return left;
+}
@@ -0,0 +1,279 @@
+/*
+ * Hardware counter benchmark (Linux): instructions, cycles, branch misses and
+ * cache misses per sentence for every SENTENCE_* decoder, for the checksum,
+ * for framing with checksum verification and for the whole byte-feed parser.
+ *
+ * Counts come from a perf_event_open() group restricted to user space, so
+ * they work with the default kernel.perf_event_paranoid of 2. Without a PMU
+ * (some virtual machines and containers) only the time is reported.
+ *
+ * Checks that every test vector decodes and that the parser delivers the
+ * valid stream and rejects the corrupted one before measuring.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchCounters.c src/nmea*.c -lm -o benchCounters
+ *   ./benchCounters
+ */
+
+#define _DEFAULT_SOURCE /* syscall() */
+#include "benchUtil.h"
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "nmea0183.h"
+#include "nmeaTestVectors.h"
+
+#define ROUNDS 20000
+#define STREAM_ROUNDS 2000
+#define STREAM_SIZE 8192
+#define COUNTER_COUNT 4
+
+typedef struct Counters
+{
+  int fd[COUNTER_COUNT];
+  bool available;
+} Counters;
+
+typedef struct Sample
+{
+  double ns;
+  double value[COUNTER_COUNT];
+} Sample;
+
+static const uint64_t COUNTER_CONFIG[COUNTER_COUNT] = {
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_BRANCH_MISSES,
+  PERF_COUNT_HW_CACHE_MISSES,
+};
+
+static NmeaSentence sentence;
+static NmeaParser parser;
+static char validStream[STREAM_SIZE];
+static char corruptStream[STREAM_SIZE];
+static size_t streamLength;
+static uint32_t streamSentences;
+
+static int openCounter(uint64_t config, int group)
+{
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = group == -1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void openCounters(Counters *counters)
+{
+  int i;
+
+  counters->available = false;
+  for (i = 0; i < COUNTER_COUNT; i++)
+  {
+    counters->fd[i] = openCounter(COUNTER_CONFIG[i], i == 0 ? -1 : counters->fd[0]);
+    if (counters->fd[i] < 0)
+    {
+      printf("perf_event_open: %s, reporting time only\n\n", strerror(errno));
+      while (i-- > 0)
+      {
+        close(counters->fd[i]);
+      }
+      return;
+    }
+  }
+  counters->available = true;
+}
+
+static void startCounters(const Counters *counters)
+{
+  if (counters->available)
+  {
+    ioctl(counters->fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(counters->fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+/* Stops the counters and stores their values divided by operations */
+static void stopCounters(const Counters *counters, double operations, Sample *sample)
+{
+  uint64_t values[1 + COUNTER_COUNT];
+  int i;
+
+  if (!counters->available)
+  {
+    return;
+  }
+  ioctl(counters->fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  if (read(counters->fd[0], values, sizeof(values)) != (ssize_t)sizeof(values))
+  {
+    return;
+  }
+  /* values[0] holds the number of counters in the group */
+  for (i = 0; i < COUNTER_COUNT; i++)
+  {
+    sample->value[i] = (double)values[1 + i] / operations;
+  }
+}
+
+static void printSample(const char *name, const Counters *counters, const Sample *sample)
+{
+  if (counters->available)
+  {
+    printf("%-24s %8.1f %8.0f %8.0f %8.2f %8.2f\n", name, sample->ns, sample->value[0], sample->value[1],
+           sample->value[2], sample->value[3]);
+  }
+  else
+  {
+    printf("%-24s %8.1f %8s %8s %8s %8s\n", name, sample->ns, "-", "-", "-", "-");
+  }
+}
+
+static void countSentence(const NmeaSentence *decoded, void *context)
+{
+  (void)context;
+  benchSink += decoded->addressField.sentenceId;
+}
+
+/* Concatenates the test vectors into one stream, and a copy of it whose
+ * checksums are all wrong, which the parser frames and verifies but never
+ * decodes */
+static void makeStreams(void)
+{
+  const NmeaTestVector *vector;
+
+  streamLength = 0;
+  streamSentences = 0;
+  while (streamLength < STREAM_SIZE / 2)
+  {
+    for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+    {
+      size_t length = strlen(vector->sentence);
+      char *checksum;
+
+      memcpy(&validStream[streamLength], vector->sentence, length);
+      memcpy(&corruptStream[streamLength], vector->sentence, length);
+      checksum = strchr(&corruptStream[streamLength], '*') + 1;
+      checksum[0] = checksum[0] == '0' ? '1' : '0';
+      streamLength += length;
+      streamSentences++;
+    }
+  }
+}
+
+static int checkInputs(void)
+{
+  const NmeaTestVector *vector;
+  int failures = 0;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    if (nmeaDecode(vector->sentence, strlen(vector->sentence), &sentence) != NMEA_OK)
+    {
+      printf("FAILED: %s", vector->sentence);
+      failures++;
+    }
+  }
+
+  nmeaParserInit(&parser, countSentence, NULL);
+  nmeaFeed(&parser, (const uint8_t *)validStream, streamLength);
+  failures += parser.statistics.sentences != streamSentences;
+  nmeaParserInit(&parser, countSentence, NULL);
+  nmeaFeed(&parser, (const uint8_t *)corruptStream, streamLength);
+  failures += parser.statistics.checksumErrors != streamSentences || parser.statistics.sentences != 0;
+  if (failures != 0)
+  {
+    printf("FAILED: parser did not deliver the valid stream or reject the corrupted one\n");
+  }
+  return failures;
+}
+
+static void measureChecksum(const Counters *counters)
+{
+  Sample sample;
+  uint64_t start;
+  int round;
+
+  startCounters(counters);
+  start = benchNowNs();
+  for (round = 0; round < STREAM_ROUNDS; round++)
+  {
+    benchSink += nmeaChecksum(validStream, streamLength);
+  }
+  sample.ns = (double)(benchNowNs() - start) / ((double)STREAM_ROUNDS * streamSentences);
+  stopCounters(counters, (double)STREAM_ROUNDS * streamSentences, &sample);
+  printSample("checksum", counters, &sample);
+}
+
+static void measureFeed(const Counters *counters, const char *name, const char *stream)
+{
+  Sample sample;
+  uint64_t start;
+  int round;
+
+  nmeaParserInit(&parser, countSentence, NULL);
+  startCounters(counters);
+  start = benchNowNs();
+  for (round = 0; round < STREAM_ROUNDS; round++)
+  {
+    nmeaFeed(&parser, (const uint8_t *)stream, streamLength);
+  }
+  sample.ns = (double)(benchNowNs() - start) / ((double)STREAM_ROUNDS * streamSentences);
+  stopCounters(counters, (double)STREAM_ROUNDS * streamSentences, &sample);
+  printSample(name, counters, &sample);
+}
+
+static void measureDecoders(const Counters *counters)
+{
+  const NmeaTestVector *vector;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    size_t length = strlen(vector->sentence);
+    char name[32];
+    Sample sample;
+    uint64_t start;
+    int round;
+
+    snprintf(name, sizeof(name), "decode %.3s", vector->sentence + 3);
+    startCounters(counters);
+    start = benchNowNs();
+    for (round = 0; round < ROUNDS; round++)
+    {
+      benchSink += (uint64_t)nmeaDecode(vector->sentence, length, &sentence);
+    }
+    sample.ns = (double)(benchNowNs() - start) / ROUNDS;
+    stopCounters(counters, ROUNDS, &sample);
+    printSample(name, counters, &sample);
+  }
+}
+
+int main(void)
+{
+  Counters counters;
+
+  makeStreams();
+  if (checkInputs() != 0)
+  {
+    return 1;
+  }
+  openCounters(&counters);
+  printf("%-24s %8s %8s %8s %8s %8s\n", "per sentence", "ns", "instr", "cycles", "br-miss", "$-miss");
+  measureChecksum(&counters);
+  measureFeed(&counters, "framing + checksum", corruptStream);
+  measureFeed(&counters, "feed (frame + decode)", validStream);
+  measureDecoders(&counters);
+  return 0;
+}
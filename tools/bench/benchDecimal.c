@@ -0,0 +1,206 @@
+/*
+ * Decimal field parser benchmark: nmeaParseDecimal() against strtof/strtod.
+ *
+ * Checks that every conversion matches the C library bit for bit, then times
+ * both on a mix of typical field layouts (ddmm.mmmm, dddmm.mmmm, hhmmss.ss,
+ * x.x, xxx.x and signed values).
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc tools/bench/benchDecimal.c src/nmeaDecimal.c -o benchDecimal
+ *   ./benchDecimal
+ */
+
+#include "benchUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nmeaDecimal.h"
+
+#define INPUT_COUNT 8192
+#define INPUT_MAX_LENGTH 24
+#define FUZZ_COUNT 1000000
+#define ROUNDS 200
+
+static char inputs[INPUT_COUNT][INPUT_MAX_LENGTH];
+static uint8_t lengths[INPUT_COUNT];
+
+static void makeInputs(void)
+{
+  uint32_t seed = 0x4E4D4541u;
+  int i;
+
+  for (i = 0; i < INPUT_COUNT; i++)
+  {
+    uint32_t r = benchRandom(&seed);
+    int n;
+
+    switch (i % 6)
+    {
+    case 0:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "%02u%02u.%04u", r % 90, (r >> 8) % 60, (r >> 14) % 10000);
+      break;
+    case 1:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "%03u%02u.%04u", r % 180, (r >> 8) % 60, (r >> 14) % 10000);
+      break;
+    case 2:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "%02u%02u%02u.%02u", r % 24, (r >> 5) % 60, (r >> 11) % 60,
+                   (r >> 17) % 100);
+      break;
+    case 3:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "%u.%u", r % 40, (r >> 8) % 10);
+      break;
+    case 4:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "%03u.%u", r % 360, (r >> 9) % 10);
+      break;
+    default:
+      n = snprintf(inputs[i], INPUT_MAX_LENGTH, "-%u.%02u", r % 100, (r >> 8) % 100);
+      break;
+    }
+    lengths[i] = (uint8_t)n;
+  }
+}
+
+static int sameFloat(float a, float b)
+{
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static int sameDouble(double a, double b)
+{
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+/* Compares one string against the C library; returns the number of mismatches */
+static int checkOne(const char *text, uint8_t length, int checkDouble)
+{
+  NmeaDecimal decimal;
+  int mismatches = 0;
+
+  if (!nmeaParseDecimal(text, length, &decimal))
+  {
+    printf("rejected: %s\n", text);
+    return 1;
+  }
+  if (!sameFloat(nmeaDecimalToFloat(&decimal), strtof(text, NULL)))
+  {
+    printf("float mismatch: %s %.9g != %.9g\n", text, nmeaDecimalToFloat(&decimal), strtof(text, NULL));
+    mismatches++;
+  }
+  if (checkDouble && !sameDouble(nmeaDecimalToDouble(&decimal), strtod(text, NULL)))
+  {
+    printf("double mismatch: %s\n", text);
+    mismatches++;
+  }
+  return mismatches;
+}
+
+static int checkConversions(void)
+{
+  uint32_t seed = 0x0183u;
+  int mismatches = 0;
+  int i;
+
+  for (i = 0; i < INPUT_COUNT; i++)
+  {
+    mismatches += checkOne(inputs[i], lengths[i], 1);
+  }
+
+  /* Random digit strings: up to 9 integer and 8 fraction digits */
+  for (i = 0; i < FUZZ_COUNT && mismatches < 20; i++)
+  {
+    char text[INPUT_MAX_LENGTH];
+    uint8_t length = 0;
+    uint32_t r = benchRandom(&seed);
+    int integerDigits = 1 + (int)(r % 9);
+    int fractionDigits = (int)((r >> 4) % 9);
+    int d;
+
+    if (r & 0x80000000u)
+    {
+      text[length++] = '-';
+    }
+    for (d = 0; d < integerDigits; d++)
+    {
+      text[length++] = (char)('0' + benchRandom(&seed) % 10);
+    }
+    if (fractionDigits > 0)
+    {
+      text[length++] = '.';
+      for (d = 0; d < fractionDigits; d++)
+      {
+        text[length++] = (char)('0' + benchRandom(&seed) % 10);
+      }
+    }
+    text[length] = '\0';
+    mismatches += checkOne(text, length, integerDigits + fractionDigits <= 15);
+  }
+  return mismatches;
+}
+
+int main(void)
+{
+  uint64_t start;
+  uint64_t strtofNs;
+  uint64_t floatNs;
+  uint64_t scaledNs;
+  uint64_t total = 0;
+  double perField;
+  int round;
+  int i;
+
+  makeInputs();
+  if (checkConversions() != 0)
+  {
+    printf("FAILED: conversions differ from the C library\n");
+    return 1;
+  }
+  printf("conversions match strtof/strtod (%d inputs, %d random strings)\n", INPUT_COUNT, FUZZ_COUNT);
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      float value = strtof(inputs[i], NULL);
+      total += (uint64_t)(int64_t)value;
+    }
+  }
+  strtofNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      NmeaDecimal decimal;
+      nmeaParseDecimal(inputs[i], lengths[i], &decimal);
+      total += (uint64_t)(int64_t)nmeaDecimalToFloat(&decimal);
+    }
+  }
+  floatNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      NmeaDecimal decimal;
+      int32_t value;
+      nmeaParseDecimal(inputs[i], lengths[i], &decimal);
+      nmeaDecimalToScaled(&decimal, 4, &value);
+      total += (uint64_t)value;
+    }
+  }
+  scaledNs = benchNowNs() - start;
+  benchSink = total;
+
+  perField = (double)INPUT_COUNT * ROUNDS;
+  printf("strtof                      %6.2f ns/field\n", (double)strtofNs / perField);
+  printf("nmeaParseDecimal -> float   %6.2f ns/field (%.1fx)\n", (double)floatNs / perField,
+         (double)strtofNs / (double)floatNs);
+  printf("nmeaParseDecimal -> scaled  %6.2f ns/field (%.1fx)\n", (double)scaledNs / perField,
+         (double)strtofNs / (double)scaledNs);
+  return 0;
+}
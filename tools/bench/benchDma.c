@@ -0,0 +1,246 @@
+/*
+ * DMA receive mode simulation: CPU wake-ups per sentence and delivery delay
+ * of src/nmeaDmaReceiver.c against an interrupt per received byte.
+ *
+ * A simulated UART with a circular DMA channel stands in for the hardware
+ * behind NmeaDmaHal. Time advances one character at a time; the line carries
+ * bursts of back-to-back sentences (as a GNSS receiver sends its epoch) with
+ * idle gaps between them, and the simulation raises the events real hardware
+ * would: idle line one character after a burst, character match on '\n' and
+ * DMA half and complete transfer. Every event is a wake-up that calls
+ * nmeaDmaService().
+ *
+ * Modes: one interrupt per byte (nmeaFeedByte() from the RX interrupt), DMA
+ * with idle line only, and DMA with idle line and '\n' character match.
+ * Delay is counted in character times from the last checksum digit of a
+ * sentence to its delivery.
+ *
+ * Checks that every mode delivers every sentence, in order.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchDma.c src/nmea*.c -lm -o benchDma
+ *   ./benchDma
+ */
+
+#include "benchUtil.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nmea0183.h"
+#include "nmeaDmaReceiver.h"
+#include "nmeaTestVectors.h"
+
+#define BURSTS 5000
+#define MAX_BURST 8     /* Sentences per burst */
+#define MAX_GAP 400     /* Idle character times between bursts */
+#define MAX_VECTORS 64
+#define MAX_SENTENCES (BURSTS * MAX_BURST)
+#define LINE_SIZE (MAX_SENTENCES * NMEA_MAX_SENTENCE_LENGTH)
+
+typedef enum Mode
+{
+  MODE_BYTE,
+  MODE_IDLE,
+  MODE_MATCH
+} Mode;
+
+/* The simulated UART and DMA channel */
+typedef struct SimPort
+{
+  uint8_t *buffer;
+  size_t size;
+  uint64_t written; /* Bytes the DMA transferred so far */
+  bool running;
+} SimPort;
+
+static const char *vectors[MAX_VECTORS];
+static int vectorCount;
+
+/* The line: bytes and the character time each one arrives at */
+static uint8_t *line;
+static uint64_t *arrival;
+static size_t lineLength;
+
+static SentenceID expectedIds[MAX_SENTENCES];
+static uint64_t completedAt[MAX_SENTENCES]; /* Time of each sentence's last checksum digit */
+static uint32_t expectedCount;
+
+static uint64_t now;
+static uint32_t delivered;
+static uint32_t outOfOrder;
+static uint64_t delaySum;
+static uint64_t delayMax;
+
+static bool simStart(void *port, uint8_t *buffer, size_t size)
+{
+  SimPort *sim = (SimPort *)port;
+
+  sim->buffer = buffer;
+  sim->size = size;
+  sim->written = 0;
+  sim->running = true;
+  return true;
+}
+
+static size_t simRemaining(void *port)
+{
+  const SimPort *sim = (const SimPort *)port;
+
+  return sim->size - (size_t)(sim->written % sim->size);
+}
+
+static void simStop(void *port)
+{
+  ((SimPort *)port)->running = false;
+}
+
+static const NmeaDmaHal SIM_HAL = {simStart, simRemaining, simStop};
+
+static void onSentence(const NmeaSentence *sentence, void *context)
+{
+  uint64_t delay;
+
+  (void)context;
+  if (delivered >= expectedCount || sentence->addressField.sentenceId != expectedIds[delivered])
+  {
+    outOfOrder++;
+    delivered++;
+    return;
+  }
+  delay = now - completedAt[delivered];
+  delaySum += delay;
+  delayMax = delay > delayMax ? delay : delayMax;
+  delivered++;
+}
+
+static void buildLine(void)
+{
+  const NmeaTestVector *vector;
+  uint32_t random = 0x2545F491u;
+  uint64_t time = 0;
+  int burst;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL && vectorCount < MAX_VECTORS; vector++)
+  {
+    vectors[vectorCount++] = vector->sentence;
+  }
+  line = (uint8_t *)malloc(LINE_SIZE);
+  arrival = (uint64_t *)malloc(LINE_SIZE * sizeof(arrival[0]));
+  for (burst = 0; burst < BURSTS; burst++)
+  {
+    uint32_t count = 1u + benchRandom(&random) % MAX_BURST;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+      int index = (int)(benchRandom(&random) % (uint32_t)vectorCount);
+      const char *sentence = vectors[index];
+      size_t length = strlen(sentence);
+      size_t c;
+
+      expectedIds[expectedCount] = NMEA_TEST_VECTORS[index].sentenceId;
+      for (c = 0; c < length; c++)
+      {
+        line[lineLength] = (uint8_t)sentence[c];
+        arrival[lineLength++] = time++;
+      }
+      /* The parser completes a sentence at its last checksum digit */
+      completedAt[expectedCount++] = time - 3u;
+    }
+    time += 1u + benchRandom(&random) % MAX_GAP;
+  }
+}
+
+static void service(NmeaDmaReceiver *receiver, NmeaDmaEvent event, uint32_t *wakeups)
+{
+  nmeaDmaService(receiver, event);
+  (*wakeups)++;
+}
+
+/* Runs the line through one mode; returns the wake-ups */
+static uint32_t simulate(Mode mode)
+{
+  static NmeaDmaReceiver receiver;
+  static NmeaParser parser;
+  SimPort sim;
+  uint32_t wakeups = 0;
+  size_t i;
+
+  delivered = 0;
+  outOfOrder = 0;
+  delaySum = 0;
+  delayMax = 0;
+  nmeaParserInit(&parser, onSentence, NULL);
+  nmeaDmaInit(&receiver, &SIM_HAL, &sim, onSentence, NULL);
+
+  for (i = 0; i < lineLength; i++)
+  {
+    uint8_t byte = line[i];
+    size_t position;
+
+    now = arrival[i];
+    if (mode == MODE_BYTE)
+    {
+      nmeaFeedByte(&parser, byte);
+      wakeups++;
+      continue;
+    }
+
+    sim.buffer[sim.written % sim.size] = byte;
+    sim.written++;
+    position = (size_t)(sim.written % sim.size);
+    if (mode == MODE_MATCH && byte == '\n')
+    {
+      service(&receiver, NMEA_DMA_EVENT_MATCH, &wakeups);
+    }
+    if (position == sim.size / 2u)
+    {
+      service(&receiver, NMEA_DMA_EVENT_HALF, &wakeups);
+    }
+    if (position == 0)
+    {
+      service(&receiver, NMEA_DMA_EVENT_COMPLETE, &wakeups);
+    }
+    /* One character time without a start bit after the last byte */
+    if (i + 1 == lineLength || arrival[i + 1] > now + 1u)
+    {
+      now++;
+      service(&receiver, NMEA_DMA_EVENT_IDLE, &wakeups);
+    }
+  }
+  if (mode != MODE_BYTE)
+  {
+    nmeaDmaStop(&receiver);
+  }
+  return wakeups;
+}
+
+int main(void)
+{
+  static const char *const NAMES[] = {"interrupt per byte", "DMA, idle line", "DMA, idle + '\\n' match"};
+  int failures = 0;
+  int mode;
+
+  buildLine();
+  printf("%u sentences in %d bursts, %zu bytes, DMA buffer of %d bytes\n\n", expectedCount, BURSTS, lineLength,
+         NMEA_DMA_BUFFER_SIZE);
+  printf("%-24s %10s %14s %12s %12s\n", "mode", "wake-ups", "per sentence", "mean delay", "max delay");
+  for (mode = MODE_BYTE; mode <= MODE_MATCH; mode++)
+  {
+    uint32_t wakeups = simulate((Mode)mode);
+
+    printf("%-24s %10u %14.2f %9.1f ch %9llu ch\n", NAMES[mode], wakeups, (double)wakeups / expectedCount,
+           (double)delaySum / expectedCount, (unsigned long long)delayMax);
+    if (delivered != expectedCount || outOfOrder != 0)
+    {
+      printf("  FAILED: %u of %u sentences delivered, %u out of order\n", delivered, expectedCount, outOfOrder);
+      failures++;
+    }
+  }
+  free(line);
+  free(arrival);
+  return failures != 0;
+}
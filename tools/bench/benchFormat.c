@@ -0,0 +1,150 @@
+/*
+ * Fixed point formatter benchmark: nmeaFormatDecimal() against snprintf.
+ *
+ * Checks that every output matches snprintf("%0*.*f") character for character
+ * on random bit patterns and on typical field values, then times both on
+ * ddmm.mmmm, hhmmss.ss and x.x layouts and on snprintf("%.4f") itself.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc tools/bench/benchFormat.c src/nmeaDecimal.c -lm -o benchFormat
+ *   ./benchFormat
+ */
+
+#include "benchUtil.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nmeaDecimal.h"
+
+#define INPUT_COUNT 8192
+#define FUZZ_COUNT 1000000
+#define ROUNDS 50
+
+typedef struct Layout
+{
+  const char *name;
+  uint8_t minDigits;
+  uint8_t decimals;
+  float scale;
+} Layout;
+
+static const Layout LAYOUTS[] = {
+  {"latitude ddmm.mmmm", 4, 4, 9000.0f},
+  {"time hhmmss.ss", 6, 2, 235959.0f},
+  {"speed x.x", 1, 1, 40.0f},
+  {"%.4f", 1, 4, 9000.0f},
+};
+
+static float inputs[INPUT_COUNT];
+
+static int compare(float value, uint8_t minDigits, uint8_t decimals)
+{
+  char expected[64];
+  char actual[NMEA_FORMAT_MAX_LENGTH];
+  int width = minDigits + (decimals ? decimals + 1 : 0) + (signbit(value) ? 1 : 0);
+  int expectedLength = snprintf(expected, sizeof(expected), "%0*.*f", width, (int)decimals, (double)value);
+  uint8_t length = nmeaFormatDecimal(actual, value, minDigits, decimals);
+
+  if (length == 0)
+  {
+    /* Refusing is fine for values whose scaled magnitude needs over 64 bits */
+    return isfinite(value) && fabs((double)value) * pow(10.0, decimals) < 1.8e19;
+  }
+  if ((int)length != expectedLength || memcmp(actual, expected, length) != 0)
+  {
+    printf("mismatch: %a (%d, %d) snprintf '%s', formatter '%.*s'\n", (double)value, minDigits, decimals,
+           expected, length, actual);
+    return 1;
+  }
+  return 0;
+}
+
+static int checkAgreement(void)
+{
+  uint32_t seed = 0x464D5421u;
+  int mismatches = 0;
+  int i;
+
+  for (i = 0; i < FUZZ_COUNT && mismatches < 20; i++)
+  {
+    uint32_t bits = benchRandom(&seed);
+    uint8_t decimals = (uint8_t)(benchRandom(&seed) % (NMEA_FORMAT_MAX_DECIMALS + 1));
+    uint8_t minDigits = (uint8_t)(benchRandom(&seed) % 8);
+    float value;
+
+    /* Half random bit patterns, half values in the range of real fields */
+    if (i & 1)
+    {
+      value = (float)(benchRandom(&seed) % 36000000u) / 1000.0f;
+    }
+    else
+    {
+      memcpy(&value, &bits, sizeof(value));
+    }
+    mismatches += compare(value, minDigits, decimals);
+  }
+  return mismatches;
+}
+
+static void run(const Layout *layout)
+{
+  char text[64];
+  uint64_t total = 0;
+  uint64_t start;
+  uint64_t printfNs;
+  uint64_t formatNs;
+  uint32_t seed = 0x5A5A1234u;
+  int round;
+  int i;
+
+  for (i = 0; i < INPUT_COUNT; i++)
+  {
+    inputs[i] = layout->scale * (float)(benchRandom(&seed) % 1000000u) / 1000000.0f;
+  }
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      total += (uint64_t)snprintf(text, sizeof(text), "%0*.*f", layout->minDigits + layout->decimals + 1,
+                                  (int)layout->decimals, (double)inputs[i]);
+    }
+  }
+  printfNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      total += nmeaFormatDecimal(text, inputs[i], layout->minDigits, layout->decimals);
+    }
+  }
+  formatNs = benchNowNs() - start;
+  benchSink = total;
+
+  printf("%-20s snprintf %6.1f ns, formatter %6.1f ns (%.1fx)\n", layout->name,
+         (double)printfNs / (INPUT_COUNT * (double)ROUNDS), (double)formatNs / (INPUT_COUNT * (double)ROUNDS),
+         (double)printfNs / (double)formatNs);
+}
+
+int main(void)
+{
+  size_t i;
+
+  if (checkAgreement() != 0)
+  {
+    printf("FAILED: formatter differs from snprintf\n");
+    return 1;
+  }
+  printf("formatter matches snprintf on %d values\n", FUZZ_COUNT);
+
+  for (i = 0; i < sizeof(LAYOUTS) / sizeof(LAYOUTS[0]); i++)
+  {
+    run(&LAYOUTS[i]);
+  }
+  return 0;
+}
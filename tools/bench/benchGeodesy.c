@@ -0,0 +1,184 @@
+/*
+ * Geodesy kernel benchmark: batch float kernels against the double precision
+ * reference functions.
+ *
+ * Measures the worst error of nmeaFastAtan2() against atan2() and of the
+ * batch distance, bearing and offset kernels against the reference on random
+ * positions, fails if any exceeds its documented bound, then times the
+ * reference loop against the batch kernel for one fix and many waypoints.
+ *
+ * Build and run from the repository root:
+ *   cc -O3 -fno-math-errno -fno-trapping-math -Iinc -Isrc tools/bench/benchGeodesy.c \
+ *      src/nmeaGeodesy.c -lm -o benchGeodesy
+ *   ./benchGeodesy
+ */
+
+#include "benchUtil.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "nmeaGeodesy.h"
+
+#define WAYPOINTS 4096
+#define POSITIONS 256
+#define ATAN_SAMPLES 1000000
+#define ROUNDS 200
+
+static double latitudes[WAYPOINTS];
+static double longitudes[WAYPOINTS];
+static float wx[WAYPOINTS];
+static float wy[WAYPOINTS];
+static float wz[WAYPOINTS];
+static float distances[WAYPOINTS];
+static float bearings[WAYPOINTS];
+static float offsets[WAYPOINTS];
+
+static double randomUnit(uint32_t *seed)
+{
+  return (double)benchRandom(seed) / 4294967296.0;
+}
+
+/* Random waypoints, half of them within about 10 NM of the fix so short
+ * ranges (arrival circles) are covered as well as long ones */
+static void makeWaypoints(uint32_t *seed, double latitude, double longitude)
+{
+  int i;
+
+  for (i = 0; i < WAYPOINTS; i++)
+  {
+    if (i & 1)
+    {
+      latitudes[i] = latitude + (randomUnit(seed) - 0.5) * 0.3;
+      longitudes[i] = longitude + (randomUnit(seed) - 0.5) * 0.3;
+    }
+    else
+    {
+      latitudes[i] = asin(2.0 * randomUnit(seed) - 1.0) * 57.29577951308232;
+      longitudes[i] = 360.0 * randomUnit(seed) - 180.0;
+    }
+  }
+  nmeaGeoVectorBatch(latitudes, longitudes, WAYPOINTS, wx, wy, wz);
+}
+
+static double bearingDifference(double a, double b)
+{
+  double d = fabs(a - b);
+  return d > 180.0 ? 360.0 - d : d;
+}
+
+static int checkAccuracy(void)
+{
+  uint32_t seed = 0x47454F44u;
+  double atanError = 0.0;
+  double distanceError = 0.0;
+  double bearingError = 0.0;
+  double offsetError = 0.0;
+  int failures = 0;
+  int p;
+  int i;
+
+  for (i = 0; i < ATAN_SAMPLES; i++)
+  {
+    float y = (float)(2.0 * randomUnit(&seed) - 1.0);
+    float x = (float)(2.0 * randomUnit(&seed) - 1.0);
+    double error = fabs((double)nmeaFastAtan2(y, x) - atan2((double)y, (double)x));
+
+    /* Equal to pi and -pi on the negative x axis */
+    if (error > 3.0)
+    {
+      error = fabs(error - 2.0 * 3.14159265358979323846);
+    }
+    atanError = error > atanError ? error : atanError;
+  }
+
+  for (p = 0; p < POSITIONS; p++)
+  {
+    double latitude = asin(2.0 * randomUnit(&seed) - 1.0) * 57.29577951308232;
+    double longitude = 360.0 * randomUnit(&seed) - 180.0;
+    NmeaVector from = nmeaGeoVector(latitude, longitude);
+    NmeaVector normal = nmeaGeoVector(latitude - 90.0 * (latitude > 0.0 ? 1.0 : -1.0), longitude);
+
+    makeWaypoints(&seed, latitude, longitude);
+    nmeaGreatCircleBatch(&from, wx, wy, wz, WAYPOINTS, distances, bearings);
+    nmeaGreatCircleOffsetBatch(&normal, wx, wy, wz, WAYPOINTS, offsets);
+    for (i = 0; i < WAYPOINTS; i++)
+    {
+      NmeaVector to = nmeaGeoVector(latitudes[i], longitudes[i]);
+      double distance = nmeaGreatCircleDistance(&from, &to);
+      double error = fabs((double)distances[i] - distance);
+
+      distanceError = error > distanceError ? error : distanceError;
+      error = fabs((double)offsets[i] - nmeaGreatCircleOffset(&normal, &to));
+      offsetError = error > offsetError ? error : offsetError;
+      if (distance > 1.0)
+      {
+        error = bearingDifference((double)bearings[i], nmeaGreatCircleBearing(&from, &to));
+        bearingError = error > bearingError ? error : bearingError;
+      }
+    }
+  }
+
+  printf("nmeaFastAtan2 max error  %.3g rad   (bound %.3g)\n", atanError, (double)NMEA_FAST_ATAN2_ERROR);
+  printf("batch distance max error %.3g NM    (bound %.3g)\n", distanceError, (double)NMEA_FAST_DISTANCE_ERROR);
+  printf("batch offset max error   %.3g NM    (bound %.3g)\n", offsetError, (double)NMEA_FAST_DISTANCE_ERROR);
+  printf("batch bearing max error  %.3g deg   (bound %.3g)\n", bearingError, (double)NMEA_FAST_BEARING_ERROR);
+  failures += atanError > NMEA_FAST_ATAN2_ERROR;
+  failures += distanceError > NMEA_FAST_DISTANCE_ERROR;
+  failures += offsetError > NMEA_FAST_DISTANCE_ERROR;
+  failures += bearingError > NMEA_FAST_BEARING_ERROR;
+  return failures;
+}
+
+static void timeKernels(void)
+{
+  static NmeaVector vectors[WAYPOINTS];
+  uint32_t seed = 0x54494D45u;
+  NmeaVector from = nmeaGeoVector(48.1, 11.5);
+  double total = 0.0;
+  uint64_t start;
+  uint64_t referenceNs;
+  uint64_t batchNs;
+  int round;
+  int i;
+
+  makeWaypoints(&seed, 48.1, 11.5);
+  for (i = 0; i < WAYPOINTS; i++)
+  {
+    vectors[i] = nmeaGeoVector(latitudes[i], longitudes[i]);
+  }
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < WAYPOINTS; i++)
+    {
+      total += nmeaGreatCircleDistance(&from, &vectors[i]) + nmeaGreatCircleBearing(&from, &vectors[i]);
+    }
+  }
+  referenceNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    nmeaGreatCircleBatch(&from, wx, wy, wz, WAYPOINTS, distances, bearings);
+    total += (double)distances[round] + (double)bearings[round];
+  }
+  batchNs = benchNowNs() - start;
+  benchSink = (uint64_t)total;
+
+  printf("distance and bearing to %d waypoints: reference %6.2f ns, batch %6.2f ns per waypoint (%.1fx)\n",
+         WAYPOINTS, (double)referenceNs / (WAYPOINTS * (double)ROUNDS),
+         (double)batchNs / (WAYPOINTS * (double)ROUNDS), (double)referenceNs / (double)batchNs);
+}
+
+int main(void)
+{
+  if (checkAccuracy() != 0)
+  {
+    printf("FAILED: error bound exceeded\n");
+    return 1;
+  }
+  timeKernels();
+  return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * Integer field parser benchmark: SWAR nmeaParseUint32() against the byte
+ * loop it replaced.
+ *
+ * Checks both parsers agree on valid and invalid fields, then times them on
+ * 9 digit MMSIs, 4 to 7 digit alert identifiers/instances and short counters.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc tools/bench/benchInteger.c src/nmeaDecimal.c -o benchInteger
+ *   ./benchInteger
+ */
+
+#include "benchUtil.h"
+
+#include <stdio.h>
+
+#include "nmeaDecimal.h"
+
+#define INPUT_COUNT 8192
+#define INPUT_MAX_LENGTH 24
+#define FUZZ_COUNT 1000000
+#define ROUNDS 500
+
+typedef struct InputSet
+{
+  const char *name;
+  char text[INPUT_COUNT][INPUT_MAX_LENGTH];
+  uint8_t length[INPUT_COUNT];
+} InputSet;
+
+static InputSet mmsi;
+static InputSet alert;
+static InputSet counter;
+
+/* One digit per iteration, as nmeaFieldToUint32 did before the SWAR parser.
+ * Kept out of line like the library function it is compared with. */
+__attribute__((noinline)) static int byteLoopParse(const char *data, uint8_t length, uint32_t *value)
+{
+  uint32_t result = 0;
+  uint8_t i;
+
+  if (length == 0)
+  {
+    return 0;
+  }
+  for (i = 0; i < length; i++)
+  {
+    uint8_t digit = (uint8_t)(data[i] - '0');
+    if (digit > 9 || result > (UINT32_MAX - digit) / 10)
+    {
+      return 0;
+    }
+    result = result * 10 + digit;
+  }
+  *value = result;
+  return 1;
+}
+
+static void fill(InputSet *set, const char *name, uint32_t minDigits, uint32_t maxDigits, uint32_t seed)
+{
+  int i;
+
+  set->name = name;
+  for (i = 0; i < INPUT_COUNT; i++)
+  {
+    uint32_t digits = minDigits + benchRandom(&seed) % (maxDigits - minDigits + 1);
+    uint32_t d;
+
+    for (d = 0; d < digits; d++)
+    {
+      set->text[i][d] = (char)('0' + benchRandom(&seed) % 10);
+    }
+    set->text[i][digits] = '\0';
+    set->length[i] = (uint8_t)digits;
+  }
+}
+
+static int checkAgreement(void)
+{
+  static const char alphabet[] = "0123456789012345678901234567890123456789.,-*A/: \xff";
+  uint32_t seed = 0x3F2E1D0Cu;
+  int mismatches = 0;
+  int i;
+
+  for (i = 0; i < FUZZ_COUNT && mismatches < 20; i++)
+  {
+    char text[INPUT_MAX_LENGTH];
+    uint8_t length = (uint8_t)(1 + benchRandom(&seed) % 12);
+    uint32_t a = 0;
+    uint32_t b = 0;
+    int okA;
+    int okB;
+    uint8_t j;
+
+    for (j = 0; j < length; j++)
+    {
+      text[j] = alphabet[benchRandom(&seed) % (sizeof(alphabet) - 1)];
+    }
+    okA = byteLoopParse(text, length, &a);
+    okB = nmeaParseUint32(text, length, &b);
+    if (okA != okB || (okA && a != b))
+    {
+      printf("mismatch: '%.*s' byte loop %d/%u, SWAR %d/%u\n", length, text, okA, a, okB, b);
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+static void run(const InputSet *set)
+{
+  uint64_t total = 0;
+  uint64_t start;
+  uint64_t loopNs;
+  uint64_t swarNs;
+  int round;
+  int i;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      uint32_t value = 0;
+      byteLoopParse(set->text[i], set->length[i], &value);
+      total += value;
+    }
+  }
+  loopNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (round = 0; round < ROUNDS; round++)
+  {
+    for (i = 0; i < INPUT_COUNT; i++)
+    {
+      uint32_t value = 0;
+      nmeaParseUint32(set->text[i], set->length[i], &value);
+      total += value;
+    }
+  }
+  swarNs = benchNowNs() - start;
+  benchSink = total;
+
+  printf("%-22s byte loop %6.2f ns, SWAR %6.2f ns (%.1fx)\n", set->name,
+         (double)loopNs / (INPUT_COUNT * (double)ROUNDS), (double)swarNs / (INPUT_COUNT * (double)ROUNDS),
+         (double)loopNs / (double)swarNs);
+}
+
+int main(void)
+{
+  if (checkAgreement() != 0)
+  {
+    printf("FAILED: parsers disagree\n");
+    return 1;
+  }
+  printf("parsers agree on %d random fields\n", FUZZ_COUNT);
+
+  fill(&mmsi, "MMSI (9 digits)", 9, 9, 1u);
+  fill(&alert, "alert id (4-7 digits)", 4, 7, 2u);
+  fill(&counter, "counter (1-3 digits)", 1, 3, 3u);
+  run(&mmsi);
+  run(&alert);
+  run(&counter);
+  return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * Navigation state contention benchmark: one writer thread updating the
+ * position as fast as it can while 0 to N reader threads copy it.
+ *
+ * Every update writes the same counter into utcTime, altitude and hdop, so a
+ * reader detects a torn copy if the three differ. Reports the writer update
+ * rate and the read latency for each reader count.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -pthread -Iinc -Isrc tools/bench/benchNavState.c src/nmeaNavState.c -o benchNavState
+ *   ./benchNavState [max readers]
+ */
+
+#include "benchUtil.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "nmeaNavState.h"
+
+#define RUN_NS 500000000u
+#define MAX_READERS 16
+
+typedef struct Reader
+{
+  pthread_t thread;
+  uint64_t reads;
+  uint64_t torn;
+} Reader;
+
+static NmeaNavState state;
+static volatile int running;
+static uint64_t writes;
+
+static void *writerMain(void *unused)
+{
+  NmeaSentence sentence = {0};
+  SENTENCE_GGA *gga = &sentence.gga;
+  uint32_t k = 0;
+
+  (void)unused;
+  gga->addressField.sentenceId = GGA;
+  gga->presentFields = GGA_ALL_PRESENT;
+  gga->latitude = 4807.04f;
+  gga->latitudePolarity = NORTH;
+  gga->longitude = 1131.0f;
+  gga->longitudePolarity = EAST;
+  gga->qualityIndicator = GPS_FIX_SPS;
+  while (running)
+  {
+    /* Exact in a float up to 2^24 */
+    float value = (float)(k++ & 0xFFFFFFu);
+    gga->utcTime = value;
+    gga->altitude = value;
+    gga->hdop = value;
+    nmeaNavStateUpdate(&state, &sentence);
+  }
+  writes = k;
+  return NULL;
+}
+
+static void *readerMain(void *argument)
+{
+  Reader *reader = (Reader *)argument;
+  NmeaNavPosition position;
+
+  while (running)
+  {
+    nmeaNavStateReadPosition(&state, &position);
+    if (position.altitude != position.utcTime || position.hdop != position.utcTime)
+    {
+      reader->torn++;
+    }
+    reader->reads++;
+  }
+  return NULL;
+}
+
+/* Returns the number of torn reads */
+static uint64_t run(int readerCount)
+{
+  static Reader readers[MAX_READERS];
+  pthread_t writer;
+  uint64_t reads = 0;
+  uint64_t torn = 0;
+  uint64_t start;
+  uint64_t elapsed;
+  int i;
+
+  nmeaNavStateInit(&state);
+  running = 1;
+  start = benchNowNs();
+  pthread_create(&writer, NULL, writerMain, NULL);
+  for (i = 0; i < readerCount; i++)
+  {
+    readers[i].reads = 0;
+    readers[i].torn = 0;
+    pthread_create(&readers[i].thread, NULL, readerMain, &readers[i]);
+  }
+  while (benchNowNs() - start < RUN_NS)
+  {
+    struct timespec pause = {0, 1000000};
+    nanosleep(&pause, NULL);
+  }
+  running = 0;
+  pthread_join(writer, NULL);
+  for (i = 0; i < readerCount; i++)
+  {
+    pthread_join(readers[i].thread, NULL);
+    reads += readers[i].reads;
+    torn += readers[i].torn;
+  }
+  elapsed = benchNowNs() - start;
+
+  printf("%2d readers: %7.2f M updates/s", readerCount, (double)writes * 1e3 / (double)elapsed);
+  if (readerCount > 0)
+  {
+    printf(", %7.2f M reads/s per reader (%6.1f ns/read), %llu torn",
+           (double)reads * 1e3 / (double)elapsed / readerCount, (double)elapsed * readerCount / (double)reads,
+           (unsigned long long)torn);
+  }
+  printf("\n");
+  return torn;
+}
+
+int main(int argc, char **argv)
+{
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int maxReaders = argc > 1 ? atoi(argv[1]) : (int)(cores > 1 ? cores - 1 : 1);
+  uint64_t torn = 0;
+  int readers;
+
+  if (maxReaders > MAX_READERS)
+  {
+    maxReaders = MAX_READERS;
+  }
+  printf("%ld cores online\n", cores);
+  torn += run(0);
+  for (readers = 1; readers <= maxReaders; readers *= 2)
+  {
+    torn += run(readers);
+  }
+  if (torn != 0)
+  {
+    printf("FAILED: readers saw torn records\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Output writer benchmark (Linux): system calls and time per sentence when
+ * encoding sentences to a file, /dev/null and a local UDP socket, one write
+ * per sentence against batches coalesced by platform/linux/nmeaOutput.c.
+ *
+ * "per sentence" is the writer with flushCount 1, i.e. a writev() or
+ * sendmmsg() for every sentence, as an unbatched gateway would write();
+ * "batched" flushes at NMEA_OUTPUT_MAX_SENTENCES sentences or 4096 bytes.
+ * The deadline is set far out so that only size and count trigger.
+ *
+ * Checks that the batched file holds exactly the sentences encoded.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools -Iplatform/linux tools/bench/benchOutput.c \
+ *      platform/linux/nmeaOutput.c src/nmea*.c -lm -o benchOutput
+ *   ./benchOutput
+ */
+
+#include "benchUtil.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "nmea0183.h"
+#include "nmeaOutput.h"
+#include "nmeaTestVectors.h"
+
+#define SENTENCES 200000
+#define MAX_VECTORS 64
+#define FILE_PATH "/tmp/benchOutput.nmea"
+
+static NmeaSentence decoded[MAX_VECTORS];
+static int decodedCount;
+static NmeaOutputWriter writer;
+static uint64_t encodedBytes; /* Bytes SENTENCES sentences encode to */
+
+static int decodeVectors(void)
+{
+  const NmeaTestVector *vector;
+  char buffer[NMEA_MAX_SENTENCE_LENGTH + 1];
+  int i;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL && decodedCount < MAX_VECTORS; vector++)
+  {
+    if (nmeaDecode(vector->sentence, strlen(vector->sentence), &decoded[decodedCount]) != NMEA_OK)
+    {
+      printf("FAILED: %s", vector->sentence);
+      return -1;
+    }
+    decodedCount++;
+  }
+  for (i = 0; i < SENTENCES; i++)
+  {
+    size_t length;
+
+    nmeaEncode(&decoded[i % decodedCount], buffer, sizeof(buffer), &length);
+    encodedBytes += length;
+  }
+  return 0;
+}
+
+static void measure(const char *name, int fd, NmeaOutputKind kind, uint16_t flushCount)
+{
+  uint64_t start;
+  uint64_t elapsed;
+  int i;
+
+  nmeaOutputInit(&writer, fd, kind, NMEA_OUTPUT_BUFFER_SIZE, flushCount, 1000000u);
+  start = benchNowNs();
+  for (i = 0; i < SENTENCES; i++)
+  {
+    nmeaOutputEncode(&writer, &decoded[i % decodedCount]);
+  }
+  nmeaOutputFlush(&writer);
+  elapsed = benchNowNs() - start;
+  printf("%-12s %-13s %10u %12.3f %10.1f %10u\n", name, flushCount == 1 ? "per sentence" : "batched",
+         writer.statistics.syscalls, (double)writer.statistics.syscalls / SENTENCES, (double)elapsed / SENTENCES,
+         writer.statistics.dropped);
+}
+
+static int checkFile(void)
+{
+  struct stat status;
+
+  if (stat(FILE_PATH, &status) != 0 || (uint64_t)status.st_size != encodedBytes ||
+      writer.statistics.sentences != SENTENCES)
+  {
+    printf("FAILED: %s does not hold the %d sentences written\n", FILE_PATH, SENTENCES);
+    return -1;
+  }
+  return 0;
+}
+
+static int openFile(void)
+{
+  return open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+
+int main(void)
+{
+  struct sockaddr_in address;
+  socklen_t addressLength = sizeof(address);
+  int receiver;
+  int sender;
+  int fd;
+  int failures = 0;
+
+  if (decodeVectors() != 0)
+  {
+    return 1;
+  }
+
+  printf("%d sentences, %.1f bytes each on average\n\n", SENTENCES, (double)encodedBytes / SENTENCES);
+  printf("%-12s %-13s %10s %12s %10s %10s\n", "output", "flush", "syscalls", "per sentence", "ns/sent.", "dropped");
+
+  fd = openFile();
+  measure("file", fd, NMEA_OUTPUT_STREAM, 1);
+  close(fd);
+  fd = openFile();
+  measure("file", fd, NMEA_OUTPUT_STREAM, NMEA_OUTPUT_MAX_SENTENCES);
+  close(fd);
+  failures += checkFile() != 0;
+  unlink(FILE_PATH);
+
+  fd = open("/dev/null", O_WRONLY);
+  measure("/dev/null", fd, NMEA_OUTPUT_STREAM, 1);
+  measure("/dev/null", fd, NMEA_OUTPUT_STREAM, NMEA_OUTPUT_MAX_SENTENCES);
+  close(fd);
+
+  /* The receiver is never read: the kernel drops what overflows its buffer,
+   * the sender side cost is what is measured */
+  receiver = socket(AF_INET, SOCK_DGRAM, 0);
+  sender = socket(AF_INET, SOCK_DGRAM, 0);
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (receiver < 0 || sender < 0 || bind(receiver, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+      getsockname(receiver, (struct sockaddr *)&address, &addressLength) != 0 ||
+      connect(sender, (struct sockaddr *)&address, sizeof(address)) != 0)
+  {
+    perror("UDP socket");
+    return 1;
+  }
+  measure("UDP", sender, NMEA_OUTPUT_DATAGRAM, 1);
+  measure("UDP", sender, NMEA_OUTPUT_DATAGRAM, NMEA_OUTPUT_MAX_SENTENCES);
+  close(sender);
+  close(receiver);
+  return failures != 0;
+}
@@ -0,0 +1,423 @@
+/*
+ * End-to-end latency testbench (Linux): pseudo terminal pairs stand in for
+ * serial ports, a writer thread per port plays sentences into the master
+ * side at the pace of a UART of the given baud rate, and one poll() reader
+ * feeds the slave sides into a parser each. Measured per sentence:
+ *
+ *   end to end  completing byte written to the master -> parser callback
+ *   in parser   read() of that byte returned          -> parser callback
+ *
+ * the difference being the time the byte spent in the kernel and waiting
+ * for the reader. Both are reported as percentiles and a histogram.
+ *
+ * The parser completes a sentence at its last checksum digit, not at the
+ * CR/LF after it, so that is the byte timed. The writer hands bytes to the
+ * kernel in the chunks a UART would have received by then, and the
+ * completing byte always on its own, so its timestamp is exact.
+ *
+ * Sentences come from the test vectors or from a file (e.g. written by
+ * tools/nmeatraffic.py); only those the parser decodes are played, so that
+ * every sentence is matched by one callback.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -pthread -Iinc -Isrc -Itools tools/bench/benchPty.c src/nmea*.c -lm -o benchPty
+ *   ./benchPty [--ports N] [--baud B] [--sentences N] [--file FILE]
+ * --baud 0 writes without pacing, which measures the backlog under
+ * saturation instead of the latency of a single sentence.
+ */
+
+#define _XOPEN_SOURCE 700 /* posix_openpt() */
+#include "benchUtil.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "nmea0183.h"
+#include "nmeaTestVectors.h"
+
+#define MAX_PORTS 16
+#define MAX_SENTENCES 4096 /* Distinct sentences played in turn */
+#define BITS_PER_BYTE 10u  /* Start bit, 8 data bits, stop bit */
+#define READ_SIZE 256
+#define IDLE_TIMEOUT_MS 2000 /* Nothing read for this long ends the run */
+#define HISTOGRAM_BUCKETS 24 /* Powers of two of microseconds */
+
+typedef struct Port
+{
+  int master;
+  int slave;
+  pthread_t writer;
+  NmeaParser parser;
+  uint64_t *written; /* Per sentence: when its completing byte was written */
+  uint64_t readAt;   /* When the read() being fed returned */
+  uint32_t delivered;
+} Port;
+
+static Port ports[MAX_PORTS];
+static int portCount = 1;
+static uint32_t baud = 38400;
+static uint32_t sentencesPerPort = 500;
+
+static char *sentences[MAX_SENTENCES];
+static size_t sentenceLengths[MAX_SENTENCES];
+static size_t completions[MAX_SENTENCES]; /* Index of the last checksum digit */
+static uint32_t sentenceCount;
+
+static uint64_t *endToEnd;
+static uint64_t *inParser;
+static uint32_t latencyCount;
+
+static void onSentence(const NmeaSentence *sentence, void *context)
+{
+  Port *port = (Port *)context;
+  uint64_t now = benchNowNs();
+
+  (void)sentence;
+  if (port->delivered < sentencesPerPort)
+  {
+    endToEnd[latencyCount] = now - __atomic_load_n(&port->written[port->delivered], __ATOMIC_ACQUIRE);
+    inParser[latencyCount] = now - port->readAt;
+    latencyCount++;
+  }
+  port->delivered++;
+}
+
+/* Keeps a sentence if the parser decodes it */
+static void addSentence(const char *text, size_t length)
+{
+  static NmeaSentence decoded;
+
+  if (sentenceCount < MAX_SENTENCES && nmeaDecode(text, length, &decoded) == NMEA_OK)
+  {
+    sentences[sentenceCount] = (char *)malloc(length);
+    memcpy(sentences[sentenceCount], text, length);
+    completions[sentenceCount] = (size_t)(strchr(text, '*') - text) + 2u;
+    sentenceLengths[sentenceCount++] = length;
+  }
+}
+
+static int loadSentences(const char *path)
+{
+  const NmeaTestVector *vector;
+  char line[256];
+  FILE *file;
+
+  if (path == NULL)
+  {
+    for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+    {
+      addSentence(vector->sentence, strlen(vector->sentence));
+    }
+    return 0;
+  }
+  file = fopen(path, "r");
+  if (file == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    addSentence(line, strlen(line));
+  }
+  fclose(file);
+  return 0;
+}
+
+static int openPort(Port *port)
+{
+  struct termios attributes;
+
+  port->master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (port->master < 0 || grantpt(port->master) != 0 || unlockpt(port->master) != 0)
+  {
+    perror("posix_openpt");
+    return -1;
+  }
+  port->slave = open(ptsname(port->master), O_RDWR | O_NOCTTY);
+  if (port->slave < 0 || tcgetattr(port->slave, &attributes) != 0)
+  {
+    perror("pty slave");
+    return -1;
+  }
+  /* Raw: no line buffering, echo or CR/LF translation */
+  attributes.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+  attributes.c_oflag &= ~(tcflag_t)OPOST;
+  attributes.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+  attributes.c_cflag = (attributes.c_cflag & ~(tcflag_t)(CSIZE | PARENB)) | CS8;
+  attributes.c_cc[VMIN] = 1;
+  attributes.c_cc[VTIME] = 0;
+  if (tcsetattr(port->slave, TCSANOW, &attributes) != 0)
+  {
+    perror("tcsetattr");
+    return -1;
+  }
+  port->written = (uint64_t *)calloc(sentencesPerPort, sizeof(port->written[0]));
+  nmeaParserInit(&port->parser, onSentence, port);
+  return 0;
+}
+
+static void sleepUntil(uint64_t ns)
+{
+  struct timespec due;
+
+  due.tv_sec = (time_t)(ns / 1000000000u);
+  due.tv_nsec = (long)(ns % 1000000000u);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL) == EINTR)
+  {
+  }
+}
+
+static void writeAll(int fd, const char *data, size_t length)
+{
+  while (length > 0)
+  {
+    ssize_t written = write(fd, data, length);
+
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      perror("write");
+      return;
+    }
+    data += written;
+    length -= (size_t)written;
+  }
+}
+
+/* Plays the sentences in turn, each byte not before a UART would have
+ * received it */
+static void *writePort(void *context)
+{
+  Port *port = (Port *)context;
+  uint64_t byteNs = baud > 0 ? 1000000000u * (uint64_t)BITS_PER_BYTE / baud : 0;
+  uint64_t start = benchNowNs();
+  uint64_t bytes = 0;
+  uint32_t s;
+
+  for (s = 0; s < sentencesPerPort; s++)
+  {
+    uint32_t index = (s + (uint32_t)(port - ports)) % sentenceCount;
+    const char *text = sentences[index];
+    size_t length = sentenceLengths[index];
+    size_t completion = completions[index];
+    size_t i = 0;
+
+    while (i < length)
+    {
+      size_t end = i + 1u;
+      uint64_t now;
+
+      sleepUntil(start + (bytes + i + 1u) * byteNs);
+      /* Whatever else has arrived by now, the completing byte on its own */
+      now = benchNowNs();
+      while (i != completion && end < length && end != completion && start + (bytes + end + 1u) * byteNs <= now)
+      {
+        end++;
+      }
+      if (i == completion)
+      {
+        /* Stored before the write so the reader always finds it; the pty
+         * is not a synchronisation point the memory model knows about */
+        __atomic_store_n(&port->written[s], benchNowNs(), __ATOMIC_RELEASE);
+      }
+      writeAll(port->master, &text[i], end - i);
+      i = end;
+    }
+    bytes += length;
+  }
+  return NULL;
+}
+
+/* Reads every port until all sentences arrived or the ports fall silent */
+static void readPorts(void)
+{
+  struct pollfd fds[MAX_PORTS];
+  uint8_t buffer[READ_SIZE];
+  uint32_t expected = (uint32_t)portCount * sentencesPerPort;
+  int i;
+
+  for (i = 0; i < portCount; i++)
+  {
+    fds[i].fd = ports[i].slave;
+    fds[i].events = POLLIN;
+  }
+  while (latencyCount < expected)
+  {
+    int ready = poll(fds, (nfds_t)portCount, IDLE_TIMEOUT_MS);
+
+    if (ready <= 0)
+    {
+      break;
+    }
+    for (i = 0; i < portCount; i++)
+    {
+      if (fds[i].revents & POLLIN)
+      {
+        ssize_t length = read(ports[i].slave, buffer, sizeof(buffer));
+
+        ports[i].readAt = benchNowNs();
+        if (length > 0)
+        {
+          nmeaFeed(&ports[i].parser, buffer, (size_t)length);
+        }
+      }
+    }
+  }
+}
+
+static int compareUint64(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+static double percentileUs(const uint64_t *sorted, uint32_t count, double fraction)
+{
+  return (double)sorted[(size_t)(fraction * (double)(count - 1u))] / 1000.0;
+}
+
+static void report(const char *name, uint64_t *latencies, uint32_t count)
+{
+  uint32_t buckets[HISTOGRAM_BUCKETS] = {0};
+  uint32_t largest = 0;
+  int first = HISTOGRAM_BUCKETS;
+  int last = 0;
+  uint32_t i;
+  int b;
+
+  qsort(latencies, count, sizeof(latencies[0]), compareUint64);
+  printf("%-12s p50 %8.1f  p90 %8.1f  p99 %8.1f  p99.9 %8.1f  max %8.1f us\n", name,
+         percentileUs(latencies, count, 0.5), percentileUs(latencies, count, 0.9),
+         percentileUs(latencies, count, 0.99), percentileUs(latencies, count, 0.999),
+         percentileUs(latencies, count, 1.0));
+
+  for (i = 0; i < count; i++)
+  {
+    uint64_t us = latencies[i] / 1000u;
+
+    b = 0;
+    while (us > 0 && b < HISTOGRAM_BUCKETS - 1)
+    {
+      us >>= 1;
+      b++;
+    }
+    buckets[b]++;
+    largest = buckets[b] > largest ? buckets[b] : largest;
+    first = b < first ? b : first;
+    last = b > last ? b : last;
+  }
+  for (b = first; b <= last; b++)
+  {
+    /* Bucket b holds latencies below 2^b microseconds */
+    printf("  < %8lu us %8u ", 1ul << b, buckets[b]);
+    for (i = 0; i < 50u * buckets[b] / largest; i++)
+    {
+      putchar('#');
+    }
+    putchar('\n');
+  }
+}
+
+static bool parseOption(int argc, char **argv, int *i, const char *name, uint32_t *value)
+{
+  if (strcmp(argv[*i], name) != 0 || *i + 1 >= argc)
+  {
+    return false;
+  }
+  *value = (uint32_t)strtoul(argv[++*i], NULL, 10);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = NULL;
+  uint32_t count = (uint32_t)portCount;
+  uint32_t lost;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!parseOption(argc, argv, &i, "--ports", &count) && !parseOption(argc, argv, &i, "--baud", &baud) &&
+        !parseOption(argc, argv, &i, "--sentences", &sentencesPerPort))
+    {
+      if (strcmp(argv[i], "--file") == 0 && i + 1 < argc)
+      {
+        path = argv[++i];
+        continue;
+      }
+      fprintf(stderr, "usage: %s [--ports N] [--baud B] [--sentences N] [--file FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (count < 1 || count > MAX_PORTS || sentencesPerPort < 1)
+  {
+    fprintf(stderr, "--ports must be 1 to %d, --sentences at least 1\n", MAX_PORTS);
+    return 2;
+  }
+  portCount = (int)count;
+  if (loadSentences(path) != 0)
+  {
+    return 1;
+  }
+  if (sentenceCount == 0)
+  {
+    fprintf(stderr, "FAILED: no sentence the parser decodes\n");
+    return 1;
+  }
+
+  endToEnd = (uint64_t *)calloc((size_t)portCount * sentencesPerPort, sizeof(endToEnd[0]));
+  inParser = (uint64_t *)calloc((size_t)portCount * sentencesPerPort, sizeof(inParser[0]));
+  for (i = 0; i < portCount; i++)
+  {
+    if (openPort(&ports[i]) != 0)
+    {
+      return 1;
+    }
+  }
+  for (i = 0; i < portCount; i++)
+  {
+    pthread_create(&ports[i].writer, NULL, writePort, &ports[i]);
+  }
+  readPorts();
+  for (i = 0; i < portCount; i++)
+  {
+    pthread_join(ports[i].writer, NULL);
+  }
+
+  printf("%d port(s) at %u baud, %u sentences each, %u distinct\n\n", portCount, baud, sentencesPerPort,
+         sentenceCount);
+  lost = (uint32_t)portCount * sentencesPerPort - latencyCount;
+  if (latencyCount == 0)
+  {
+    fprintf(stderr, "FAILED: no sentence delivered\n");
+    return 1;
+  }
+  report("end to end", endToEnd, latencyCount);
+  printf("\n");
+  report("in parser", inParser, latencyCount);
+  for (i = 0; i < portCount; i++)
+  {
+    close(ports[i].slave);
+    close(ports[i].master);
+  }
+  if (lost != 0)
+  {
+    printf("\nFAILED: %u sentence(s) not delivered\n", lost);
+    return 1;
+  }
+  return 0;
+}
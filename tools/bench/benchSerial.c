@@ -0,0 +1,272 @@
+/*
+ * CPU cost of the Linux serial reader (platform/linux/nmeaSerial.c) at full
+ * line load: pseudo terminals configured by nmeaSerialConfigure() stand in
+ * for the ports, one writer thread keeps every port busy at the byte rate of
+ * the baud rate with sentences back to back, and the reader thread runs
+ * nmeaSerialReaderPoll() on all of them.
+ *
+ * Reported: reader thread CPU time in total and per port, as a share of one
+ * core, and the reads (wakeups) per second and bytes per read per port.
+ * The writer hands bytes over every TICK_US, like a UART driver emptying its
+ * FIFO; the reader thread CPU time does not include the writer.
+ *
+ * Checks that every sentence written was delivered, without framing or
+ * checksum errors.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -pthread -Iinc -Isrc -Itools -Iplatform/linux tools/bench/benchSerial.c \
+ *      platform/linux/nmeaSerial.c src/nmea*.c -lm -o benchSerial
+ *   ./benchSerial [--ports N] [--baud B] [--seconds S]
+ */
+
+#define _XOPEN_SOURCE 700 /* posix_openpt() */
+#include "benchUtil.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "nmea0183.h"
+#include "nmeaSerial.h"
+#include "nmeaTestVectors.h"
+
+#define TICK_US 1000
+#define BITS_PER_BYTE 10u
+#define STREAM_SIZE 65536
+
+typedef struct Link
+{
+  int master;
+  int slave;
+  uint64_t written; /* Bytes written, the stream repeating */
+} Link;
+
+static NmeaSerialReader reader;
+static Link links[NMEA_SERIAL_MAX_PORTS];
+static int portCount = NMEA_SERIAL_MAX_PORTS;
+static uint32_t baud = 38400;
+static uint32_t seconds = 10;
+static volatile bool writing = true;
+
+static char stream[STREAM_SIZE];
+static size_t streamLength;
+static uint32_t streamSentences;
+static size_t sentenceEnds[STREAM_SIZE / 16];
+
+static void countSentence(const NmeaSentence *sentence, void *context)
+{
+  (void)context;
+  benchSink += sentence->addressField.sentenceId;
+}
+
+/* The test vectors back to back, the stream starting over after its end */
+static void makeStream(void)
+{
+  const NmeaTestVector *vector;
+
+  while (streamLength < STREAM_SIZE / 2)
+  {
+    for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+    {
+      size_t length = strlen(vector->sentence);
+
+      memcpy(&stream[streamLength], vector->sentence, length);
+      streamLength += length;
+      sentenceEnds[streamSentences++] = streamLength;
+    }
+  }
+}
+
+/* Sentences complete in the first bytes of the repeating stream */
+static uint32_t completedSentences(uint64_t bytes)
+{
+  uint32_t count = (uint32_t)(bytes / streamLength) * streamSentences;
+  uint32_t i;
+
+  for (i = 0; i < streamSentences && sentenceEnds[i] <= bytes % streamLength; i++)
+  {
+    count++;
+  }
+  return count;
+}
+
+static int openLink(Link *link)
+{
+  link->master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (link->master < 0 || grantpt(link->master) != 0 || unlockpt(link->master) != 0)
+  {
+    perror("posix_openpt");
+    return -1;
+  }
+  link->slave = open(ptsname(link->master), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (link->slave < 0 || !nmeaSerialConfigure(link->slave, baud))
+  {
+    perror("pty slave");
+    return -1;
+  }
+  return 0;
+}
+
+/* Writes what each port would have received by now, every TICK_US */
+static void *writeLinks(void *context)
+{
+  uint64_t start = benchNowNs();
+  uint64_t tick;
+  int i;
+
+  (void)context;
+  for (tick = 1; writing; tick++)
+  {
+    uint64_t due = (uint64_t)baud / BITS_PER_BYTE * tick * TICK_US / 1000000u;
+    struct timespec pause = {0, TICK_US * 1000};
+
+    for (i = 0; i < portCount; i++)
+    {
+      Link *link = &links[i];
+
+      while (link->written < due)
+      {
+        size_t offset = (size_t)(link->written % streamLength);
+        size_t length = streamLength - offset;
+        ssize_t written;
+
+        length = length < due - link->written ? length : (size_t)(due - link->written);
+        written = write(link->master, &stream[offset], length);
+        if (written <= 0)
+        {
+          break;
+        }
+        link->written += (uint64_t)written;
+      }
+    }
+    /* Catch up rather than drift when a tick ran late */
+    if (benchNowNs() < start + tick * TICK_US * 1000u)
+    {
+      nanosleep(&pause, NULL);
+    }
+  }
+  return NULL;
+}
+
+static uint64_t threadCpuNs(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static bool parseOption(int argc, char **argv, int *i, const char *name, uint32_t *value)
+{
+  if (strcmp(argv[*i], name) != 0 || *i + 1 >= argc)
+  {
+    return false;
+  }
+  *value = (uint32_t)strtoul(argv[++*i], NULL, 10);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t count = (uint32_t)portCount;
+  pthread_t writer;
+  uint64_t wallStart;
+  uint64_t cpuStart;
+  double wall;
+  double cpu;
+  uint64_t reads = 0;
+  uint64_t bytes = 0;
+  uint32_t delivered = 0;
+  uint32_t expected = 0;
+  uint32_t errors = 0;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!parseOption(argc, argv, &i, "--ports", &count) && !parseOption(argc, argv, &i, "--baud", &baud) &&
+        !parseOption(argc, argv, &i, "--seconds", &seconds))
+    {
+      fprintf(stderr, "usage: %s [--ports N] [--baud B] [--seconds S]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (count < 1 || count > NMEA_SERIAL_MAX_PORTS || seconds < 1)
+  {
+    fprintf(stderr, "--ports must be 1 to %d, --seconds at least 1\n", NMEA_SERIAL_MAX_PORTS);
+    return 2;
+  }
+  portCount = (int)count;
+  makeStream();
+  if (!nmeaSerialReaderInit(&reader))
+  {
+    perror("epoll");
+    return 1;
+  }
+  for (i = 0; i < portCount; i++)
+  {
+    if (openLink(&links[i]) != 0 || nmeaSerialReaderAdd(&reader, links[i].slave, countSentence, NULL) != i)
+    {
+      fprintf(stderr, "FAILED: port %d could not be set up at %u baud\n", i, baud);
+      return 1;
+    }
+  }
+
+  pthread_create(&writer, NULL, writeLinks, NULL);
+  wallStart = benchNowNs();
+  cpuStart = threadCpuNs();
+  while (benchNowNs() - wallStart < (uint64_t)seconds * 1000000000u)
+  {
+    if (nmeaSerialReaderPoll(&reader, 100) < 0)
+    {
+      perror("epoll_wait");
+      return 1;
+    }
+  }
+  cpu = (double)(threadCpuNs() - cpuStart) / 1e9;
+  wall = (double)(benchNowNs() - wallStart) / 1e9;
+  for (i = 0; i < portCount; i++)
+  {
+    reads += reader.ports[i].reads;
+    bytes += reader.ports[i].bytes;
+  }
+  writing = false;
+  pthread_join(writer, NULL);
+  /* Drain what is still in flight */
+  while (nmeaSerialReaderPoll(&reader, 100) > 0)
+  {
+  }
+
+  for (i = 0; i < portCount; i++)
+  {
+    const NmeaSerialPort *port = &reader.ports[i];
+
+    delivered += port->parser.statistics.sentences;
+    errors += port->parser.statistics.framingErrors + port->parser.statistics.checksumErrors;
+    expected += completedSentences(links[i].written);
+  }
+
+  printf("%d port(s) at %u baud for %.1f s, %.0f bytes/s per port\n\n", portCount, baud, wall,
+         (double)bytes / wall / portCount);
+  printf("reader CPU      %8.3f s  %6.2f %% of one core\n", cpu, cpu / wall * 100.0);
+  printf("per port        %8.3f s  %6.3f %% of one core\n", cpu / portCount, cpu / wall * 100.0 / portCount);
+  printf("per 1000 bytes  %8.2f us\n", cpu * 1e6 / ((double)bytes / 1000.0));
+  printf("reads per port  %8.0f /s  %6.1f bytes per read\n", (double)reads / wall / portCount,
+         reads != 0 ? (double)bytes / (double)reads : 0.0);
+
+  nmeaSerialReaderClose(&reader);
+  for (i = 0; i < portCount; i++)
+  {
+    close(links[i].slave);
+    close(links[i].master);
+  }
+  if (delivered != expected || errors != 0)
+  {
+    printf("\nFAILED: %u of %u sentences delivered, %u framing or checksum errors\n", delivered, expected, errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,247 @@
+/*
+ * Shared-memory broadcast benchmark (Linux): one publisher process and
+ * READERS reader processes on platform/linux/nmeaShared.c, against the UDP
+ * fan-out it replaces (one datagram per reader per sentence).
+ *
+ * Two runs: a burst, published as fast as possible, where slow readers may
+ * lose records (counted, never torn), and a paced run at PACED_RATE
+ * sentences per second, where no reader may lose any. Every reader checks
+ * each record it receives against the sentence published under that
+ * sequence number; a mismatch means a torn read and fails the benchmark.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools -Iplatform/linux tools/bench/benchShared.c \
+ *      platform/linux/nmeaShared.c src/nmea*.c -lm -o benchShared
+ *   ./benchShared
+ */
+
+#include "benchUtil.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "nmea0183.h"
+#include "nmeaShared.h"
+#include "nmeaTestVectors.h"
+
+#define READERS 4
+#define BURST_SENTENCES 1000000u
+#define PACED_SENTENCES 100000u
+#define PACED_RATE 20000u /* Sentences per second */
+#define PACED_BATCH 20u   /* Sentences published per sleep */
+#define MAX_VECTORS 64
+
+typedef struct ReaderResult
+{
+  uint64_t received;
+  uint64_t lost;
+  uint64_t torn;
+} ReaderResult;
+
+static NmeaSentence decoded[MAX_VECTORS];
+static uint32_t decodedCount;
+static NmeaSharedPublisher publisher;
+
+static int decodeVectors(void)
+{
+  const NmeaTestVector *vector;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL && decodedCount < MAX_VECTORS; vector++)
+  {
+    memset(&decoded[decodedCount], 0, sizeof(decoded[0]));
+    if (nmeaDecode(vector->sentence, strlen(vector->sentence), &decoded[decodedCount]) != NMEA_OK)
+    {
+      printf("FAILED: %s", vector->sentence);
+      return -1;
+    }
+    decodedCount++;
+  }
+  return 0;
+}
+
+/* Child: follows the ring until total records went by, zero copy */
+static void runReader(uint64_t total, int ready, int results)
+{
+  NmeaSharedReader reader;
+  ReaderResult result = {0, 0, 0};
+
+  if (!nmeaSharedAttach(&reader, publisher.fd))
+  {
+    perror("nmeaSharedAttach");
+    _exit(1);
+  }
+  (void)write(ready, "r", 1);
+  while (reader.cursor < total)
+  {
+    const NmeaSentence *record;
+
+    if (!nmeaSharedWait(&reader, 100))
+    {
+      continue;
+    }
+    while ((record = nmeaSharedPeek(&reader)) != NULL)
+    {
+      uint64_t sequence = reader.cursor;
+      bool same = memcmp(record, &decoded[sequence % decodedCount], sizeof(*record)) == 0;
+
+      if (nmeaSharedConsume(&reader))
+      {
+        result.received++;
+        result.torn += !same;
+      }
+    }
+  }
+  result.lost = reader.lost;
+  (void)write(results, &result, sizeof(result));
+  nmeaSharedDetach(&reader);
+  _exit(0);
+}
+
+/* Publishes total sentences, at rate per second or as fast as possible (0),
+ * and returns the nanoseconds per publication */
+static double runPublisher(uint64_t total, uint32_t rate, int *failures)
+{
+  int ready[2];
+  int results[2];
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t i;
+  char byte;
+  int r;
+
+  if (pipe(ready) != 0 || pipe(results) != 0 || !nmeaSharedCreate(&publisher, NULL, 0))
+  {
+    perror("setup");
+    *failures += 1;
+    return 0.0;
+  }
+  for (r = 0; r < READERS; r++)
+  {
+    if (fork() == 0)
+    {
+      runReader(total, ready[1], results[1]);
+    }
+  }
+  for (r = 0; r < READERS; r++)
+  {
+    (void)read(ready[0], &byte, 1);
+  }
+
+  start = benchNowNs();
+  for (i = 0; i < total; i++)
+  {
+    if (rate != 0 && i % PACED_BATCH == 0)
+    {
+      uint64_t due = start + i * 1000000000u / rate;
+      uint64_t now = benchNowNs();
+      struct timespec pause = {0, (long)(due > now ? due - now : 0)};
+
+      /* Sleep rather than spin, the readers may share the core */
+      nanosleep(&pause, NULL);
+    }
+    nmeaSharedPublish(&publisher, &decoded[i % decodedCount]);
+  }
+  elapsed = benchNowNs() - start;
+
+  for (r = 0; r < READERS; r++)
+  {
+    ReaderResult result;
+
+    if (read(results[0], &result, sizeof(result)) != (ssize_t)sizeof(result))
+    {
+      *failures += 1;
+      continue;
+    }
+    printf("  reader %d: %10llu received %10llu lost %llu torn\n", r, (unsigned long long)result.received,
+           (unsigned long long)result.lost, (unsigned long long)result.torn);
+    *failures += result.torn != 0 || result.received + result.lost != total || (rate != 0 && result.lost != 0);
+  }
+  while (wait(NULL) > 0)
+  {
+  }
+  nmeaSharedDestroy(&publisher);
+  close(ready[0]);
+  close(ready[1]);
+  close(results[0]);
+  close(results[1]);
+  return (double)elapsed / (double)total;
+}
+
+/* The fan-out being replaced: the encoded sentence sent to every reader */
+static double runUdpFanOut(uint64_t total)
+{
+  int receivers[READERS];
+  int sender = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in addresses[READERS];
+  char text[NMEA_MAX_SENTENCE_LENGTH + 1];
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t i;
+  int r;
+
+  for (r = 0; r < READERS; r++)
+  {
+    socklen_t length = sizeof(addresses[r]);
+
+    receivers[r] = socket(AF_INET, SOCK_DGRAM, 0);
+    memset(&addresses[r], 0, sizeof(addresses[r]));
+    addresses[r].sin_family = AF_INET;
+    addresses[r].sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(receivers[r], (struct sockaddr *)&addresses[r], sizeof(addresses[r]));
+    getsockname(receivers[r], (struct sockaddr *)&addresses[r], &length);
+  }
+  start = benchNowNs();
+  for (i = 0; i < total; i++)
+  {
+    size_t length;
+
+    nmeaEncode(&decoded[i % decodedCount], text, sizeof(text), &length);
+    for (r = 0; r < READERS; r++)
+    {
+      sendto(sender, text, length, 0, (struct sockaddr *)&addresses[r], sizeof(addresses[r]));
+    }
+  }
+  elapsed = benchNowNs() - start;
+  for (r = 0; r < READERS; r++)
+  {
+    close(receivers[r]);
+  }
+  close(sender);
+  return (double)elapsed / (double)total;
+}
+
+int main(void)
+{
+  int failures = 0;
+  double burst;
+  double paced;
+  double udp;
+
+  if (decodeVectors() != 0)
+  {
+    return 1;
+  }
+  printf("%d readers, %u slots of %u bytes\n\n", READERS, NMEA_SHARED_SLOTS, (unsigned)sizeof(NmeaSharedSlot));
+  printf("burst, %u sentences as fast as possible:\n", BURST_SENTENCES);
+  burst = runPublisher(BURST_SENTENCES, 0, &failures);
+  printf("paced, %u sentences at %u/s:\n", PACED_SENTENCES, PACED_RATE);
+  paced = runPublisher(PACED_SENTENCES, PACED_RATE, &failures);
+  udp = runUdpFanOut(PACED_SENTENCES);
+
+  printf("\npublisher cost per sentence\n");
+  printf("  shared memory, burst  %8.1f ns\n", burst);
+  printf("  shared memory, paced  %8.1f ns (including sleeps)\n", paced);
+  printf("  UDP fan-out           %8.1f ns (encode + %d datagrams)\n", udp, READERS);
+  if (failures != 0)
+  {
+    printf("\nFAILED: torn or missing records\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Load shedder benchmark: a gateway input mix (AIS traffic, satellites,
+ * position, heading and alerts) offered at multiples of what the draining
+ * side may decode, through src/nmeaShedder.c.
+ *
+ * Every round feeds LOAD x DRAIN_BUDGET sentences to the framing side and
+ * then drains with a budget of DRAIN_BUDGET sentences, like an interrupt
+ * outrunning a main loop with a fixed CPU share. Reported per priority class:
+ * sentences offered, delivered, shed and lost to a full queue. Then the cost
+ * of a sentence shed at framing against one framed, queued and decoded.
+ *
+ * Checks at every load that no critical sentence was lost and that every
+ * offered sentence is accounted for.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchShedder.c src/nmea*.c -lm -o benchShedder
+ *   ./benchShedder
+ */
+
+#include "benchUtil.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nmea0183.h"
+#include "nmeaShedder.h"
+#include "nmeaTestVectors.h"
+
+#define ROUNDS 8000
+#define DRAIN_BUDGET 5 /* Sentences the main loop decodes per round */
+#define MAX_MIX 256
+
+/* Sentences per mix cycle: AIS and satellites dominate, as on a busy bridge */
+typedef struct MixEntry
+{
+  SentenceID sentenceId;
+  int count;
+} MixEntry;
+
+static const MixEntry MIX[] = {
+    {ABM, 120}, {GSV, 24}, {GST, 4}, {GSA, 4}, {GGA, 4}, {RMC, 4}, {VTG, 4},
+    {ZDA, 1},   {HDT, 10}, {ALR, 1}, {ALF, 1}, {ACN, 1}, {ACK, 1},
+};
+
+static const char *mix[MAX_MIX];
+static size_t mixLength[MAX_MIX];
+static int mixCount;
+static NmeaShedder shedder;
+
+static const char *vectorOf(SentenceID sentenceId)
+{
+  const NmeaTestVector *vector;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    if (vector->sentenceId == sentenceId)
+    {
+      return vector->sentence;
+    }
+  }
+  return NULL;
+}
+
+/* Interleaves the mix so that every class arrives throughout the cycle */
+static int buildMix(void)
+{
+  int remaining[sizeof(MIX) / sizeof(MIX[0])];
+  size_t i;
+  bool added = true;
+
+  for (i = 0; i < sizeof(MIX) / sizeof(MIX[0]); i++)
+  {
+    remaining[i] = MIX[i].count;
+    if (vectorOf(MIX[i].sentenceId) == NULL)
+    {
+      printf("FAILED: no test vector for a sentence of the mix\n");
+      return -1;
+    }
+  }
+  while (added)
+  {
+    added = false;
+    for (i = 0; i < sizeof(MIX) / sizeof(MIX[0]) && mixCount < MAX_MIX; i++)
+    {
+      if (remaining[i] > 0)
+      {
+        remaining[i]--;
+        mix[mixCount] = vectorOf(MIX[i].sentenceId);
+        mixLength[mixCount] = strlen(mix[mixCount]);
+        mixCount++;
+        added = true;
+      }
+    }
+  }
+  return 0;
+}
+
+static uint32_t sum(const uint32_t *counters)
+{
+  uint32_t total = 0;
+  int priority;
+
+  for (priority = 0; priority < NMEA_PRIORITY_COUNT; priority++)
+  {
+    total += counters[priority];
+  }
+  return total;
+}
+
+static int runLoad(int load)
+{
+  static const char *const NAMES[NMEA_PRIORITY_COUNT] = {"critical", "high", "normal", "low"};
+  uint32_t offered[NMEA_PRIORITY_COUNT] = {0};
+  const NmeaShedderStatistics *statistics = &shedder.statistics;
+  uint32_t left = 0;
+  int next = 0;
+  int round;
+  int priority;
+  int failures = 0;
+
+  nmeaShedderInit(&shedder, NULL, NULL, NULL);
+  for (round = 0; round < ROUNDS; round++)
+  {
+    int i;
+
+    for (i = 0; i < load * DRAIN_BUDGET; i++)
+    {
+      const char *sentence = mix[next];
+
+      offered[nmeaShedderPriority(&shedder, (SentenceID)(((uint32_t)(uint8_t)sentence[3] << 16) |
+                                                         ((uint32_t)(uint8_t)sentence[4] << 8) |
+                                                         (uint8_t)sentence[5]))]++;
+      nmeaShedderFeed(&shedder, (const uint8_t *)sentence, mixLength[next]);
+      next = (next + 1) % mixCount;
+    }
+    left = nmeaShedderDrain(&shedder, DRAIN_BUDGET);
+  }
+
+  printf("load %dx, %u budget overruns in %d drains\n", load, statistics->budgetOverruns, ROUNDS);
+  printf("  %-9s %10s %10s %10s %10s\n", "class", "offered", "delivered", "shed", "overflowed");
+  for (priority = 0; priority < NMEA_PRIORITY_COUNT; priority++)
+  {
+    printf("  %-9s %10u %10u %10u %10u\n", NAMES[priority], offered[priority], statistics->delivered[priority],
+           statistics->shed[priority], statistics->overflowed[priority]);
+  }
+  if (statistics->shed[NMEA_PRIORITY_CRITICAL] != 0 || statistics->overflowed[NMEA_PRIORITY_CRITICAL] != 0)
+  {
+    printf("  FAILED: critical sentences lost\n");
+    failures++;
+  }
+  if (sum(statistics->delivered) + statistics->rejected + sum(statistics->shed) + sum(statistics->overflowed) + left !=
+      sum(offered))
+  {
+    printf("  FAILED: sentences unaccounted for\n");
+    failures++;
+  }
+  return failures;
+}
+
+/* Feeds every mix sentence repeatedly, draining after each batch */
+static double costPerSentence(bool shedAll)
+{
+  uint64_t start;
+  uint64_t elapsed;
+  uint32_t total = 0;
+  int repeat;
+  int i;
+
+  nmeaShedderInit(&shedder, NULL, NULL, NULL);
+  if (shedAll)
+  {
+    /* Everything is low and shed at once: framing and classification only */
+    for (i = 0; i < mixCount; i++)
+    {
+      nmeaShedderSetPriority(&shedder, (SentenceID)(((uint32_t)(uint8_t)mix[i][3] << 16) |
+                                                    ((uint32_t)(uint8_t)mix[i][4] << 8) | (uint8_t)mix[i][5]),
+                             NMEA_PRIORITY_LOW);
+    }
+    shedder.shedDepth[NMEA_PRIORITY_LOW] = 0;
+    shedder.level = NMEA_PRIORITY_LOW;
+  }
+  start = benchNowNs();
+  for (repeat = 0; repeat < 2000; repeat++)
+  {
+    for (i = 0; i < mixCount; i++)
+    {
+      nmeaShedderFeed(&shedder, (const uint8_t *)mix[i], mixLength[i]);
+      total++;
+      if (!shedAll)
+      {
+        nmeaShedderDrain(&shedder, NMEA_SHEDDER_QUEUE_LENGTH);
+      }
+    }
+  }
+  elapsed = benchNowNs() - start;
+  benchSink += shedder.statistics.delivered[NMEA_PRIORITY_LOW] + shedder.statistics.shed[NMEA_PRIORITY_LOW];
+  return (double)elapsed / (double)total;
+}
+
+int main(void)
+{
+  static const int LOADS[] = {1, 2, 4, 8};
+  int failures = 0;
+  size_t i;
+
+  if (buildMix() != 0)
+  {
+    return 1;
+  }
+  printf("%d rounds, %d sentences decoded per drain, queues of %d sentences per class\n\n", ROUNDS, DRAIN_BUDGET,
+         NMEA_SHEDDER_QUEUE_LENGTH);
+  for (i = 0; i < sizeof(LOADS) / sizeof(LOADS[0]); i++)
+  {
+    failures += runLoad(LOADS[i]);
+  }
+
+  printf("\ncost per sentence\n");
+  printf("  framed and shed           %8.1f ns\n", costPerSentence(true));
+  printf("  framed, queued, decoded   %8.1f ns\n", costPerSentence(false));
+  if (failures != 0)
+  {
+    printf("\nFAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,277 @@
+/*
+ * Warm-start snapshot benchmark: takes a snapshot of a running gateway's
+ * derived state with src/nmeaSnapshot.c, saves it to a file, and restores it
+ * into freshly initialised objects as after a reboot.
+ *
+ * The state is built from the test vectors (navigation state, DTM through the
+ * datum stage), a position history of synthetic fixes, an active leg and a
+ * route of NMEA_ARRIVAL_MAX_WAYPOINTS watched waypoints. Reports the image
+ * size, the time to take, save, load and restore it, and the time a cold start
+ * takes to rebuild only the configured part (leg, route and datums).
+ *
+ * Checks that the restored objects match the originals and keep their own
+ * callbacks, that a partial restore only touches the requested sections, and
+ * that corrupted or foreign images are rejected.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchSnapshot.c src/nmea*.c -lm -o benchSnapshot
+ *   ./benchSnapshot
+ */
+
+#include "benchUtil.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nmea0183.h"
+#include "nmeaSnapshot.h"
+#include "nmeaTestVectors.h"
+
+#define REPEATS 2000
+#define ROUTE_LENGTH NMEA_ARRIVAL_MAX_WAYPOINTS
+
+/* The objects of one boot */
+typedef struct Gateway
+{
+  NmeaNavState navState;
+  NmeaPositionHistory history;
+  NmeaNavigator navigator;
+  NmeaArrivalDetector arrival;
+  NmeaDatumStage datum;
+} Gateway;
+
+static Gateway running;
+static Gateway rebooted;
+static NmeaWaypoint route[ROUTE_LENGTH];
+static NmeaSnapshot image;
+static NmeaSnapshot loaded;
+static uint32_t arrivals;
+static uint32_t forwarded;
+
+static void onArrival(const NmeaSentence *sentence, void *context)
+{
+  (void)sentence;
+  (void)context;
+  arrivals++;
+}
+
+/* After the datum stage: the positions go on to the navigation state */
+static void onConverted(const NmeaSentence *sentence, void *context)
+{
+  nmeaNavStateUpdate((NmeaNavState *)context, sentence);
+  forwarded++;
+}
+
+static void onSentence(const NmeaSentence *sentence, void *context)
+{
+  nmeaDatumCallback(sentence, context);
+}
+
+static void buildRoute(void)
+{
+  uint32_t random = 0x9E3779B9u;
+  int i;
+
+  for (i = 0; i < ROUTE_LENGTH; i++)
+  {
+    snprintf(route[i].id, sizeof(route[i].id), "WP%03d", i);
+    route[i].latitude = 48.0 + (double)(benchRandom(&random) % 20000u) / 10000.0;
+    route[i].longitude = 11.0 + (double)(benchRandom(&random) % 20000u) / 10000.0;
+  }
+}
+
+/* Everything a cold start has to set up before the first sentence */
+static void configure(Gateway *gateway)
+{
+  nmeaNavStateInit(&gateway->navState);
+  nmeaHistoryInit(&gateway->history);
+  nmeaNavigatorInit(&gateway->navigator, INTEGRATED_NAVIGATION);
+  nmeaNavigatorSetLeg(&gateway->navigator, &route[0], &route[1], NMEA_LEG_GREAT_CIRCLE, 0.1);
+  nmeaNavigatorSetVariation(&gateway->navigator, 2.5);
+  nmeaArrivalInit(&gateway->arrival, INTEGRATED_NAVIGATION, onArrival, NULL, 0.5);
+  nmeaArrivalAddRoute(&gateway->arrival, route, ROUTE_LENGTH, 0.1);
+  nmeaDatumInit(&gateway->datum, onConverted, &gateway->navState);
+  nmeaDatumDefine(&gateway->datum, "999", '\0', 0.08, 0.07, -47.7);
+}
+
+/* Runs the gateway for a while so that it has derived state worth keeping */
+static void run(Gateway *gateway)
+{
+  const NmeaTestVector *vector;
+  NmeaParser parser;
+  int i;
+
+  nmeaParserInit(&parser, onSentence, &gateway->datum);
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    nmeaFeed(&parser, (const uint8_t *)vector->sentence, strlen(vector->sentence));
+  }
+  for (i = 0; i < 3 * NMEA_POSITION_HISTORY_LENGTH; i++)
+  {
+    NmeaFix fix;
+
+    fix.timeMs = 1700000000000 + 1000 * (int64_t)i;
+    fix.latitude = 48.0 + 0.001 * i;
+    fix.longitude = 11.0 + 0.0015 * i;
+    fix.courseOverGround = 56.3f;
+    fix.speedOverGround = 6.5f;
+    fix.hasMotion = true;
+    nmeaHistoryAdd(&gateway->history, &fix);
+    nmeaNavigatorUpdate(&gateway->navigator, &fix, 123519.0f + (float)i);
+    nmeaArrivalUpdate(&gateway->arrival, &fix);
+  }
+}
+
+static NmeaSnapshotSources sourcesOf(Gateway *gateway)
+{
+  NmeaSnapshotSources sources;
+
+  sources.navState = &gateway->navState;
+  sources.history = &gateway->history;
+  sources.navigator = &gateway->navigator;
+  sources.arrival = &gateway->arrival;
+  sources.datum = &gateway->datum;
+  return sources;
+}
+
+static bool sameState(const Gateway *a, const Gateway *b)
+{
+  NmeaNavSnapshot navA;
+  NmeaNavSnapshot navB;
+  size_t arrivalStart = offsetof(NmeaArrivalDetector, talkerId);
+  size_t datumStart = offsetof(NmeaDatumStage, transformed);
+
+  nmeaNavStateSnapshot(&a->navState, &navA);
+  nmeaNavStateSnapshot(&b->navState, &navB);
+  return memcmp(&navA, &navB, sizeof(navA)) == 0 && memcmp(&a->history, &b->history, sizeof(a->history)) == 0 &&
+         memcmp(&a->navigator, &b->navigator, offsetof(NmeaNavigator, sentence)) == 0 &&
+         memcmp((const uint8_t *)&a->arrival + arrivalStart, (const uint8_t *)&b->arrival + arrivalStart,
+                offsetof(NmeaArrivalDetector, candidates) - arrivalStart) == 0 &&
+         memcmp((const uint8_t *)&a->datum + datumStart, (const uint8_t *)&b->datum + datumStart,
+                offsetof(NmeaDatumStage, sentence) - datumStart) == 0;
+}
+
+/* Writes the image to a file and reads it back, as a reboot would */
+static bool saveAndLoad(const NmeaSnapshot *snapshot, NmeaSnapshot *copy)
+{
+  FILE *file = tmpfile();
+  bool ok;
+
+  if (file == NULL)
+  {
+    return false;
+  }
+  ok = fwrite(snapshot, sizeof(*snapshot), 1, file) == 1 && fflush(file) == 0 && fseek(file, 0, SEEK_SET) == 0 &&
+       fread(copy, sizeof(*copy), 1, file) == 1;
+  fclose(file);
+  return ok;
+}
+
+static int check(bool condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FAILED: %s\n", what);
+    return 1;
+  }
+  return 0;
+}
+
+int main(void)
+{
+  NmeaSnapshotSources sources;
+  NmeaSnapshotSources partial;
+  uint64_t start;
+  double takeNs;
+  double restoreNs;
+  double saveLoadNs;
+  double coldNs;
+  uint16_t restored;
+  int failures = 0;
+  int i;
+
+  buildRoute();
+  configure(&running);
+  run(&running);
+  failures += check(forwarded != 0 && running.datum.transformed != 0, "test vectors did not reach the state");
+
+  sources = sourcesOf(&running);
+  start = benchNowNs();
+  for (i = 0; i < REPEATS; i++)
+  {
+    nmeaSnapshotTake(&image, &sources, (uint32_t)i);
+  }
+  takeNs = (double)(benchNowNs() - start) / REPEATS;
+
+  start = benchNowNs();
+  for (i = 0; i < REPEATS / 10; i++)
+  {
+    failures += check(saveAndLoad(&image, &loaded), "could not save and load the image");
+  }
+  saveLoadNs = (double)(benchNowNs() - start) / (REPEATS / 10);
+
+  /* Reboot: initialise with the live callbacks, then restore */
+  nmeaNavStateInit(&rebooted.navState);
+  nmeaHistoryInit(&rebooted.history);
+  nmeaNavigatorInit(&rebooted.navigator, INTEGRATED_NAVIGATION);
+  nmeaArrivalInit(&rebooted.arrival, INTEGRATED_NAVIGATION, onArrival, &rebooted, 0.5);
+  nmeaDatumInit(&rebooted.datum, onConverted, &rebooted.navState);
+  sources = sourcesOf(&rebooted);
+  start = benchNowNs();
+  for (i = 0; i < REPEATS; i++)
+  {
+    restored = nmeaSnapshotRestore(&loaded, &sources);
+  }
+  restoreNs = (double)(benchNowNs() - start) / REPEATS;
+  failures += check(restored == loaded.header.sections && restored == 0x1Fu, "not every section was restored");
+  failures += check(sameState(&running, &rebooted), "restored state differs");
+  failures += check(rebooted.arrival.context == &rebooted && rebooted.datum.context == &rebooted.navState,
+                    "restore replaced a callback context");
+
+  start = benchNowNs();
+  for (i = 0; i < REPEATS; i++)
+  {
+    configure(&rebooted);
+  }
+  coldNs = (double)(benchNowNs() - start) / REPEATS;
+
+  /* Only the sections with a source are taken and restored */
+  memset(&partial, 0, sizeof(partial));
+  partial.history = &rebooted.history;
+  nmeaHistoryInit(&rebooted.history);
+  failures += check(nmeaSnapshotRestore(&loaded, &partial) == NMEA_SNAPSHOT_HISTORY &&
+                        memcmp(&running.history, &rebooted.history, sizeof(running.history)) == 0,
+                    "partial restore");
+  nmeaSnapshotTake(&image, &partial, 1);
+  failures += check(image.header.sections == NMEA_SNAPSHOT_HISTORY, "partial snapshot");
+
+  /* A torn write or an image from another build is rejected */
+  memcpy(&image, &loaded, sizeof(image));
+  image.arrival[sizeof(image.arrival) / 2] ^= 0x10u;
+  failures += check(nmeaSnapshotRestore(&image, &sources) == 0, "corrupted image accepted");
+  memcpy(&image, &loaded, sizeof(image));
+  image.header.layout ^= 1u;
+  failures += check(nmeaSnapshotRestore(&image, &sources) == 0, "foreign layout accepted");
+  memcpy(&image, &loaded, sizeof(image));
+  image.header.version++;
+  failures += check(nmeaSnapshotRestore(&image, &sources) == 0, "foreign version accepted");
+
+  printf("snapshot image             %8zu bytes\n", sizeof(NmeaSnapshot));
+  printf("  position history         %8zu bytes\n", sizeof(image.history));
+  printf("  arrival detector         %8zu bytes\n", sizeof(image.arrival));
+  printf("  navigator, datum, state  %8zu bytes\n",
+         sizeof(image.navigator) + sizeof(image.datum) + sizeof(image.navState));
+  printf("take                       %8.1f us\n", takeNs / 1000.0);
+  printf("save to and load from file %8.1f us\n", saveLoadNs / 1000.0);
+  printf("restore                    %8.1f us\n", restoreNs / 1000.0);
+  printf("cold start configuration   %8.1f us (leg, %d waypoints, datums; no fixes)\n", coldNs / 1000.0,
+         ROUTE_LENGTH);
+  benchSink += arrivals;
+  if (failures != 0)
+  {
+    printf("\nFAILED\n");
+    return 1;
+  }
+  return 0;
+}
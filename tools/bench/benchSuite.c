@@ -0,0 +1,149 @@
+/*
+ * Benchmark suite driver: one measurement run of the parser, printed as JSON
+ * for tools/benchcompare.py, which runs it repeatedly to record a baseline
+ * or to compare against one.
+ *
+ * Per test vector sentence type it measures the byte-feed throughput and the
+ * nmeaDecode() latency percentiles, and it reports the memory taken by the
+ * parser context and the sentence union. Every test vector must decode
+ * before anything is measured.
+ *
+ * Build from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchSuite.c src/nmea*.c -lm -o benchSuite
+ * then see tools/benchcompare.py.
+ */
+
+#include "benchUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nmea0183.h"
+#include "nmeaTestVectors.h"
+
+#define STREAM_SIZE 16384
+#define FEED_ROUNDS 200
+#define LATENCY_SAMPLES 4096
+#define LATENCY_BATCH 8 /* Decodes per timestamp pair, amortising the clock read */
+
+static NmeaSentence sentence;
+static NmeaParser parser;
+static char stream[STREAM_SIZE];
+static uint64_t latencies[LATENCY_SAMPLES];
+static int metrics;
+
+static void countSentence(const NmeaSentence *decoded, void *context)
+{
+  (void)context;
+  benchSink += decoded->addressField.sentenceId;
+}
+
+/* better is "lower" or "higher" */
+static void printMetric(const char *name, const char *unit, const char *better, double value)
+{
+  printf("%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"better\": \"%s\", \"value\": %.6g}",
+         metrics++ == 0 ? "" : ",", name, unit, better, value);
+}
+
+static int compareUint64(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+static double percentile(const uint64_t *sorted, size_t count, double fraction)
+{
+  return (double)sorted[(size_t)(fraction * (double)(count - 1u))] / LATENCY_BATCH;
+}
+
+/* Sentences per second fed through the whole parser, framing included */
+static void measureFeed(const NmeaTestVector *vector, const char *id)
+{
+  size_t length = strlen(vector->sentence);
+  size_t streamLength = 0;
+  uint32_t sentences = 0;
+  char name[48];
+  uint64_t start;
+  int round;
+
+  while (streamLength + length <= STREAM_SIZE)
+  {
+    memcpy(&stream[streamLength], vector->sentence, length);
+    streamLength += length;
+    sentences++;
+  }
+
+  nmeaParserInit(&parser, countSentence, NULL);
+  start = benchNowNs();
+  for (round = 0; round < FEED_ROUNDS; round++)
+  {
+    nmeaFeed(&parser, (const uint8_t *)stream, streamLength);
+  }
+  snprintf(name, sizeof(name), "feed.%s", id);
+  printMetric(name, "sentences/s", "higher",
+              (double)sentences * FEED_ROUNDS * 1e9 / (double)(benchNowNs() - start));
+}
+
+static void measureLatency(const NmeaTestVector *vector, const char *id)
+{
+  size_t length = strlen(vector->sentence);
+  char name[48];
+  int sample;
+  int i;
+
+  for (sample = 0; sample < LATENCY_SAMPLES; sample++)
+  {
+    uint64_t start = benchNowNs();
+
+    for (i = 0; i < LATENCY_BATCH; i++)
+    {
+      benchSink += (uint64_t)nmeaDecode(vector->sentence, length, &sentence);
+    }
+    latencies[sample] = benchNowNs() - start;
+  }
+  qsort(latencies, LATENCY_SAMPLES, sizeof(latencies[0]), compareUint64);
+
+  snprintf(name, sizeof(name), "decode.%s.p50", id);
+  printMetric(name, "ns", "lower", percentile(latencies, LATENCY_SAMPLES, 0.50));
+  snprintf(name, sizeof(name), "decode.%s.p99", id);
+  printMetric(name, "ns", "lower", percentile(latencies, LATENCY_SAMPLES, 0.99));
+}
+
+int main(void)
+{
+  const NmeaTestVector *vector;
+  const NmeaTestVector *previous = NULL;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    if (nmeaDecode(vector->sentence, strlen(vector->sentence), &sentence) != NMEA_OK)
+    {
+      fprintf(stderr, "FAILED: %s", vector->sentence);
+      return 1;
+    }
+  }
+
+  printf("{\n  \"metrics\": [");
+  printMetric("memory.NmeaParser", "bytes", "lower", (double)sizeof(NmeaParser));
+  printMetric("memory.NmeaSentence", "bytes", "lower", (double)sizeof(NmeaSentence));
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL; vector++)
+  {
+    char id[4];
+
+    /* The first example of each type stands for it */
+    if (previous != NULL && previous->sentenceId == vector->sentenceId)
+    {
+      continue;
+    }
+    previous = vector;
+    memcpy(id, vector->sentence + 3, 3);
+    id[3] = '\0';
+    measureFeed(vector, id);
+    measureLatency(vector, id);
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef TOOLS_BENCH_BENCH_UTIL_H_
+#define TOOLS_BENCH_BENCH_UTIL_H_
+
+/*
+ * Shared helpers for the host benchmarks in tools/bench. Include this header
+ * first: it selects the POSIX API used for timing.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <time.h>
+
+/* Consumed results go here so the compiler cannot discard the work */
+static volatile uint64_t benchSink;
+
+static inline uint64_t benchNowNs(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/* Small deterministic generator so every run measures the same inputs */
+static inline uint32_t benchRandom(uint32_t *state)
+{
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+#endif
@@ -0,0 +1,373 @@
+/*
+ * Worst-case execution time harness for the byte-feed path: the cycles one
+ * nmeaFeedByte() call takes, per byte and per sentence, on worst-case input.
+ *
+ * Inputs, all fed through one parser:
+ *  - every test vector stretched to NMEA_MAX_SENTENCE_LENGTH by padding the
+ *    fractions of its decimal fields with zeros (same values, longest parse)
+ *  - ALC with as many alert entries as fit into one sentence
+ *  - every stretched sentence one character too long, rejected when the
+ *    frame overflows right where the checksum would start
+ * The byte that completes a sentence (the last checksum digit) runs the
+ * decoder, so it is the expensive one; its cost is the reassembly
+ * completion cost reported as "worst byte".
+ *
+ * Every sentence is fed ROUNDS times with warm caches and ROUNDS times after
+ * evicting them. Per byte position the cheapest run counts, which removes
+ * host interrupts and preemption but keeps cache misses; the single most
+ * expensive call is listed as raw max. Observed times are not a proof of
+ * WCET, but these inputs drive the longest paths through the parser.
+ *
+ * Cycles come from rdtsc on x86 hosts. On a target, provide a header that
+ * defines the counter type WcetCycles and "static inline WcetCycles
+ * wcetCycles(void)" (e.g. uint32_t and the Cortex-M DWT cycle counter) and
+ * build with
+ * -DWCET_CYCLE_COUNTER_HEADER='"myCycles.h"' -DWCET_EVICT_BYTES=0. Elsewhere
+ * nanoseconds are reported instead.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Isrc -Itools tools/bench/benchWcet.c src/nmea*.c -lm -o benchWcet
+ *   ./benchWcet
+ */
+
+#include "benchUtil.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nmea0183.h"
+#include "nmeaTestVectors.h"
+
+#if defined(WCET_CYCLE_COUNTER_HEADER)
+#include WCET_CYCLE_COUNTER_HEADER
+#define WCET_UNIT "cycles"
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define WCET_UNIT "cycles"
+typedef uint64_t WcetCycles;
+static inline WcetCycles wcetCycles(void)
+{
+  uint64_t cycles;
+
+  /* Keep the measured call between the two reads */
+  _mm_lfence();
+  cycles = __rdtsc();
+  _mm_lfence();
+  return cycles;
+}
+#else
+#define WCET_UNIT "ns"
+typedef uint64_t WcetCycles;
+static inline WcetCycles wcetCycles(void)
+{
+  return benchNowNs();
+}
+#endif
+
+/* Cycles since start, subtracted in the counter's own width so a counter
+ * that wrapped meanwhile still gives the right difference */
+static inline uint64_t elapsed(WcetCycles start)
+{
+  return (WcetCycles)(wcetCycles() - start);
+}
+
+#ifndef WCET_EVICT_BYTES
+#define WCET_EVICT_BYTES (8u << 20) /* Larger than the last level cache */
+#endif
+
+#define ROUNDS 200
+#define MAX_INPUTS 64
+#define MAX_BODY_LENGTH (NMEA_MAX_SENTENCE_LENGTH - 5)
+#define INPUT_SIZE (NMEA_MAX_SENTENCE_LENGTH + 2)
+#define MAX_FIELD_DIGITS 19 /* Longest number nmeaParseDecimal() accepts */
+
+typedef struct Input
+{
+  char name[16];
+  char text[INPUT_SIZE];
+  size_t length;
+  bool valid; /* Expected to be delivered, otherwise to be rejected */
+} Input;
+
+typedef struct Result
+{
+  uint64_t byteMax;  /* Most expensive byte */
+  size_t byteIndex;  /* Its position in the input */
+  uint64_t sentence; /* All bytes of the input */
+  uint64_t rawMax;   /* Most expensive single call, interference included */
+} Result;
+
+static Input inputs[MAX_INPUTS];
+static int inputCount;
+static NmeaParser parser;
+static uint32_t delivered;
+static uint64_t overhead;
+
+#if WCET_EVICT_BYTES > 0
+static uint8_t evictBuffer[WCET_EVICT_BYTES];
+#endif
+
+static void countSentence(const NmeaSentence *sentence, void *context)
+{
+  (void)sentence;
+  (void)context;
+  delivered++;
+}
+
+/* Completes a body ("$..." without '*') to a sentence with checksum and CR/LF */
+static void addInput(const char *name, const char *body, bool valid)
+{
+  Input *input = &inputs[inputCount++];
+  size_t length = strlen(body);
+
+  snprintf(input->name, sizeof(input->name), "%s", name);
+  memcpy(input->text, body, length);
+  if (valid)
+  {
+    snprintf(&input->text[length], INPUT_SIZE - length, "*%02X\r\n", nmeaChecksum(body + 1, length - 1u));
+  }
+  else
+  {
+    /* Rejected when the body overflows; what follows does not matter */
+    snprintf(&input->text[length], INPUT_SIZE - length, "*00\r\n");
+  }
+  input->length = strlen(input->text);
+  input->valid = valid;
+}
+
+static size_t countDigits(const char *text, size_t length)
+{
+  size_t digits = 0;
+  size_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    digits += text[i] >= '0' && text[i] <= '9';
+  }
+  return digits;
+}
+
+/* Stretches a body towards length by adding zeros to its decimal fractions
+ * in turn, up to the digits a field may have; false if it falls short */
+static bool stretch(char *body, size_t length)
+{
+  bool padded = true;
+
+  while (strlen(body) < length && padded)
+  {
+    char *field = strchr(body, ',');
+
+    padded = false;
+    while (field != NULL && strlen(body) < length)
+    {
+      char *end = strchr(field + 1, ',');
+      char *point = strchr(field + 1, '.');
+      size_t fieldEnd = end != NULL ? (size_t)(end - body) : strlen(body);
+
+      if (point != NULL && (size_t)(point - body) < fieldEnd &&
+          countDigits(field + 1, fieldEnd - (size_t)(field + 1 - body)) < MAX_FIELD_DIGITS)
+      {
+        memmove(&body[fieldEnd + 1u], &body[fieldEnd], strlen(&body[fieldEnd]) + 1u);
+        body[fieldEnd] = '0';
+        padded = true;
+        end = end != NULL ? end + 1 : NULL;
+      }
+      field = end;
+    }
+  }
+  return strlen(body) == length;
+}
+
+static void makeInputs(void)
+{
+  const NmeaTestVector *vector;
+  char body[INPUT_SIZE + 8];
+  char name[16];
+  int entries = 0;
+
+  for (vector = NMEA_TEST_VECTORS; vector->sentence != NULL && inputCount < MAX_INPUTS - 2; vector++)
+  {
+    size_t length = (size_t)(strchr(vector->sentence, '*') - vector->sentence);
+
+    memcpy(body, vector->sentence, length);
+    body[length] = '\0';
+    snprintf(name, sizeof(name), "%.3s", vector->sentence + 3);
+    if (stretch(body, MAX_BODY_LENGTH))
+    {
+      addInput(name, body, true);
+      strcat(body, "0");
+      snprintf(name, sizeof(name), "%.3s overlong", vector->sentence + 3);
+      addInput(name, body, false);
+    }
+    else
+    {
+      /* Too few decimal fields: as long as the example gets */
+      addInput(name, body, true);
+    }
+  }
+
+#if CFG_SENTENCE_ALC_ENABLED
+  /* Shortest possible alert entries, as many as fit */
+  while (strlen("$VRALC,01,01,00,") + 2u + (size_t)(entries + 1) * strlen(",,1,1,1") <= MAX_BODY_LENGTH &&
+         entries < ALC_MAX_ALERT_ENTRIES)
+  {
+    entries++;
+  }
+  snprintf(body, sizeof(body), "$VRALC,01,01,00,%d", entries);
+  while (entries-- > 0)
+  {
+    strcat(body, ",,1,1,1");
+  }
+  addInput("ALC entries", body, true);
+#else
+  (void)entries;
+#endif
+}
+
+static void evictCaches(void)
+{
+#if WCET_EVICT_BYTES > 0
+  size_t i;
+
+  for (i = 0; i < WCET_EVICT_BYTES; i += 64u)
+  {
+    evictBuffer[i]++;
+  }
+#endif
+}
+
+/* Takes the cheapest of ROUNDS runs for each byte position: interrupts and
+ * preemption on the host only ever add time, while every cold run starts
+ * from the same evicted state, so the minimum keeps the cache misses */
+static void measure(const Input *input, bool cold, Result *result)
+{
+  static uint64_t minimum[INPUT_SIZE];
+  size_t i;
+  int round;
+
+  for (i = 0; i < input->length; i++)
+  {
+    minimum[i] = UINT64_MAX;
+  }
+  result->rawMax = 0;
+  for (round = 0; round < ROUNDS; round++)
+  {
+    if (cold)
+    {
+      evictCaches();
+    }
+    for (i = 0; i < input->length; i++)
+    {
+      WcetCycles start = wcetCycles();
+      uint64_t cycles;
+
+      nmeaFeedByte(&parser, (uint8_t)input->text[i]);
+      cycles = elapsed(start);
+      cycles = cycles > overhead ? cycles - overhead : 0;
+      minimum[i] = cycles < minimum[i] ? cycles : minimum[i];
+      result->rawMax = cycles > result->rawMax ? cycles : result->rawMax;
+    }
+  }
+
+  result->byteMax = 0;
+  result->byteIndex = 0;
+  result->sentence = 0;
+  for (i = 0; i < input->length; i++)
+  {
+    result->sentence += minimum[i];
+    if (minimum[i] > result->byteMax)
+    {
+      result->byteMax = minimum[i];
+      result->byteIndex = i;
+    }
+  }
+}
+
+/* Feeds every input once and checks the parser accepts or rejects it */
+static int checkInputs(void)
+{
+  int failures = 0;
+  int i;
+
+  nmeaParserInit(&parser, countSentence, NULL);
+  for (i = 0; i < inputCount; i++)
+  {
+    uint32_t before = delivered;
+
+    nmeaFeed(&parser, (const uint8_t *)inputs[i].text, inputs[i].length);
+    if ((delivered != before) != inputs[i].valid)
+    {
+      printf("FAILED: %s %s", inputs[i].valid ? "not delivered" : "delivered", inputs[i].text);
+      failures++;
+    }
+  }
+  return failures;
+}
+
+static uint64_t timerOverhead(void)
+{
+  uint64_t minimum = UINT64_MAX;
+  int i;
+
+  for (i = 0; i < 10000; i++)
+  {
+    WcetCycles start = wcetCycles();
+    uint64_t cycles = elapsed(start);
+
+    minimum = cycles < minimum ? cycles : minimum;
+  }
+  return minimum;
+}
+
+int main(void)
+{
+  uint64_t worstByte = 0;
+  uint64_t worstSentence = 0;
+  const char *worstByteInput = "";
+  const char *worstSentenceInput = "";
+  int i;
+
+  makeInputs();
+  if (checkInputs() != 0)
+  {
+    return 1;
+  }
+  overhead = timerOverhead();
+
+  printf("%s per nmeaFeedByte() call, timer overhead of %llu %s subtracted\n\n", WCET_UNIT,
+         (unsigned long long)overhead, WCET_UNIT);
+  printf("%-16s %6s %10s %10s %12s %12s %10s\n", "input", "bytes", "byte hot", "byte cold", "sentence",
+         "worst byte", "raw max");
+  for (i = 0; i < inputCount; i++)
+  {
+    Result hot;
+    Result cold;
+
+    nmeaParserInit(&parser, countSentence, NULL);
+    measure(&inputs[i], false, &hot);
+    measure(&inputs[i], true, &cold);
+    printf("%-16s %6u %10llu %10llu %12llu %7u of %-2u %10llu\n", inputs[i].name, (unsigned)inputs[i].length,
+           (unsigned long long)hot.byteMax, (unsigned long long)cold.byteMax, (unsigned long long)cold.sentence,
+           (unsigned)cold.byteIndex + 1u, (unsigned)inputs[i].length,
+           (unsigned long long)(cold.rawMax > hot.rawMax ? cold.rawMax : hot.rawMax));
+
+    /* Cold caches are the worst case */
+    if (cold.byteMax > worstByte)
+    {
+      worstByte = cold.byteMax;
+      worstByteInput = inputs[i].name;
+    }
+    if (cold.sentence > worstSentence)
+    {
+      worstSentence = cold.sentence;
+      worstSentenceInput = inputs[i].name;
+    }
+  }
+  printf("\nmaximum per byte:     %llu %s (%s)\n", (unsigned long long)worstByte, WCET_UNIT, worstByteInput);
+  printf("maximum per sentence: %llu %s (%s)\n", (unsigned long long)worstSentence, WCET_UNIT,
+         worstSentenceInput);
+  printf("raw max includes interrupts and preemption of the host and is not a property of the parser\n");
+  return 0;
+}
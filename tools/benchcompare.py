@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+"""Benchmark baseline recorder and regression checker.
+
+Runs the benchmark suite driver (tools/bench/benchSuite.c) several times,
+each run in a fresh process, and either stores the samples as a baseline or
+compares them with one. A metric regresses when the confidence interval of
+the difference of the means (Welch's t-test) lies entirely on the worse side
+and the change exceeds the minimum relevant change; noise alone is not
+flagged. The confidence level applies to the whole suite (Bonferroni
+correction), not to each metric.
+
+Usage:
+  tools/benchcompare.py record BINARY [--runs N] [--output FILE]
+  tools/benchcompare.py compare BASELINE CURRENT [--runs N]
+                        [--confidence C] [--min-change PERCENT] [--output FILE]
+
+BINARY is the built driver. BASELINE and CURRENT are each a .json file
+written by record (or by compare --output, which saves the current samples)
+or a binary, in either order. Given two binaries, compare runs them alternately, which cancels
+the drift in machine speed that makes a baseline recorded earlier
+unreliable on laptops and shared hosts. compare exits with status 1 if any
+metric regressed.
+
+Typical use before merging a parser change:
+  git stash; cc ... -o /tmp/benchBase; git stash pop; cc ... -o /tmp/benchNew
+  tools/benchcompare.py compare /tmp/benchBase /tmp/benchNew
+or, against a baseline kept on a quiet machine:
+  tools/benchcompare.py record /tmp/benchBase --output base.json
+  tools/benchcompare.py compare base.json /tmp/benchNew
+"""
+
+import json
+import math
+import subprocess
+import sys
+
+DEFAULT_RUNS = 10
+DEFAULT_CONFIDENCE = 0.95
+DEFAULT_MIN_CHANGE = 2.0  # percent
+DEFAULT_BASELINE = "bench-baseline.json"
+
+
+def fail(message):
+    sys.stderr.write("benchcompare: %s\n" % message)
+    sys.exit(2)
+
+
+# ---------------------------------------------------------------------------
+# Student's t distribution, without scipy
+
+
+def betacf(a, b, x):
+    """Continued fraction of the incomplete beta function (Lentz)."""
+    tiny = 1e-300
+    c = 1.0
+    d = 1.0 - (a + b) * x / (a + 1.0)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((a + m2 - 1.0) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        h *= d * c
+        aa = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def incomplete_beta(a, b, x):
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +
+                     a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1.0 - x) / b
+
+
+def t_cdf(t, df):
+    tail = 0.5 * incomplete_beta(df / 2.0, 0.5, df / (df + t * t))
+    return 1.0 - tail if t > 0 else tail
+
+
+def t_quantile(p, df):
+    """t with P(T <= t) = p, by bisection."""
+    low, high = 0.0, 1.0
+    while t_cdf(high, df) < p:
+        high *= 2.0
+    for _ in range(100):
+        middle = (low + high) / 2.0
+        if t_cdf(middle, df) < p:
+            low = middle
+        else:
+            high = middle
+    return (low + high) / 2.0
+
+
+# ---------------------------------------------------------------------------
+
+
+def collect(results, output):
+    for metric in json.loads(output)["metrics"]:
+        entry = results["metrics"].setdefault(metric["name"], {
+            "unit": metric["unit"],
+            "better": metric["better"],
+            "samples": [],
+        })
+        entry["samples"].append(metric["value"])
+
+
+def run_suite(binaries, runs):
+    """Runs the drivers in turn, so drift of the machine speed affects all of
+    them alike, and collects the samples of every metric per driver."""
+    results = [{"runs": runs, "binary": binary, "metrics": {}} for binary in binaries]
+    for run in range(runs):
+        for binary, result in zip(binaries, results):
+            try:
+                output = subprocess.run([binary], check=True, stdout=subprocess.PIPE).stdout
+            except (OSError, subprocess.CalledProcessError) as error:
+                fail("%s: %s" % (binary, error))
+            collect(result, output)
+        sys.stderr.write("benchcompare: run %d/%d\r" % (run + 1, runs))
+    sys.stderr.write("\n")
+    return results
+
+
+def load_results(path):
+    try:
+        with open(path, encoding="utf-8") as f:
+            return json.load(f)
+    except (OSError, ValueError) as error:
+        fail("%s: %s" % (path, error))
+
+
+def gather(inputs, runs):
+    """Results of each input: a .json file is loaded, anything else is run as a
+    driver. The drivers are run together, so they alternate."""
+    binaries = [path for path in inputs if not path.endswith(".json")]
+    measured = iter(run_suite(binaries, runs) if binaries else [])
+    return [load_results(path) if path.endswith(".json") else next(measured) for path in inputs]
+
+
+def save_results(results, path):
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+
+def mean_variance(samples):
+    mean = sum(samples) / len(samples)
+    if len(samples) < 2:
+        return mean, 0.0
+    return mean, sum((s - mean) ** 2 for s in samples) / (len(samples) - 1)
+
+
+def difference_interval(old, new, confidence):
+    """Confidence interval of mean(new) - mean(old), Welch's t-test."""
+    old_mean, old_var = mean_variance(old)
+    new_mean, new_var = mean_variance(new)
+    difference = new_mean - old_mean
+    old_term = old_var / len(old)
+    new_term = new_var / len(new)
+    se = math.sqrt(old_term + new_term)
+    if se == 0.0 or len(old) < 2 or len(new) < 2:
+        # Exact metrics such as memory, or a single run: no noise to allow for
+        return old_mean, new_mean, difference, difference
+    df = (old_term + new_term) ** 2 / (old_term ** 2 / (len(old) - 1) + new_term ** 2 / (len(new) - 1))
+    margin = t_quantile(0.5 + confidence / 2.0, df) * se
+    return old_mean, new_mean, difference - margin, difference + margin
+
+
+def compare(baseline, current, confidence, min_change):
+    regressions = 0
+    improvements = 0
+    # Bonferroni: the confidence holds for all metrics together, otherwise a
+    # suite of 80 metrics flags a few by chance on every comparison
+    per_metric = 1.0 - (1.0 - confidence) / max(len(baseline["metrics"]), 1)
+    print("%-24s %12s %12s %8s %20s  %s" % ("metric", "baseline", "current", "change", "interval", "verdict"))
+    for name, old in sorted(baseline["metrics"].items()):
+        new = current["metrics"].get(name)
+        if new is None:
+            print("%-24s missing from the current results" % name)
+            continue
+        old_mean, new_mean, low, high = difference_interval(old["samples"], new["samples"], per_metric)
+        scale = abs(old_mean) if old_mean != 0.0 else 1.0
+        change = (new_mean - old_mean) / scale * 100.0
+        # Positive means worse, whichever direction is better for the metric
+        sign = 1.0 if old["better"] == "lower" else -1.0
+        worse_low, worse_high = sorted((sign * low / scale * 100.0, sign * high / scale * 100.0))
+        verdict = ""
+        if worse_low > 0.0 and sign * change > min_change:
+            verdict = "REGRESSION"
+            regressions += 1
+        elif worse_high < 0.0 and -sign * change > min_change:
+            verdict = "improvement"
+            improvements += 1
+        print("%-24s %12.4g %12.4g %+7.1f%% [%+7.1f%%, %+7.1f%%]  %s" %
+              (name, old_mean, new_mean, change, low / scale * 100.0, high / scale * 100.0, verdict))
+    print("\n%d regression(s), %d improvement(s) at %g%% confidence, minimum change %g%%" %
+          (regressions, improvements, confidence * 100.0, min_change))
+    return regressions
+
+
+def option(args, name, default, convert):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    try:
+        return convert(value)
+    except ValueError:
+        fail("bad value for %s: %s" % (name, value))
+
+
+def main(argv):
+    args = argv[1:]
+    runs = option(args, "--runs", DEFAULT_RUNS, int)
+    output = option(args, "--output", None, str)
+    confidence = option(args, "--confidence", DEFAULT_CONFIDENCE, float)
+    min_change = option(args, "--min-change", DEFAULT_MIN_CHANGE, float)
+    if runs < 2:
+        fail("--runs must be at least 2 for confidence intervals")
+    if not 0.0 < confidence < 1.0:
+        fail("--confidence must be between 0 and 1")
+
+    if len(args) == 2 and args[0] == "record":
+        results = run_suite([args[1]], runs)[0]
+        save_results(results, output or DEFAULT_BASELINE)
+        print("benchcompare: recorded %d runs of %d metrics in %s" %
+              (runs, len(results["metrics"]), output or DEFAULT_BASELINE))
+        return 0
+    if len(args) == 3 and args[0] == "compare":
+        baseline, current = gather(args[1:], runs)
+        if output:
+            save_results(current, output)
+        return 1 if compare(baseline, current, confidence, min_change) else 0
+    sys.stderr.write(__doc__)
+    return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
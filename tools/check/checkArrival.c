@@ -0,0 +1,186 @@
+/*
+ * Arrival detector known-answer checks for src/nmeaArrival.c: entering and
+ * leaving an arrival circle, passing the perpendicular of an inbound leg and
+ * leaving the approach range, the hysteresis around each boundary, and
+ * waypoints found from the neighbouring grid cell, across a cell corner and
+ * across the antimeridian.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Itools tools/check/checkArrival.c src/nmea*.c -lm -o checkArrival
+ *   ./checkArrival
+ */
+
+#include "checkUtil.h"
+
+#include "nmeaArrival.h"
+
+#if CFG_SENTENCE_AAM_ENABLED
+
+#define PI 3.14159265358979323846
+#define NM_TO_DEGREES (180.0 / (PI * NMEA_EARTH_RADIUS_NM)) /* Along a great circle */
+
+static NmeaArrivalDetector detector;
+static int emitted;
+static char lastAam[NMEA_MAX_SENTENCE_LENGTH + 1];
+
+static void onAam(const NmeaSentence *sentence, void *context)
+{
+  size_t length = 0;
+
+  (void)context;
+  emitted++;
+  nmeaEncode(sentence, lastAam, sizeof(lastAam) - 1u, &length);
+  lastAam[length] = '\0';
+}
+
+static NmeaWaypoint makeWaypoint(const char *id, double latitude, double longitude)
+{
+  NmeaWaypoint waypoint;
+
+  memset(&waypoint, 0, sizeof(waypoint));
+  strncpy(waypoint.id, id, sizeof(waypoint.id) - 1u);
+  waypoint.latitude = latitude;
+  waypoint.longitude = longitude;
+  return waypoint;
+}
+
+static uint16_t moveTo(double latitude, double longitude)
+{
+  NmeaFix fix;
+
+  fix.timeMs = 0;
+  fix.latitude = latitude;
+  fix.longitude = longitude;
+  fix.courseOverGround = 90.0f;
+  fix.speedOverGround = 6.0f;
+  fix.hasMotion = true;
+  return nmeaArrivalUpdate(&detector, &fix);
+}
+
+/* Checks the transitions of one update and the AAM of the last one */
+static void checkMove(double latitude, double longitude, uint16_t transitions, const char *aam, const char *what)
+{
+  int before = emitted;
+
+  lastAam[0] = '\0';
+  checkTrue(moveTo(latitude, longitude) == transitions, what);
+  checkTrue(emitted - before == transitions, what);
+  if (aam != NULL)
+  {
+    checkText(lastAam, aam, what);
+  }
+}
+
+/* A lone waypoint on the equator: distances along the equator are exact */
+static void checkCircle(void)
+{
+  NmeaWaypoint waypoint = makeWaypoint("W", 0.0, 1.0);
+
+  emitted = 0;
+  nmeaArrivalInit(&detector, GPS_POSITIONING, onAam, NULL, 2.0);
+  nmeaArrivalAdd(&detector, &waypoint, NULL, 0.5);
+
+  checkMove(0.0, 1.0 - 0.6 * NM_TO_DEGREES, 0, NULL, "0.6 NM out, outside the circle");
+  checkMove(0.0, 1.0 - 0.505 * NM_TO_DEGREES, 0, NULL, "0.505 NM out, not yet entered");
+  checkMove(0.0, 1.0 - 0.3 * NM_TO_DEGREES, 1, "$GPAAM,A,V,0.50,N,W*63\r\n", "0.3 NM out, entered");
+  checkTrue(detector.state[0] == NMEA_ARRIVAL_ENTERED, "entered state");
+  checkMove(0.0, 1.0 - 0.3 * NM_TO_DEGREES, 0, NULL, "unchanged state reports nothing");
+
+  /* Without an inbound leg the perpendicular is never passed */
+  checkMove(0.0, 1.0 + 0.3 * NM_TO_DEGREES, 0, NULL, "lone waypoint, beyond it");
+
+  /* Within NMEA_ARRIVAL_HYSTERESIS past the radius the circle is kept */
+  checkMove(0.0, 1.0 + (0.5 + NMEA_ARRIVAL_HYSTERESIS / 2.0) * NM_TO_DEGREES, 0, NULL, "hysteresis keeps the circle");
+  checkMove(0.0, 1.0 + (0.5 + NMEA_ARRIVAL_HYSTERESIS * 2.0) * NM_TO_DEGREES, 1, "$GPAAM,V,V,0.50,N,W*74\r\n",
+            "left beyond the hysteresis");
+  checkTrue(detector.state[0] == 0 && detector.activeCount == 0, "idle again");
+  checkMove(0.0, 1.0 + (0.5 + NMEA_ARRIVAL_HYSTERESIS / 2.0) * NM_TO_DEGREES, 0, NULL,
+            "hysteresis does not enter from outside");
+}
+
+/* A route along the equator: A to B, with the perpendicular of B at longitude 1 */
+static void checkPerpendicular(void)
+{
+  NmeaWaypoint route[2];
+  double north = 0.02; /* 1.2 NM off the track, outside the arrival circle */
+
+  route[0] = makeWaypoint("A", 0.0, 0.0);
+  route[1] = makeWaypoint("B", 0.0, 1.0);
+  emitted = 0;
+  nmeaArrivalInit(&detector, GPS_POSITIONING, onAam, NULL, 2.0);
+  checkTrue(nmeaArrivalAddRoute(&detector, route, 2, 0.1) == 2, "route added");
+
+  checkMove(north, 1.0 - 0.6 * NM_TO_DEGREES, 0, NULL, "before the perpendicular");
+  checkMove(north, 1.0 + 0.6 * NM_TO_DEGREES, 1, "$GPAAM,V,A,0.10,N,B*72\r\n", "past the perpendicular");
+  checkMove(north, 1.0 - NMEA_ARRIVAL_HYSTERESIS / 2.0 * NM_TO_DEGREES, 0, NULL, "hysteresis keeps it passed");
+  checkMove(north, 1.0 - NMEA_ARRIVAL_HYSTERESIS * 2.0 * NM_TO_DEGREES, 1, "$GPAAM,V,V,0.10,N,B*65\r\n",
+            "back before the perpendicular");
+
+  /* On the track at B: both states at once, one sentence */
+  checkMove(0.0, 1.0 + 0.05 * NM_TO_DEGREES, 1, "$GPAAM,A,A,0.10,N,B*65\r\n", "entered and passed");
+  checkMove(0.0, 1.0 + 0.5 * NM_TO_DEGREES, 1, "$GPAAM,V,A,0.10,N,B*72\r\n", "left the circle, still passed");
+
+  /* Past the perpendicular, but leaving the approach range */
+  checkMove(0.0, 1.0 + 1.99 * NM_TO_DEGREES, 0, NULL, "within the approach range");
+  checkMove(0.0, 1.0 + (2.0 + NMEA_ARRIVAL_HYSTERESIS / 2.0) * NM_TO_DEGREES, 0, NULL,
+            "hysteresis keeps the approach range");
+  checkMove(0.0, 1.0 + (2.0 + NMEA_ARRIVAL_HYSTERESIS * 2.0) * NM_TO_DEGREES, 1, "$GPAAM,V,V,0.10,N,B*65\r\n",
+            "beyond the approach range");
+  checkTrue(detector.state[0] == 0, "the first waypoint has no inbound leg");
+}
+
+/* Waypoints whose cell differs from the position's, among enough others that
+ * the update visits grid cells instead of testing every waypoint */
+static void checkGrid(void)
+{
+  NmeaWaypoint waypoint;
+  char id[8];
+  int i;
+
+  emitted = 0;
+  nmeaArrivalInit(&detector, GPS_POSITIONING, onAam, NULL, 2.0);
+  for (i = 0; i < 100; i++)
+  {
+    snprintf(id, sizeof(id), "D%d", i);
+    waypoint = makeWaypoint(id, 40.0 + 0.1 * i, -70.0 + 0.3 * i);
+    nmeaArrivalAdd(&detector, &waypoint, NULL, 0.05);
+  }
+  waypoint = makeWaypoint("CORNER", 0.2499, 0.2499);
+  nmeaArrivalAdd(&detector, &waypoint, NULL, 0.05);
+  waypoint = makeWaypoint("EDGE", 0.25, 0.5);
+  nmeaArrivalAdd(&detector, &waypoint, NULL, 0.05);
+  waypoint = makeWaypoint("DATELINE", 10.0, 179.999);
+  nmeaArrivalAdd(&detector, &waypoint, NULL, 0.2);
+
+  /* 0.0255 NM away, in the diagonal neighbour cell */
+  checkMove(0.2502, 0.2502, 1, "$GPAAM,A,V,0.05,N,CORNER*33\r\n", "across a cell corner");
+  checkMove(0.2502, 0.2502, 0, NULL, "across a cell corner, unchanged");
+  /* On the cell boundary itself, reached from the cell below */
+  checkMove(0.2499, 0.5, 2, "$GPAAM,A,V,0.05,N,EDGE*37\r\n", "on a cell boundary");
+  checkTrue(detector.state[100] == 0 && detector.state[101] == NMEA_ARRIVAL_ENTERED, "left the corner, at the edge");
+  /* 0.118 NM away, on the other side of the antimeridian */
+  checkMove(10.0, -179.999, 2, "$GPAAM,A,V,0.20,N,DATELINE*29\r\n", "across the antimeridian");
+  checkMove(10.0, -179.999 + 0.5, 1, "$GPAAM,V,V,0.20,N,DATELINE*3E\r\n", "away from the antimeridian");
+
+  /* A decoy in the middle of the list is found like any other */
+  checkMove(40.0 + 0.1 * 50, -70.0 + 0.3 * 50, 1, "$GPAAM,A,V,0.05,N,D50*75\r\n", "decoy reached");
+  checkTrue(emitted == 7, "one sentence per transition");
+}
+
+int main(void)
+{
+  checkCircle();
+  checkPerpendicular();
+  checkGrid();
+  return checkResult();
+}
+
+#else
+
+int main(void)
+{
+  printf("checkArrival needs AAM enabled\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Datum stage known-answer checks for src/nmeaDatum.c: DTM offsets applied to
+ * the latitude, longitude and altitude of the sentences that follow, offsets
+ * defined in advance, minutes that round up to a whole degree, positions
+ * shifted across the equator and the antimeridian, a datum without known
+ * offsets, and the return to WGS-84.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Itools tools/check/checkDatum.c src/nmea*.c -lm -o checkDatum
+ *   ./checkDatum
+ */
+
+#include "checkUtil.h"
+
+#include "nmeaDatum.h"
+
+#if CFG_SENTENCE_DTM_ENABLED && CFG_SENTENCE_GGA_ENABLED && CFG_SENTENCE_RMC_ENABLED
+
+#define FIELD 1e-3 /* Tolerance of (d)ddmm.mm fields, about a float step at 18000 */
+
+static NmeaDatumStage stage;
+static NmeaParser parser;
+static const NmeaSentence *lastPointer;
+static NmeaSentence last;
+static char lastText[NMEA_MAX_SENTENCE_LENGTH + 1];
+
+static void onSentence(const NmeaSentence *sentence, void *context)
+{
+  size_t length = 0;
+
+  (void)context;
+  lastPointer = sentence;
+  last = *sentence;
+  nmeaEncode(sentence, lastText, sizeof(lastText) - 1u, &length);
+  lastText[length] = '\0';
+}
+
+static void start(void)
+{
+  nmeaDatumInit(&stage, onSentence, NULL);
+  nmeaParserInit(&parser, nmeaDatumCallback, &stage);
+}
+
+static void checkGga(double latitude, Polarity latitudePolarity, double longitude, Polarity longitudePolarity,
+                     double altitude, const char *what)
+{
+  checkTrue(last.addressField.sentenceId == GGA, what);
+  checkNear(last.gga.latitude, latitude, FIELD, what);
+  checkTrue(last.gga.latitudePolarity == latitudePolarity, what);
+  checkNear(last.gga.longitude, longitude, FIELD, what);
+  checkTrue(last.gga.longitudePolarity == longitudePolarity, what);
+  checkNear(last.gga.altitude, altitude, 1e-3, what);
+}
+
+static void checkRmc(double latitude, Polarity latitudePolarity, double longitude, Polarity longitudePolarity,
+                     const char *what)
+{
+  checkTrue(last.addressField.sentenceId == RMC, what);
+  checkNear(last.rmc.latitude, latitude, FIELD, what);
+  checkTrue(last.rmc.latitudePolarity == latitudePolarity, what);
+  checkNear(last.rmc.longitude, longitude, FIELD, what);
+  checkTrue(last.rmc.longitudePolarity == longitudePolarity, what);
+}
+
+/* Offsets carried by the DTM itself */
+static void checkDtmOffsets(void)
+{
+  start();
+  checkFeed(&parser, "GPGGA,123519.00,4807.0400,N,01131.0000,E,1,08,0.9,545.4,M,46.9,M,,");
+  checkGga(4807.04, NORTH, 1131.0, EAST, 545.4, "WGS-84 before any DTM");
+  checkTrue(stage.transformed == 0, "WGS-84 not shifted");
+
+  checkFeed(&parser, "GPDTM,999,,0.0800,N,0.0700,E,-47.7,W84");
+  checkTrue(last.addressField.sentenceId == DTM && strcmp(last.dtm.localDatum, "W84") == 0 &&
+                last.dtm.latitudeOffset == 0.0f && last.dtm.longitudeOffset == 0.0f &&
+                last.dtm.altitudeOffset == 0.0f,
+            "DTM passed on as WGS-84");
+  checkTrue(stage.known, "offsets known from the DTM");
+
+  /* The offsets are local minus WGS-84, so they are subtracted */
+  checkFeed(&parser, "GPGGA,123520.00,4807.0400,N,01131.0000,E,1,08,0.9,545.4,M,46.9,M,,");
+  checkGga(4806.96, NORTH, 1130.93, EAST, 593.1, "GGA shifted by the DTM offsets");
+  checkFeed(&parser, "GPRMC,123520.00,A,4807.0400,S,01131.0000,W,22.4,84.4,230394,3.1,W,A,S");
+  checkRmc(4807.12, SOUTH, 1131.07, WEST, "RMC in the south west shifted");
+  checkTrue(stage.transformed == 2, "shifted sentences counted");
+
+  /* Sentences without positions pass unchanged */
+  checkFeed(&parser, "HEHDT,274.07,T");
+  checkTrue(last.addressField.sentenceId == HDT && stage.transformed == 2, "HDT passed on");
+}
+
+/* Results that round to 60 minutes, or cross the equator or the antimeridian */
+static void checkBoundaries(void)
+{
+  start();
+  checkFeed(&parser, "GPDTM,999,,0.0060,S,0.0070,W,0.0,W84");
+  checkFeed(&parser, "GPRMC,123519.00,A,4859.9900,N,01159.9900,E,22.4,84.4,230394,3.1,W,A,S");
+  checkRmc(4900.0, NORTH, 1200.0, EAST, "minutes rounded up to the next degree");
+  checkTrue(strstr(lastText, ",4900.00,N,01200.00,E,") != NULL, "encoded without 60 minutes");
+
+  checkFeed(&parser, "GPDTM,999,,0.0100,N,0.2000,W,0.0,W84");
+  checkFeed(&parser, "GPRMC,123520.00,A,0000.0030,N,17959.9000,E,22.4,84.4,230394,3.1,W,A,S");
+  checkRmc(0.01, SOUTH, 17959.90, WEST, "across the equator and the antimeridian");
+  checkTrue(strstr(lastText, ",0000.01,S,17959.90,W,") != NULL, "encoded across both");
+}
+
+/* Datums announced without offsets */
+static void checkDefinedDatums(void)
+{
+  start();
+  checkTrue(nmeaDatumDefine(&stage, "W72", '\0', 0.05, -0.03, 10.0), "datum defined");
+
+  checkFeed(&parser, "GPDTM,W72,,,,,,,W84");
+  checkTrue(stage.known && strcmp(last.dtm.localDatum, "W84") == 0, "defined datum selected");
+  checkFeed(&parser, "GPGGA,123519.00,4807.0400,N,01131.0000,E,1,08,0.9,545.4,M,46.9,M,,");
+  checkGga(4806.99, NORTH, 1131.03, EAST, 535.4, "GGA shifted by the defined offsets");
+
+  /* Neither offsets nor a definition: the positions pass unchanged, with the DTM */
+  checkFeed(&parser, "GPDTM,999,,,,,,,W84");
+  checkTrue(!stage.known && strcmp(last.dtm.localDatum, "999") == 0, "unknown datum passed on");
+  checkFeed(&parser, "GPGGA,123520.00,4807.0400,N,01131.0000,E,1,08,0.9,545.4,M,46.9,M,,");
+  checkGga(4807.04, NORTH, 1131.0, EAST, 545.4, "unknown datum, GGA unchanged");
+  checkTrue(stage.untransformed == 1 && stage.transformed == 1, "unknown datum counted");
+
+  /* Offsets against another reference datum cannot be applied */
+  checkFeed(&parser, "GPDTM,999,,0.0800,N,0.0700,E,-47.7,P90");
+  checkTrue(!stage.known && strcmp(last.dtm.referenceDatum, "P90") == 0, "other reference datum passed on");
+  checkFeed(&parser, "GPRMC,123521.00,A,4807.0400,N,01131.0000,E,22.4,84.4,230394,3.1,W,A,S");
+  checkRmc(4807.04, NORTH, 1131.0, EAST, "other reference datum, RMC unchanged");
+  checkTrue(stage.untransformed == 2, "other reference datum counted");
+
+  /* Back to WGS-84: positions pass without a copy */
+  checkFeed(&parser, "GPDTM,W84,,0.0000,N,0.0000,E,0.0,W84");
+  checkTrue(stage.known, "WGS-84 again");
+  checkFeed(&parser, "GPGGA,123522.00,4807.0400,N,01131.0000,E,1,08,0.9,545.4,M,46.9,M,,");
+  checkGga(4807.04, NORTH, 1131.0, EAST, 545.4, "WGS-84 GGA unchanged");
+  checkTrue(lastPointer != &stage.sentence, "WGS-84 GGA not copied");
+  checkTrue(stage.transformed == 1 && stage.untransformed == 2, "WGS-84 not counted");
+}
+
+int main(void)
+{
+  checkDtmOffsets();
+  checkBoundaries();
+  checkDefinedDatums();
+  return checkResult();
+}
+
+#else
+
+int main(void)
+{
+  printf("checkDatum needs DTM, GGA and RMC enabled\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Epoch grouper known-answer checks for src/nmeaEpoch.c: interleaved RMC,
+ * GGA, GSA, GSV and ZDA streams through the parser, with epochs closed by a
+ * change of UTC time, by a ZDA or GSV terminator, and by the caller's flush
+ * when the receiver goes quiet.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Itools tools/check/checkEpoch.c src/nmea*.c -lm -o checkEpoch
+ *   ./checkEpoch
+ */
+
+#include "checkUtil.h"
+
+#include "nmeaEpoch.h"
+
+#if CFG_SENTENCE_GGA_ENABLED && CFG_SENTENCE_RMC_ENABLED && CFG_SENTENCE_GSA_ENABLED && CFG_SENTENCE_GSV_ENABLED && \
+    CFG_SENTENCE_ZDA_ENABLED
+
+#define MAX_EPOCHS 8
+
+static NmeaEpoch delivered[MAX_EPOCHS];
+static int deliveredCount;
+static NmeaEpochGrouper grouper;
+static NmeaParser parser;
+
+static void onEpoch(const NmeaEpoch *epoch, void *context)
+{
+  (void)context;
+  if (deliveredCount < MAX_EPOCHS)
+  {
+    delivered[deliveredCount] = *epoch;
+  }
+  deliveredCount++;
+}
+
+static void start(SentenceID terminator)
+{
+  deliveredCount = 0;
+  nmeaEpochInit(&grouper, onEpoch, NULL, terminator);
+  nmeaParserInit(&parser, nmeaEpochCallback, &grouper);
+}
+
+/* One receiver epoch at second 'second' past 12:35 */
+static void feedEpoch(int second, bool withZda)
+{
+  char body[NMEA_MAX_SENTENCE_LENGTH];
+
+  snprintf(body, sizeof(body), "GPRMC,1235%02d.00,A,4807.04,N,01131.00,E,22.4,84.4,230394,3.1,W,A,S", second);
+  checkFeed(&parser, body);
+  snprintf(body, sizeof(body), "GPGGA,1235%02d.00,4807.04,N,01131.00,E,1,08,0.9,545.4,M,46.9,M,,", second);
+  checkFeed(&parser, body);
+  checkFeed(&parser, "GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1");
+  checkFeed(&parser, "GPGSV,2,1,06,03,03,111,40,04,15,270,41,06,01,010,42,13,06,292,43");
+  checkFeed(&parser, "GPGSV,2,2,06,17,20,045,44,19,30,135,45");
+  if (withZda)
+  {
+    snprintf(body, sizeof(body), "GPZDA,1235%02d.00,23,03,1994,-05,00", second);
+    checkFeed(&parser, body);
+  }
+}
+
+static void checkComplete(const NmeaEpoch *epoch, float utcTime, uint8_t sentences, const char *what)
+{
+  checkTrue(epoch->hasTime, what);
+  checkNear(epoch->utcTime, utcTime, 1e-3, what);
+  checkTrue(epoch->sentences == sentences, what);
+  checkTrue(epoch->satelliteCount == 6, what);
+  checkTrue(epoch->satellites[0].satelliteId == 3 && epoch->satellites[3].satelliteId == 13 &&
+                epoch->satellites[4].satelliteId == 17 && epoch->satellites[5].satelliteId == 19,
+            what);
+  checkTrue(epoch->satellites[5].azimuth == 135 && epoch->satellites[5].snr == 45, what);
+}
+
+/* Without a terminator an epoch ends with the first sentence of the next */
+static void checkTimeChange(void)
+{
+  const uint8_t ALL = NMEA_EPOCH_RMC | NMEA_EPOCH_GGA | NMEA_EPOCH_GSA | NMEA_EPOCH_GSV;
+
+  start((SentenceID)0);
+  feedEpoch(19, false);
+  checkTrue(deliveredCount == 0, "no epoch before the time changes");
+  feedEpoch(20, false);
+  checkTrue(deliveredCount == 1, "time change closes the epoch");
+  checkComplete(&delivered[0], 123519.0f, ALL, "first epoch by time change");
+  checkTrue(delivered[0].gga.satellitesInUse == 8, "GGA copied into the epoch");
+
+  /* A sentence with an empty time field does not end the epoch */
+  checkFeed(&parser, "GPGGA,,4807.04,N,01131.00,E,1,09,0.9,545.4,M,46.9,M,,");
+  checkTrue(deliveredCount == 1, "empty time keeps the epoch open");
+
+  /* Sentences that are not part of a fix are ignored */
+  checkFeed(&parser, "HEHDT,274.07,T");
+  checkTrue(deliveredCount == 1, "HDT ignored");
+
+  /* The receiver goes quiet: the caller's timeout flushes the last epoch */
+  nmeaEpochFlush(&grouper);
+  checkTrue(deliveredCount == 2, "flush delivers the open epoch");
+  checkComplete(&delivered[1], 123520.0f, ALL, "second epoch by flush");
+  checkTrue(delivered[1].gga.satellitesInUse == 9, "last GGA of the epoch kept");
+  nmeaEpochFlush(&grouper);
+  checkTrue(deliveredCount == 2, "flush of an empty epoch delivers nothing");
+  checkTrue(grouper.epochs == 2, "epochs counted");
+}
+
+/* With a terminator each epoch is delivered as soon as it is complete */
+static void checkTerminators(void)
+{
+  const uint8_t ALL = NMEA_EPOCH_RMC | NMEA_EPOCH_GGA | NMEA_EPOCH_GSA | NMEA_EPOCH_GSV | NMEA_EPOCH_ZDA;
+
+  start(ZDA);
+  feedEpoch(19, true);
+  checkTrue(deliveredCount == 1, "ZDA delivers at once");
+  checkComplete(&delivered[0], 123519.0f, ALL, "epoch by ZDA");
+  feedEpoch(20, true);
+  checkTrue(deliveredCount == 2, "ZDA delivers the next epoch");
+  checkComplete(&delivered[1], 123520.0f, ALL, "next epoch by ZDA");
+
+  /* GSV ends the epoch with the last sentence of its series only */
+  start(GSV);
+  feedEpoch(19, false);
+  checkTrue(deliveredCount == 1, "last GSV delivers at once");
+  checkComplete(&delivered[0], 123519.0f, ALL & ~NMEA_EPOCH_ZDA, "epoch by GSV");
+
+  /* A time change still closes an epoch whose terminator was lost */
+  checkFeed(&parser, "GPRMC,123520.00,A,4807.04,N,01131.00,E,22.4,84.4,230394,3.1,W,A,S");
+  checkFeed(&parser, "GPGSV,2,1,06,03,03,111,40,04,15,270,41,06,01,010,42,13,06,292,43");
+  checkTrue(deliveredCount == 1, "first GSV of a series does not deliver");
+  checkFeed(&parser, "GPRMC,123521.00,A,4807.04,N,01131.00,E,22.4,84.4,230394,3.1,W,A,S");
+  checkTrue(deliveredCount == 2, "time change without the terminator");
+  checkTrue(delivered[1].sentences == (NMEA_EPOCH_RMC | NMEA_EPOCH_GSV) && delivered[1].satelliteCount == 4,
+            "epoch without its last GSV");
+}
+
+/* More satellites than an epoch holds are dropped, not written past the array */
+static void checkSatelliteLimit(void)
+{
+  int i;
+
+  start(GSV);
+  for (i = 1; i <= 9; i++)
+  {
+    char body[NMEA_MAX_SENTENCE_LENGTH];
+
+    snprintf(body, sizeof(body), "GPGSV,9,%d,36,%02d,03,111,40,%02d,15,270,41,%02d,01,010,42,%02d,06,292,43", i,
+             4 * i - 3, 4 * i - 2, 4 * i - 1, 4 * i);
+    checkFeed(&parser, body);
+  }
+  checkTrue(deliveredCount == 1, "nine GSV sentences, one epoch");
+  checkTrue(delivered[0].satelliteCount == NMEA_EPOCH_MAX_SATELLITES, "satellites capped");
+  checkTrue(delivered[0].satellites[NMEA_EPOCH_MAX_SATELLITES - 1].satelliteId == NMEA_EPOCH_MAX_SATELLITES,
+            "first satellites kept");
+  checkTrue(!delivered[0].hasTime, "GSV carries no time");
+}
+
+int main(void)
+{
+  checkTimeChange();
+  checkTerminators();
+  checkSatelliteLimit();
+  return checkResult();
+}
+
+#else
+
+int main(void)
+{
+  printf("checkEpoch needs GGA, RMC, GSA, GSV and ZDA enabled\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * Position history known-answer checks for src/nmeaPositionHistory.c:
+ * linear and Hermite interpolation between two fixes, the antimeridian,
+ * course interpolation across north, dead reckoning and its limits, and a
+ * ring that has wrapped.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Itools tools/check/checkHistory.c src/nmea*.c -lm -o checkHistory
+ *   ./checkHistory
+ */
+
+#include "checkUtil.h"
+
+#include "nmeaPositionHistory.h"
+
+#define HOUR_MS 3600000
+#define DEGREES 1e-9 /* Tolerance of positions */
+
+static NmeaFix makeFix(int64_t timeMs, double latitude, double longitude, float course, float speed)
+{
+  NmeaFix fix;
+
+  fix.timeMs = timeMs;
+  fix.latitude = latitude;
+  fix.longitude = longitude;
+  fix.courseOverGround = course;
+  fix.speedOverGround = speed;
+  fix.hasMotion = true;
+  return fix;
+}
+
+/* Two fixes an hour and a degree of latitude apart */
+static void checkInterpolation(void)
+{
+  NmeaPositionHistory history;
+  NmeaFix from = makeFix(0, 0.0, 0.0, 0.0f, 0.0f);
+  NmeaFix to = makeFix(HOUR_MS, 1.0, 0.0, 0.0f, 0.0f);
+  NmeaFix position;
+
+  nmeaHistoryInit(&history);
+  nmeaHistoryAdd(&history, &from);
+  nmeaHistoryAdd(&history, &to);
+
+  checkTrue(nmeaHistoryPositionAt(&history, HOUR_MS / 4, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_INTERPOLATED,
+            "linear source");
+  checkNear(position.latitude, 0.25, DEGREES, "linear at a quarter");
+  checkTrue(position.timeMs == HOUR_MS / 4, "time of the estimate");
+
+  /* Standing still at both ends: only the h01 basis term, 3s^2 - 2s^3 */
+  nmeaHistoryPositionAt(&history, HOUR_MS / 4, NMEA_INTERPOLATE_HERMITE, &position);
+  checkNear(position.latitude, 0.15625, DEGREES, "Hermite at a quarter, zero tangents");
+  nmeaHistoryPositionAt(&history, HOUR_MS / 2, NMEA_INTERPOLATE_HERMITE, &position);
+  checkNear(position.latitude, 0.5, DEGREES, "Hermite halfway, zero tangents");
+
+  /* 60 knots north is one degree per hour, the slope of the chord */
+  nmeaHistoryInit(&history);
+  from.speedOverGround = 60.0f;
+  nmeaHistoryAdd(&history, &from);
+  nmeaHistoryAdd(&history, &to);
+  nmeaHistoryPositionAt(&history, HOUR_MS / 2, NMEA_INTERPOLATE_HERMITE, &position);
+  checkNear(position.latitude, 0.625, DEGREES, "Hermite halfway, 60 kn at the start only");
+  checkNear(position.speedOverGround, 30.0, 1e-4, "interpolated speed");
+  to.speedOverGround = 60.0f;
+  nmeaHistoryInit(&history);
+  nmeaHistoryAdd(&history, &from);
+  nmeaHistoryAdd(&history, &to);
+  nmeaHistoryPositionAt(&history, HOUR_MS / 4, NMEA_INTERPOLATE_HERMITE, &position);
+  checkNear(position.latitude, 0.25, DEGREES, "Hermite matches linear for consistent tangents");
+  checkNear(position.longitude, 0.0, DEGREES, "no drift across track");
+
+  /* Unknown motion is not standing still: the chord stands in for the tangent */
+  from.hasMotion = false;
+  to.hasMotion = false;
+  nmeaHistoryInit(&history);
+  nmeaHistoryAdd(&history, &from);
+  nmeaHistoryAdd(&history, &to);
+  nmeaHistoryPositionAt(&history, HOUR_MS / 4, NMEA_INTERPOLATE_HERMITE, &position);
+  checkNear(position.latitude, 0.25, DEGREES, "Hermite without motion is linear");
+  checkTrue(!position.hasMotion, "no motion interpolated from fixes without it");
+}
+
+static void checkWrapAround(void)
+{
+  NmeaPositionHistory history;
+  NmeaFix from = makeFix(0, 10.0, 179.5, 350.0f, 10.0f);
+  NmeaFix to = makeFix(1000, 10.0, -179.5, 10.0f, 20.0f);
+  NmeaFix position;
+
+  nmeaHistoryInit(&history);
+  nmeaHistoryAdd(&history, &from);
+  nmeaHistoryAdd(&history, &to);
+  nmeaHistoryPositionAt(&history, 250, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.longitude, 179.75, DEGREES, "antimeridian, east of it");
+  nmeaHistoryPositionAt(&history, 750, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.longitude, -179.75, DEGREES, "antimeridian, west of it");
+  nmeaHistoryPositionAt(&history, 500, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.courseOverGround, 0.0, 1e-4, "course through north");
+  nmeaHistoryPositionAt(&history, 250, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.courseOverGround, 355.0, 1e-4, "course before north");
+}
+
+static void checkDeadReckoning(void)
+{
+  NmeaPositionHistory history;
+  NmeaFix fix = makeFix(HOUR_MS, 0.0, 0.0, 90.0f, 60.0f);
+  NmeaFix position;
+
+  nmeaHistoryInit(&history);
+  checkTrue(nmeaHistoryPositionAt(&history, 0, NMEA_INTERPOLATE_LINEAR, &position) == NMEA_POSITION_UNAVAILABLE,
+            "empty history");
+  nmeaHistoryAdd(&history, &fix);
+  checkTrue(nmeaHistoryPositionAt(&history, HOUR_MS - 1, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_UNAVAILABLE,
+            "before the oldest fix");
+  checkTrue(nmeaHistoryPositionAt(&history, HOUR_MS, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_INTERPOLATED,
+            "at the newest fix");
+  checkTrue(nmeaHistoryPositionAt(&history, 2 * HOUR_MS, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_EXTRAPOLATED,
+            "after the newest fix");
+  checkNear(position.longitude, 1.0, DEGREES, "an hour east at 60 kn on the equator");
+  checkNear(position.latitude, 0.0, DEGREES, "east stays on the parallel");
+
+  /* At 60 degrees north a degree of longitude is half as long */
+  nmeaHistoryInit(&history);
+  fix = makeFix(0, 60.0, 0.0, 90.0f, 60.0f);
+  nmeaHistoryAdd(&history, &fix);
+  nmeaHistoryPositionAt(&history, HOUR_MS, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.longitude, 2.0, 1e-6, "an hour east at 60 kn at 60 N");
+
+  /* West across the antimeridian */
+  nmeaHistoryInit(&history);
+  fix = makeFix(0, 0.0, -179.75, 270.0f, 60.0f);
+  nmeaHistoryAdd(&history, &fix);
+  nmeaHistoryPositionAt(&history, HOUR_MS / 2, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.longitude, 179.75, 1e-6, "dead reckoned across the antimeridian");
+
+  /* At the pole the east rate is clamped instead of dividing by zero */
+  nmeaHistoryInit(&history);
+  fix = makeFix(0, 90.0, 0.0, 90.0f, 10.0f);
+  nmeaHistoryAdd(&history, &fix);
+  nmeaHistoryPositionAt(&history, 1000, NMEA_INTERPOLATE_LINEAR, &position);
+  checkTrue(isfinite(position.longitude) && position.longitude >= -180.0 && position.longitude < 180.0,
+            "dead reckoned at the pole");
+}
+
+/* More fixes than the ring holds: the oldest are replaced and the search still finds the bracket */
+static void checkRing(void)
+{
+  NmeaPositionHistory history;
+  NmeaFix position;
+  NmeaFix fix;
+  int i;
+
+  nmeaHistoryInit(&history);
+  for (i = 0; i < NMEA_POSITION_HISTORY_LENGTH + 10; i++)
+  {
+    fix = makeFix(1000 * (int64_t)i, 0.001 * i, 0.0, 0.0f, 0.0f);
+    checkTrue(nmeaHistoryAdd(&history, &fix), "fix added");
+  }
+  checkTrue(history.count == NMEA_POSITION_HISTORY_LENGTH, "ring full");
+  checkTrue(!nmeaHistoryAdd(&history, &fix), "fix not newer rejected");
+  checkTrue(history.count == NMEA_POSITION_HISTORY_LENGTH, "rejected fix not counted");
+
+  checkTrue(nmeaHistoryPositionAt(&history, 9500, NMEA_INTERPOLATE_LINEAR, &position) == NMEA_POSITION_UNAVAILABLE,
+            "replaced fixes are gone");
+  checkTrue(nmeaHistoryPositionAt(&history, 10000, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_INTERPOLATED,
+            "oldest fix kept");
+  checkNear(position.latitude, 0.010, DEGREES, "at the oldest fix");
+  /* The first fix went to the start of the storage, so this interval straddles its end */
+  nmeaHistoryPositionAt(&history, 1000 * (NMEA_POSITION_HISTORY_LENGTH - 1) + 500, NMEA_INTERPOLATE_LINEAR,
+                        &position);
+  checkNear(position.latitude, 0.001 * (NMEA_POSITION_HISTORY_LENGTH - 1) + 0.0005, DEGREES,
+            "between the storage end and start");
+  for (i = 10; i < NMEA_POSITION_HISTORY_LENGTH + 9; i++)
+  {
+    nmeaHistoryPositionAt(&history, 1000 * (int64_t)i + 250, NMEA_INTERPOLATE_LINEAR, &position);
+    checkNear(position.latitude, 0.001 * i + 0.00025, DEGREES, "every interval of the wrapped ring");
+  }
+}
+
+#if CFG_SENTENCE_RMC_ENABLED
+static NmeaPositionHistory sentenceHistory;
+static int64_t sentenceTimeMs;
+
+static void onSentence(const NmeaSentence *sentence, void *context)
+{
+  (void)context;
+  nmeaHistoryAddSentence(&sentenceHistory, sentence, sentenceTimeMs);
+}
+
+static void checkSentence(void)
+{
+  NmeaParser parser;
+  NmeaFix position;
+
+  nmeaHistoryInit(&sentenceHistory);
+  nmeaParserInit(&parser, onSentence, NULL);
+  sentenceTimeMs = 5000;
+  checkFeed(&parser, "GPRMC,123519.00,V,4807.04,N,01131.00,E,22.4,84.4,230394,3.1,W,N,V");
+  checkTrue(sentenceHistory.count == 0, "RMC without a valid fix ignored");
+  checkFeed(&parser, "GPRMC,123519.00,A,4807.04,S,01131.00,W,22.4,84.4,230394,3.1,W,A,S");
+  checkTrue(sentenceHistory.count == 1, "valid RMC added");
+  nmeaHistoryPositionAt(&sentenceHistory, 5000, NMEA_INTERPOLATE_LINEAR, &position);
+  checkNear(position.latitude, -(48.0 + 7.04 / 60.0), 1e-5, "RMC latitude");
+  checkNear(position.longitude, -(11.0 + 31.0 / 60.0), 1e-5, "RMC longitude");
+  checkNear(position.courseOverGround, 84.4, 1e-4, "RMC course");
+  checkTrue(position.hasMotion, "RMC with course and speed");
+
+  /* Null course and speed: the fix holds its position when dead reckoned */
+  sentenceTimeMs = 6000;
+  checkFeed(&parser, "GPRMC,123520.00,A,4808.04,S,01131.00,W,,,230394,3.1,W,A,S");
+  checkTrue(sentenceHistory.count == 2, "RMC without motion added");
+  checkTrue(nmeaHistoryPositionAt(&sentenceHistory, 6000 + HOUR_MS, NMEA_INTERPOLATE_LINEAR, &position) ==
+                NMEA_POSITION_EXTRAPOLATED,
+            "dead reckoned without motion");
+  checkNear(position.latitude, -(48.0 + 8.04 / 60.0), 1e-5, "position held without motion");
+  checkTrue(!position.hasMotion && position.speedOverGround == 0.0f, "no motion reported");
+  nmeaHistoryPositionAt(&sentenceHistory, 5500, NMEA_INTERPOLATE_LINEAR, &position);
+  checkTrue(position.hasMotion, "motion of the fix that has it");
+  checkNear(position.courseOverGround, 84.4, 1e-4, "course of the fix that has it");
+}
+#endif
+
+int main(void)
+{
+  checkInterpolation();
+  checkWrapAround();
+  checkDeadReckoning();
+  checkRing();
+#if CFG_SENTENCE_RMC_ENABLED
+  checkSentence();
+#endif
+  return checkResult();
+}
@@ -0,0 +1,191 @@
+/*
+ * Navigator known-answer checks for src/nmeaNavigator.c: cross-track error
+ * and steer direction, bearings and distances against the spherical
+ * formulas, perpendicular passage and arrival, the encoded APB, XTE, BWC, RMB
+ * and BOD sentences of a leg along the equator, and waypoint minutes that
+ * round up to a whole degree.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Iinc -Itools tools/check/checkNavigator.c src/nmea*.c -lm -o checkNavigator
+ *   ./checkNavigator
+ */
+
+#include "checkUtil.h"
+
+#include "nmeaNavigator.h"
+
+#if CFG_SENTENCE_APB_ENABLED && CFG_SENTENCE_XTE_ENABLED && CFG_SENTENCE_BWC_ENABLED && CFG_SENTENCE_RMB_ENABLED && \
+    CFG_SENTENCE_BOD_ENABLED
+
+#define PI 3.14159265358979323846
+#define RADIANS(degrees) ((degrees) * PI / 180.0)
+#define DEGREES(radians) ((radians) * 180.0 / PI)
+
+/* Initial great circle bearing, the textbook formula */
+static double bearing(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+{
+  double y = sin(RADIANS(toLongitude - fromLongitude)) * cos(RADIANS(toLatitude));
+  double x = cos(RADIANS(fromLatitude)) * sin(RADIANS(toLatitude)) -
+             sin(RADIANS(fromLatitude)) * cos(RADIANS(toLatitude)) * cos(RADIANS(toLongitude - fromLongitude));
+
+  return fmod(DEGREES(atan2(y, x)) + 360.0, 360.0);
+}
+
+/* Haversine distance in nautical miles */
+static double distance(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+{
+  double a = pow(sin(RADIANS(toLatitude - fromLatitude) / 2.0), 2.0) +
+             cos(RADIANS(fromLatitude)) * cos(RADIANS(toLatitude)) *
+                 pow(sin(RADIANS(toLongitude - fromLongitude) / 2.0), 2.0);
+
+  return 2.0 * asin(sqrt(a)) * NMEA_EARTH_RADIUS_NM;
+}
+
+static NmeaWaypoint makeWaypoint(const char *id, double latitude, double longitude)
+{
+  NmeaWaypoint waypoint;
+
+  memset(&waypoint, 0, sizeof(waypoint));
+  strncpy(waypoint.id, id, sizeof(waypoint.id) - 1u);
+  waypoint.latitude = latitude;
+  waypoint.longitude = longitude;
+  return waypoint;
+}
+
+static NmeaFix makeFix(double latitude, double longitude, float course, float speed)
+{
+  NmeaFix fix;
+
+  fix.timeMs = 0;
+  fix.latitude = latitude;
+  fix.longitude = longitude;
+  fix.courseOverGround = course;
+  fix.speedOverGround = speed;
+  fix.hasMotion = true;
+  return fix;
+}
+
+static void checkEncoded(NmeaNavigator *navigator, SentenceID sentenceId, const char *expected, const char *what)
+{
+  char text[NMEA_MAX_SENTENCE_LENGTH + 1];
+  size_t length = 0;
+
+  checkTrue(nmeaNavigatorEncode(navigator, sentenceId, text, sizeof(text) - 1u, &length) == NMEA_OK, what);
+  text[length] = '\0';
+  checkText(text, expected, what);
+}
+
+/* Eastbound along the equator: every answer is exact */
+static void checkEquatorLeg(void)
+{
+  NmeaNavigator navigator;
+  NmeaWaypoint origin = makeWaypoint("ORIG", 0.0, 0.0);
+  NmeaWaypoint destination = makeWaypoint("DEST", 0.0, 10.0);
+  NmeaFix fix = makeFix(0.1, 5.0, 90.0f, 12.0f);
+  char text[NMEA_MAX_SENTENCE_LENGTH + 1];
+  size_t length;
+
+  nmeaNavigatorInit(&navigator, GPS_POSITIONING);
+  checkTrue(!nmeaNavigatorUpdate(&navigator, &fix, 123519.0f), "no update without a leg");
+  checkTrue(nmeaNavigatorEncode(&navigator, APB, text, sizeof(text), &length) == NMEA_ERROR_UNSUPPORTED,
+            "no sentence before an update");
+  nmeaNavigatorSetLeg(&navigator, &origin, &destination, NMEA_LEG_GREAT_CIRCLE, 0.1);
+  nmeaNavigatorSetVariation(&navigator, 2.5);
+
+  /* 0.1 degrees north of an eastbound track is left of it: steer right */
+  nmeaNavigatorUpdate(&navigator, &fix, 123519.0f);
+  checkNear(navigator.status.crossTrackError, -RADIANS(0.1) * NMEA_EARTH_RADIUS_NM, 1e-6, "XTE left of the track");
+  checkNear(navigator.status.bearingToDestination, bearing(0.1, 5.0, 0.0, 10.0), 1e-6, "bearing to destination");
+  checkNear(navigator.status.distanceToDestination, distance(0.1, 5.0, 0.0, 10.0), 1e-6, "distance to destination");
+  checkNear(navigator.status.closingVelocity, 12.0 * cos(RADIANS(bearing(0.1, 5.0, 0.0, 10.0) - 90.0)), 1e-4,
+            "closing velocity");
+  checkTrue(!navigator.status.perpendicularPassed && !navigator.status.arrivalCircleEntered, "halfway");
+
+  checkEncoded(&navigator, APB, "$GPAPB,A,A,6.00,R,N,V,V,90.0,T,DEST,91.1,T,91.1,T,A*68\r\n", "APB");
+  checkEncoded(&navigator, XTE, "$GPXTE,A,A,6.00,R,N,A*1B\r\n", "XTE");
+  checkEncoded(&navigator, BWC, "$GPBWC,123519.00,0000.00,N,01000.00,E,91.1,T,88.6,M,300.3,N,DEST,A*45\r\n", "BWC");
+  checkEncoded(&navigator, RMB, "$GPRMB,A,6.00,R,ORIG,DEST,0000.00,N,01000.00,E,300.3,91.1,12.0,V,A*5D\r\n", "RMB");
+  checkEncoded(&navigator, BOD, "$GPBOD,90.0,T,87.5,M,DEST,ORIG*51\r\n", "BOD");
+  checkTrue(nmeaNavigatorEncode(&navigator, GGA, text, sizeof(text), &length) == NMEA_ERROR_UNSUPPORTED,
+            "GGA is not a navigator sentence");
+
+  /* South of the track: steer left */
+  fix = makeFix(-0.05, 9.0, 90.0f, 12.0f);
+  nmeaNavigatorUpdate(&navigator, &fix, 123520.0f);
+  checkNear(navigator.status.crossTrackError, RADIANS(0.05) * NMEA_EARTH_RADIUS_NM, 1e-6, "XTE right of the track");
+  checkEncoded(&navigator, XTE, "$GPXTE,A,A,3.00,L,N,A*00\r\n", "XTE steering left");
+
+  /* The perpendicular through the destination, off the track */
+  fix = makeFix(0.05, 9.99, 90.0f, 12.0f);
+  nmeaNavigatorUpdate(&navigator, &fix, 123521.0f);
+  checkTrue(!navigator.status.perpendicularPassed, "just before the perpendicular");
+  fix = makeFix(0.05, 10.01, 90.0f, 12.0f);
+  nmeaNavigatorUpdate(&navigator, &fix, 123522.0f);
+  checkTrue(navigator.status.perpendicularPassed, "just past the perpendicular");
+  checkTrue(!navigator.status.arrivalCircleEntered, "past, outside the arrival circle");
+  checkEncoded(&navigator, RMB, "$GPRMB,A,3.00,R,ORIG,DEST,0000.00,N,01000.00,E,3.1,191.3,-2.4,A,A*66\r\n",
+               "RMB arrived by the perpendicular");
+
+  /* Within the arrival circle */
+  fix = makeFix(0.0, 9.999, 90.0f, 12.0f);
+  nmeaNavigatorUpdate(&navigator, &fix, 123523.0f);
+  checkTrue(navigator.status.arrivalCircleEntered && !navigator.status.perpendicularPassed, "arrival circle");
+}
+
+/* A leg across the North Sea against the spherical formulas */
+static void checkNorthernLeg(void)
+{
+  NmeaNavigator navigator;
+  NmeaWaypoint origin = makeWaypoint("A", 50.0, -5.0);
+  NmeaWaypoint destination = makeWaypoint("B", 58.0, 3.0);
+  NmeaFix fix = makeFix(54.0, -2.0, 30.0f, 8.0f);
+  double originToFix = distance(50.0, -5.0, 54.0, -2.0) / NMEA_EARTH_RADIUS_NM;
+  double offTrack = RADIANS(bearing(50.0, -5.0, 54.0, -2.0) - bearing(50.0, -5.0, 58.0, 3.0));
+
+  nmeaNavigatorInit(&navigator, GPS_POSITIONING);
+  nmeaNavigatorSetLeg(&navigator, &origin, &destination, NMEA_LEG_GREAT_CIRCLE, 0.5);
+  nmeaNavigatorUpdate(&navigator, &fix, 0.0f);
+  checkNear(navigator.legBearing, bearing(50.0, -5.0, 58.0, 3.0), 1e-6, "leg bearing");
+  checkNear(navigator.legLength, distance(50.0, -5.0, 58.0, 3.0), 1e-6, "leg length");
+  checkNear(navigator.status.crossTrackError, asin(sin(originToFix) * sin(offTrack)) * NMEA_EARTH_RADIUS_NM, 1e-6,
+            "cross-track formula");
+  checkNear(navigator.status.bearingToDestination, bearing(54.0, -2.0, 58.0, 3.0), 1e-6, "bearing formula");
+  checkNear(navigator.status.distanceToDestination, distance(54.0, -2.0, 58.0, 3.0), 1e-6, "distance formula");
+  checkTrue(navigator.status.crossTrackError < 0.0, "west of a north-east track is left of it");
+}
+
+/* 49 deg 59.99999' prints as 50 degrees at any encoded decimals, not as 60 minutes */
+static void checkMinutesCarry(void)
+{
+  NmeaNavigator navigator;
+  NmeaWaypoint origin = makeWaypoint("A", 49.0, 8.0);
+  NmeaWaypoint destination = makeWaypoint("B", 49.0 + 59.99999 / 60.0, -(179.0 + 59.99999 / 60.0));
+  NmeaFix fix = makeFix(49.5, 8.1, 0.0f, 5.0f);
+  char text[NMEA_MAX_SENTENCE_LENGTH + 1];
+  size_t length = 0;
+
+  nmeaNavigatorInit(&navigator, GPS_POSITIONING);
+  nmeaNavigatorSetLeg(&navigator, &origin, &destination, NMEA_LEG_GREAT_CIRCLE, 0.1);
+  nmeaNavigatorUpdate(&navigator, &fix, 0.0f);
+  nmeaNavigatorEncode(&navigator, BWC, text, sizeof(text) - 1u, &length);
+  text[length] = '\0';
+  checkTrue(strstr(text, ",5000.") != NULL && strstr(text, ",18000.") != NULL, "minutes carried into the degrees");
+}
+
+int main(void)
+{
+  checkEquatorLeg();
+  checkNorthernLeg();
+  checkMinutesCarry();
+  return checkResult();
+}
+
+#else
+
+int main(void)
+{
+  printf("checkNavigator needs APB, XTE, BWC, RMB and BOD enabled\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef TOOLS_CHECK_CHECK_UTIL_H_
+#define TOOLS_CHECK_CHECK_UTIL_H_
+
+/*
+ * Shared helpers for the known-answer checks in tools/check. Each check
+ * program counts its failures here and returns checkResult() from main().
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nmea0183.h"
+
+static int checkCount;
+static int checkFailures;
+
+static inline void checkTrue(bool condition, const char *what)
+{
+  checkCount++;
+  if (!condition)
+  {
+    printf("FAILED: %s\n", what);
+    checkFailures++;
+  }
+}
+
+static inline void checkNear(double actual, double expected, double tolerance, const char *what)
+{
+  checkCount++;
+  if (!(fabs(actual - expected) <= tolerance))
+  {
+    printf("FAILED: %s: %.9f, expected %.9f\n", what, actual, expected);
+    checkFailures++;
+  }
+}
+
+static inline void checkText(const char *actual, const char *expected, const char *what)
+{
+  checkCount++;
+  if (strcmp(actual, expected) != 0)
+  {
+    printf("FAILED: %s: \"%s\", expected \"%s\"\n", what, actual, expected);
+    checkFailures++;
+  }
+}
+
+/* Feeds a sentence given without '$', checksum and CR/LF */
+static inline void checkFeed(NmeaParser *parser, const char *body)
+{
+  char sentence[NMEA_MAX_SENTENCE_LENGTH + 16];
+  uint8_t checksum = 0;
+  const char *p;
+  int length;
+
+  for (p = body; *p != '\0'; p++)
+  {
+    checksum ^= (uint8_t)*p;
+  }
+  length = snprintf(sentence, sizeof(sentence), "$%s*%02X\r\n", body, checksum);
+  nmeaFeed(parser, (const uint8_t *)sentence, (size_t)length);
+}
+
+static inline int checkResult(void)
+{
+  if (checkFailures != 0)
+  {
+    printf("%d of %d checks FAILED\n", checkFailures, checkCount);
+    return 1;
+  }
+  printf("%d checks passed\n", checkCount);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,109 @@
+/* Generated by tools/nmeagen.py from spec/sentences.json, do not edit. */
+
+#ifndef TOOLS_NMEA_TEST_VECTORS_H_
+#define TOOLS_NMEA_TEST_VECTORS_H_
+
+#include "nmeaSentences.h"
+
+/**
+ * @brief Example sentence of an enabled sentence type.
+ *
+ * Every example is in canonical form: decoding it and encoding the result
+ * reproduces the sentence exactly.
+ */
+typedef struct NmeaTestVector
+{
+  SentenceID sentenceId; /**< Sentence formatter of the example */
+  const char *sentence;  /**< Complete sentence including checksum and CR/LF */
+} NmeaTestVector;
+
+/** Test vectors, terminated by an entry with a NULL sentence. */
+static const NmeaTestVector NMEA_TEST_VECTORS[] = {
+#if CFG_SENTENCE_AAM_ENABLED
+    {AAM, "$GPAAM,A,A,0.10,N,WPTNME*32\r\n"},
+#endif
+#if CFG_SENTENCE_ABK_ENABLED
+    {ABK, "$AIABK,503123456,A,6,1,0*2B\r\n"},
+#endif
+#if CFG_SENTENCE_ABM_ENABLED
+    {ABM, "!AIABM,1,1,0,503123456,0,6,04000000000,0*45\r\n"},
+#endif
+#if CFG_SENTENCE_ACA_ENABLED
+    {ACA, "$AIACA,0,5130.00,N,00030.00,W,5100.00,N,00100.00,W,2,2087,0,2088,0,0,0,C,1,*19\r\n"},
+#endif
+#if CFG_SENTENCE_ACK_ENABLED
+    {ACK, "$IIACK,001*54\r\n"},
+#endif
+#if CFG_SENTENCE_ACN_ENABLED
+    {ACN, "$VRACN,120000.00,,3008,1,A,C*5D\r\n"},
+    {ACN, "$VRACN,,,3008,1,A,C*70\r\n"},
+#endif
+#if CFG_SENTENCE_ACS_ENABLED
+    {ACS, "$AIACS,0,002320001,120000.00,18,10,2026*78\r\n"},
+#endif
+#if CFG_SENTENCE_AIR_ENABLED
+    {AIR, "$AIAIR,503123456,3,0,5,0,503654321,3,0,A,1000,1001,2000*15\r\n"},
+#endif
+#if CFG_SENTENCE_AKD_ENABLED
+    {AKD, "$IIAKD,120000.00,FR,FD,1,1,BN,FR,2*5F\r\n"},
+#endif
+#if CFG_SENTENCE_ALA_ENABLED
+    {ALA, "$FRALA,120000.00,FR,FD,01,001,H,V,FIRE*55\r\n"},
+#endif
+#if CFG_SENTENCE_ALC_ENABLED
+    {ALC, "$VRALC,01,01,00,2,,3008,1,1,,3015,1,2*77\r\n"},
+#endif
+#if CFG_SENTENCE_ALF_ENABLED
+    {ALF, "$VRALF,1,1,0,120000.00,B,W,V,,3008,1,1,0,LOST TARGET*33\r\n"},
+#endif
+#if CFG_SENTENCE_ALR_ENABLED
+    {ALR, "$IIALR,120000.00,001,A,V,BILGE ALARM*4E\r\n"},
+#endif
+#if CFG_SENTENCE_APB_ENABLED
+    {APB, "$GPAPB,A,A,0.10,R,N,V,V,11.0,T,DEST,11.0,T,11.0,T,A*66\r\n"},
+#endif
+#if CFG_SENTENCE_ARC_ENABLED
+    {ARC, "$VRARC,120000.00,,3008,1,A*2E\r\n"},
+#endif
+#if CFG_SENTENCE_BOD_ENABLED
+    {BOD, "$GPBOD,97.0,T,103.2,M,POINTB,POINTA*7A\r\n"},
+#endif
+#if CFG_SENTENCE_BWC_ENABLED
+    {BWC, "$GPBWC,225444.00,4917.24,N,12309.57,W,51.9,T,31.6,M,1.3,N,004,A*6A\r\n"},
+#endif
+#if CFG_SENTENCE_DTM_ENABLED
+    {DTM, "$GPDTM,999,,0.0800,N,0.0700,E,-47.7,W84*1B\r\n"},
+#endif
+#if CFG_SENTENCE_GGA_ENABLED
+    {GGA, "$GPGGA,123519.00,4807.04,N,01131.00,E,1,08,0.9,545.4,M,46.9,M,,*66\r\n"},
+#endif
+#if CFG_SENTENCE_GSA_ENABLED
+    {GSA, "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n"},
+#endif
+#if CFG_SENTENCE_GST_ENABLED
+    {GST, "$GPGST,123519.00,1.3,2.1,1.4,45.0,1.6,1.5,3.2*6D\r\n"},
+#endif
+#if CFG_SENTENCE_GSV_ENABLED
+    {GSV, "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74\r\n"},
+#endif
+#if CFG_SENTENCE_HDT_ENABLED
+    {HDT, "$HEHDT,274.1,T*2F\r\n"},
+#endif
+#if CFG_SENTENCE_RMB_ENABLED
+    {RMB, "$GPRMB,A,0.66,L,003,004,4917.24,N,12309.57,W,1.3,52.5,0.5,V,A*7D\r\n"},
+#endif
+#if CFG_SENTENCE_RMC_ENABLED
+    {RMC, "$GPRMC,123519.00,A,4807.04,N,01131.00,E,22.4,84.4,230394,3.1,W,A,S*59\r\n"},
+#endif
+#if CFG_SENTENCE_VTG_ENABLED
+    {VTG, "$GPVTG,54.7,T,34.4,M,5.5,N,10.2,K,A*15\r\n"},
+#endif
+#if CFG_SENTENCE_XTE_ENABLED
+    {XTE, "$GPXTE,A,A,0.67,L,N,A*02\r\n"},
+#endif
+#if CFG_SENTENCE_ZDA_ENABLED
+    {ZDA, "$GPZDA,123519.00,23,03,1994,-05,00*44\r\n"},
+#endif
+    {(SentenceID)0, 0}};
+
+#endif
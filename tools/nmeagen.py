@@ -0,0 +1,702 @@
+#!/usr/bin/env python3
+"""Sentence code generator.
+
+Reads the machine-readable sentence specification (spec/sentences.json) and
+regenerates everything that is derived from it:
+
+  inc/nmeaConfig.h         sentence switches, size parameters and field masks
+                           (the values already in the file are preserved)
+  inc/nmeaSentences.h      SENTENCE_* structures and the NmeaSentence union
+  src/nmeaSentences.c      field decoders and encoders
+  tools/nmeaTestVectors.h  example sentences with valid checksums
+
+Usage:
+  tools/nmeagen.py          regenerate the files in place
+  tools/nmeagen.py --check  exit with status 1 if any file is out of date
+
+Field types understood by the generator:
+
+  char       single character, optionally stored as an enum ("ctype")
+  uint8/16/32 unsigned decimal, optionally stored as an enum ("ctype");
+             "digits" sets the zero padded width used when encoding
+  float      decimal number, "decimals" sets the encoded precision
+  time       hhmmss.ss
+  latitude   llll.ll
+  longitude  yyyyy.yy
+  text       NUL terminated character array of "size" bytes
+  group      array of "size" group structures, "count" names the field
+             holding the number of entries present in the sentence; with
+             "trailing" the entries fill the rest of the sentence and "count"
+             names a generated member that receives their number
+
+Every sentence has a field mask in nmeaConfig.h, CFG_SENTENCE_<ID>_FIELDS, of
+the <ID>_<FIELD>_PRESENT bits to decode. The decoder skips the other fields
+without converting them and the encoder writes them as null fields; with
+CFG_OMIT_MASKED_FIELDS they are also left out of the structure. Groups, and
+the fields that hold their number of entries, are always decoded.
+"""
+
+import json
+import os
+import re
+import sys
+import textwrap
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SPEC_PATH = os.path.join(ROOT, "spec", "sentences.json")
+CONFIG_PATH = os.path.join(ROOT, "inc", "nmeaConfig.h")
+HEADER_PATH = os.path.join(ROOT, "inc", "nmeaSentences.h")
+SOURCE_PATH = os.path.join(ROOT, "src", "nmeaSentences.c")
+VECTORS_PATH = os.path.join(ROOT, "tools", "nmeaTestVectors.h")
+
+GENERATED_NOTE = "Generated by tools/nmeagen.py from spec/sentences.json, do not edit."
+
+C_TYPES = {
+    "char": "char",
+    "uint8": "uint8_t",
+    "uint16": "uint16_t",
+    "uint32": "uint32_t",
+    "float": "float",
+    "time": "float",
+    "latitude": "float",
+    "longitude": "float",
+}
+
+# Encoded layout (minimum integer digits, decimals) of the fixed format types;
+# the decimals of time and position are encoder settings in nmeaConfig.h
+FLOAT_LAYOUTS = {
+    "float": (1, None),
+    "time": (6, "NMEA_TIME_DECIMALS"),
+    "latitude": (4, "NMEA_LATITUDE_DECIMALS"),
+    "longitude": (5, "NMEA_LONGITUDE_DECIMALS"),
+}
+
+UINT_CONVERTERS = {
+    "uint8": "nmeaFieldToUint8",
+    "uint16": "nmeaFieldToUint16",
+    "uint32": "nmeaFieldToUint32",
+}
+
+UINT_TEMPORARIES = {"uint8": "u8", "uint16": "u16", "uint32": "u32"}
+
+CHECKSUM_DOC = (
+    "An 8-bit checksum for error detection is computed by XOR'ing the data "
+    "bits of each character in the sentence, excluding \"$\" and \"*\", "
+    "without including start or stop bits."
+)
+
+
+def fail(message):
+    sys.stderr.write("nmeagen: %s\n" % message)
+    sys.exit(2)
+
+
+def load_spec():
+    with open(SPEC_PATH, encoding="utf-8") as f:
+        spec = json.load(f)
+    groups = {g["name"]: g for g in spec.get("groups", [])}
+    seen = set()
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        if not re.fullmatch(r"[A-Z0-9]{3}", sid) or sid in seen:
+            fail("invalid or duplicate sentence id '%s'" % sid)
+        seen.add(sid)
+        if len(presence_fields(sentence)) > 32:
+            fail("%s has more fields than presentFields can hold" % sid)
+        for field in sentence["fields"]:
+            check_field(sid, field, groups)
+            if field.get("trailing") and field is not sentence["fields"][-1]:
+                fail("%s.%s is trailing but not the last field" % (sid, field["name"]))
+    for group in groups.values():
+        for field in group["fields"]:
+            if field["type"] == "group":
+                fail("group '%s' may not nest groups" % group["name"])
+            check_field(group["name"], field, groups)
+    return spec, groups
+
+
+def check_field(owner, field, groups):
+    kind = field["type"]
+    if kind in ("text", "group") and "size" not in field:
+        fail("%s.%s needs a size" % (owner, field["name"]))
+    if kind == "group" and (field.get("group") not in groups or "count" not in field):
+        fail("%s.%s needs a known group and a count field" % (owner, field["name"]))
+    if kind == "float" and "decimals" not in field:
+        fail("%s.%s needs decimals" % (owner, field["name"]))
+    if kind not in C_TYPES and kind not in ("text", "group"):
+        fail("%s.%s has unknown type '%s'" % (owner, field["name"], kind))
+
+
+def member_name(sentence):
+    return sentence["id"].lower()
+
+
+def macro_case(name):
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+
+
+def presence_fields(sentence):
+    """Fields that own a presence bit, in bit order. Groups carry their own count."""
+    return [f for f in sentence["fields"] if f["type"] != "group"]
+
+
+def presence_macro(sid, field):
+    return "%s_%s_PRESENT" % (sid, macro_case(field["name"]))
+
+
+def mask_macro(sid):
+    return "CFG_SENTENCE_%s_FIELDS" % sid
+
+
+def group_counts(sentence):
+    """Names of the fields holding the number of entries of a group."""
+    return {f["count"] for f in sentence["fields"] if f["type"] == "group" and not f.get("trailing")}
+
+
+def field_guard(sentence, field):
+    """Preprocessor condition under which a field is decoded and encoded, None
+    for a group count, which the group loops always need."""
+    if field["name"] in group_counts(sentence):
+        return None
+    sid = sentence["id"]
+    return "%s & %s" % (mask_macro(sid), presence_macro(sid, field))
+
+
+def field_declaration(field):
+    """Returns (type, declarator) of a structure member."""
+    kind = field["type"]
+    if kind == "text":
+        return "char", "%s[%s]" % (field["name"], field["size"])
+    if kind == "group":
+        return field["group"], "%s[%s]" % (field["name"], field["size"])
+    return field.get("ctype", C_TYPES[kind]), field["name"]
+
+
+def doc_lines(text, indent=" * "):
+    return [indent + line for line in textwrap.wrap(text, 80 - len(indent))]
+
+
+def structure_doc(brief, description, fields):
+    lines = ["/**", " * @brief " + brief, " *"]
+    for paragraph in description:
+        lines += doc_lines(paragraph)
+        lines.append(" *")
+    for ctype, declarator, doc in fields:
+        lines.append(" * @var %s %s" % (ctype, declarator))
+        lines += doc_lines("@brief " + doc)
+        lines.append(" *")
+    lines[-1] = " */"
+    return lines
+
+
+def structure_body(name, members, guards=None):
+    """guards optionally maps a declarator to the condition it is compiled under."""
+    lines = ["typedef struct %s" % name, "{"]
+    for ctype, declarator in members:
+        guard = (guards or {}).get(declarator)
+        if guard:
+            lines.append("#if %s" % guard)
+        lines.append("  %s %s;" % (ctype, declarator))
+        if guard:
+            lines.append("#endif")
+    lines.append("} %s;" % name)
+    return lines
+
+
+# ---------------------------------------------------------------------------
+# nmeaSentences.h
+
+
+def generate_group(group):
+    members = [field_declaration(f) for f in group["fields"]]
+    docs = [(t, d, f["doc"]) for (t, d), f in zip(members, group["fields"])]
+    lines = structure_doc(group["brief"], group["description"], docs)
+    lines += structure_body(group["name"], members)
+    return lines
+
+
+def generate_sentence_struct(sentence):
+    sid = sentence["id"]
+    name = "SENTENCE_" + sid
+    members = [("AddressField", "addressField"), ("uint32_t", "presentFields")]
+    guards = {}
+    docs = [("AddressField", "addressField",
+             "The address field of the sentence: talker ID and sentence formatter (%s)." % sid),
+            ("uint32_t", "presentFields",
+             "Bit mask of the fields that were not null (%s_*_PRESENT). Null fields "
+             "read as zero or empty; the encoder writes a null field for every "
+             "clear bit." % sid)]
+    for field in sentence["fields"]:
+        if field.get("trailing"):
+            members.append(("uint8_t", field["count"]))
+            docs.append(("uint8_t", field["count"], "Number of entries in %s." % field["name"]))
+        ctype, declarator = field_declaration(field)
+        members.append((ctype, declarator))
+        docs.append((ctype, declarator, field["doc"]))
+        if field["type"] != "group" and field_guard(sentence, field):
+            guards[declarator] = "!CFG_OMIT_MASKED_FIELDS || (%s)" % field_guard(sentence, field)
+    members.append(("uint8_t", "checksum"))
+    docs.append(("uint8_t", "checksum", CHECKSUM_DOC))
+
+    lines = ["#if CFG_SENTENCE_%s_ENABLED" % sid]
+    lines.append("/* SENTENCE_%s.presentFields bits, also the bits of %s */" % (sid, mask_macro(sid)))
+    fields = presence_fields(sentence)
+    for bit, field in enumerate(fields):
+        lines.append("#define %s (1UL << %d)" % (presence_macro(sid, field), bit))
+    lines.append("#define %s_ALL_PRESENT 0x%XUL" % (sid, (1 << len(fields)) - 1))
+    lines.append("#if (%s) & ~%s_ALL_PRESENT" % (mask_macro(sid), sid))
+    lines.append('#error "%s has bits outside %s_ALL_PRESENT"' % (mask_macro(sid), sid))
+    lines.append("#endif")
+    lines.append("")
+    lines += structure_doc(sentence["brief"], sentence["description"], docs)
+    lines += structure_body(name, members, guards)
+    lines.append("#endif // CFG_SENTENCE_%s_ENABLED" % sid)
+    return lines
+
+
+def generate_header_region(spec, groups):
+    out = []
+    for group in groups.values():
+        out += generate_group(group)
+        out.append("")
+    for sentence in spec["sentences"]:
+        out += generate_sentence_struct(sentence)
+        out.append("")
+
+    out += [
+        "/**",
+        " * @brief Any decoded sentence.",
+        " *",
+        " * Every SENTENCE_* structure begins with its AddressField, so",
+        " * addressField.sentenceId identifies the valid member of the union.",
+        " */",
+        "typedef union NmeaSentence",
+        "{",
+        "  AddressField addressField; /**< Common initial member of every sentence */",
+    ]
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        out += [
+            "#if CFG_SENTENCE_%s_ENABLED" % sid,
+            "  SENTENCE_%s %s;" % (sid, member_name(sentence)),
+            "#endif",
+        ]
+    out += [
+        "} NmeaSentence;",
+        "",
+        "/**",
+        " * @brief Decodes the data fields of the sentence selected by",
+        " * sentence->addressField.sentenceId.",
+        " *",
+        " * @param cursor   Data fields following the address field.",
+        " * @param checksum Verified checksum of the sentence.",
+        " * @param sentence Receives the decoded fields; addressField must be set.",
+        " * @return NMEA_OK, NMEA_ERROR_UNSUPPORTED or NMEA_ERROR_FIELD.",
+        " */",
+        "NmeaStatus nmeaDecodeFields(NmeaCursor *cursor, uint8_t checksum, NmeaSentence *sentence);",
+        "",
+        "/**",
+        " * @brief Encodes the data fields, each preceded by its ',' delimiter.",
+        " * @return NMEA_OK, or NMEA_ERROR_UNSUPPORTED for a disabled sentence.",
+        " */",
+        "NmeaStatus nmeaEncodeFields(const NmeaSentence *sentence, NmeaWriter *writer);",
+        "",
+        "/**",
+        " * @brief Returns the start delimiter ('$' or '!') of a sentence, or '\\0' if",
+        " * the sentence is unknown or disabled.",
+        " */",
+        "char nmeaSentenceDelimiter(SentenceID sentenceId);",
+    ]
+    return out
+
+
+# ---------------------------------------------------------------------------
+# nmeaSentences.c
+
+
+def decode_statements(field, target, temporaries, source="nmeaNextField(cursor)"):
+    kind = field["type"]
+    value = "%s%s" % (target, field["name"])
+    ctype = field.get("ctype")
+    if kind == "char":
+        if ctype:
+            temporaries.add(("char", "c"))
+            return ["ok &= nmeaFieldToChar(%s, &c);" % source,
+                    "%s = (%s)c;" % (value, ctype)]
+        return ["ok &= nmeaFieldToChar(%s, &%s);" % (source, value)]
+    if kind in UINT_CONVERTERS:
+        if ctype:
+            temp = UINT_TEMPORARIES[kind]
+            temporaries.add((C_TYPES[kind], temp))
+            return ["ok &= %s(%s, &%s);" % (UINT_CONVERTERS[kind], source, temp),
+                    "%s = (%s)%s;" % (value, ctype, temp)]
+        return ["ok &= %s(%s, &%s);" % (UINT_CONVERTERS[kind], source, value)]
+    if kind in FLOAT_LAYOUTS:
+        return ["ok &= nmeaFieldToFloat(%s, &%s);" % (source, value)]
+    if kind == "text":
+        return ["ok &= nmeaFieldToText(%s, %s, sizeof(%s));" % (source, value, value)]
+    raise AssertionError(kind)
+
+
+def encode_value(field, target):
+    kind = field["type"]
+    value = "%s%s" % (target, field["name"])
+    if kind == "char":
+        return "nmeaPutFieldChar(writer, (char)%s);" % value
+    if kind in UINT_CONVERTERS:
+        return "nmeaPutUint(writer, (uint32_t)%s, %d);" % (value, field.get("digits", 1))
+    if kind in FLOAT_LAYOUTS:
+        digits, decimals = FLOAT_LAYOUTS[kind]
+        return "nmeaPutFloat(writer, %s, %d, %s);" % (
+            value, field.get("digits", digits), field.get("decimals", decimals))
+    if kind == "text":
+        return "nmeaPutText(writer, %s);" % value
+    raise AssertionError(kind)
+
+
+def encode_statements(field, target, presence=None, guard=None):
+    """Delimiter and value; with a presence bit the value is only written if set,
+    with a guard only if the field mask selects it."""
+    lines = ["nmeaPutChar(writer, ',');"]
+    if presence is None:
+        lines.append(encode_value(field, target))
+        return lines
+    if guard:
+        lines.append("#if %s" % guard)
+    lines += ["if (sentence->presentFields & %s)" % presence,
+              "{",
+              "  " + encode_value(field, target),
+              "}"]
+    if guard:
+        lines.append("#endif")
+    return lines
+
+
+def wrap_condition(prefix, bits, suffix, width=120):
+    """prefix + bits joined with '|' + suffix, continued with backslashes past width."""
+    lines = [prefix]
+    for i, bit in enumerate(bits):
+        item = bit + (" | " if i + 1 < len(bits) else suffix)
+        if len(lines[-1]) + len(item.rstrip()) > width - 2:
+            lines[-1] = lines[-1].rstrip() + " \\"
+            lines.append("    ")
+        lines[-1] += item
+    return lines
+
+
+def indent(lines, level):
+    """Indents C lines; preprocessor lines stay in the first column."""
+    return [("  " * level + line) if line and not line.startswith("#") else line for line in lines]
+
+
+def generate_decoder(sentence, groups):
+    sid = sentence["id"]
+    temporaries = set()
+    # Temporaries only masked fields use: declaration -> their presence bits
+    masked_temporaries = {}
+    body = []
+    for field in sentence["fields"]:
+        if field["type"] != "group":
+            used = {("NmeaField", "field")}
+            guard = field_guard(sentence, field)
+            statements = ["field = nmeaNextField(cursor);",
+                          "present |= field.length ? %s : 0;" % presence_macro(sid, field)]
+            statements += decode_statements(field, "sentence->", used, "field")
+            if guard is None:
+                body += statements
+                temporaries |= used
+                continue
+            body += ["#if %s" % guard] + statements + ["#else", "(void)nmeaNextField(cursor);", "#endif"]
+            for temporary in used:
+                masked_temporaries.setdefault(temporary, []).append(presence_macro(sid, field))
+            continue
+        group = groups[field["group"]]
+        count = "sentence->%s" % field["count"]
+        temporaries.add(("uint8_t", "i"))
+        if field.get("trailing"):
+            body.append("for (i = 0; i < %s && cursor->next < cursor->end; i++)" % field["size"])
+        else:
+            body += [
+                "if (%s > %s)" % (count, field["size"]),
+                "{",
+                "  return false;",
+                "}",
+                "for (i = 0; i < %s; i++)" % count,
+            ]
+        body += [
+            "{",
+            "  %s *entry = &sentence->%s[i];" % (group["name"], field["name"]),
+        ]
+        for member in group["fields"]:
+            body += indent(decode_statements(member, "entry->", temporaries), 1)
+        body.append("}")
+        if field.get("trailing"):
+            body.append("%s = i;" % count)
+    body += ["sentence->presentFields = present;", "sentence->checksum = checksum;", "return ok;"]
+
+    lines = ["static bool decode%s(NmeaCursor *cursor, uint8_t checksum, SENTENCE_%s *sentence)" % (sid, sid),
+             "{",
+             "  uint32_t present = 0;",
+             "  bool ok = true;"]
+    all_bits = [presence_macro(sid, f) for f in presence_fields(sentence)]
+    for ctype, name in sorted(temporaries | set(masked_temporaries)):
+        bits = masked_temporaries.get((ctype, name))
+        if bits and (ctype, name) not in temporaries:
+            if len(bits) == len(all_bits):
+                lines.append("#if %s & %s_ALL_PRESENT" % (mask_macro(sid), sid))
+            else:
+                lines += wrap_condition("#if %s & (" % mask_macro(sid), bits, ")")
+            lines.append("  %s %s;" % (ctype, name))
+            lines.append("#endif")
+        else:
+            lines.append("  %s %s;" % (ctype, name))
+    lines.append("")
+    lines += indent(body, 1)
+    lines.append("}")
+    return lines
+
+
+def generate_encoder(sentence, groups):
+    sid = sentence["id"]
+    body = []
+    needs_index = False
+    for field in sentence["fields"]:
+        if field["type"] != "group":
+            body += encode_statements(field, "sentence->", presence_macro(sid, field), field_guard(sentence, field))
+            continue
+        needs_index = True
+        group = groups[field["group"]]
+        count = "sentence->%s" % field["count"]
+        body += [
+            "for (i = 0; i < %s && i < %s; i++)" % (count, field["size"]),
+            "{",
+            "  const %s *entry = &sentence->%s[i];" % (group["name"], field["name"]),
+        ]
+        for member in group["fields"]:
+            body += indent(encode_statements(member, "entry->"), 1)
+        body.append("}")
+
+    lines = ["static void encode%s(const SENTENCE_%s *sentence, NmeaWriter *writer)" % (sid, sid), "{"]
+    if needs_index:
+        lines += ["  uint8_t i;", ""]
+    lines += indent(body, 1)
+    lines.append("}")
+    return lines
+
+
+def generate_source(spec, groups):
+    out = ["/* %s */" % GENERATED_NOTE, "", '#include "nmeaSentences.h"', ""]
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        out.append("#if CFG_SENTENCE_%s_ENABLED" % sid)
+        out += generate_decoder(sentence, groups)
+        out.append("")
+        out += generate_encoder(sentence, groups)
+        out += ["#endif // CFG_SENTENCE_%s_ENABLED" % sid, ""]
+
+    out += [
+        "NmeaStatus nmeaDecodeFields(NmeaCursor *cursor, uint8_t checksum, NmeaSentence *sentence)",
+        "{",
+        "  bool ok;",
+        "",
+        "  switch (sentence->addressField.sentenceId)",
+        "  {",
+    ]
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        out += [
+            "#if CFG_SENTENCE_%s_ENABLED" % sid,
+            "  case %s:" % sid,
+            "    ok = decode%s(cursor, checksum, &sentence->%s);" % (sid, member_name(sentence)),
+            "    break;",
+            "#endif",
+        ]
+    out += [
+        "  default:",
+        "    return NMEA_ERROR_UNSUPPORTED;",
+        "  }",
+        "  return ok ? NMEA_OK : NMEA_ERROR_FIELD;",
+        "}",
+        "",
+        "NmeaStatus nmeaEncodeFields(const NmeaSentence *sentence, NmeaWriter *writer)",
+        "{",
+        "  switch (sentence->addressField.sentenceId)",
+        "  {",
+    ]
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        out += [
+            "#if CFG_SENTENCE_%s_ENABLED" % sid,
+            "  case %s:" % sid,
+            "    encode%s(&sentence->%s, writer);" % (sid, member_name(sentence)),
+            "    return NMEA_OK;",
+            "#endif",
+        ]
+    out += [
+        "  default:",
+        "    return NMEA_ERROR_UNSUPPORTED;",
+        "  }",
+        "}",
+        "",
+        "char nmeaSentenceDelimiter(SentenceID sentenceId)",
+        "{",
+        "  switch (sentenceId)",
+        "  {",
+    ]
+    for delimiter in ("$", "!"):
+        members = [s for s in spec["sentences"] if s.get("delimiter", "$") == delimiter]
+        if not members:
+            continue
+        for sentence in members:
+            out += [
+                "#if CFG_SENTENCE_%s_ENABLED" % sentence["id"],
+                "  case %s:" % sentence["id"],
+                "#endif",
+            ]
+        out.append("    return '%s';" % delimiter)
+    out += [
+        "  default:",
+        "    return '\\0';",
+        "  }",
+        "}",
+    ]
+    return "\n".join(out) + "\n"
+
+
+# ---------------------------------------------------------------------------
+# nmeaConfig.h
+
+
+def current_defines(text):
+    """Values of the #defines in text, up to a trailing comment."""
+    return dict(re.findall(r"^#define\s+(\w+)\s+(.*?)\s*(?:/[*/].*)?$", text, re.MULTILINE))
+
+
+def generate_config_regions(spec, existing):
+    switches = []
+    for sentence in spec["sentences"]:
+        name = "CFG_SENTENCE_%s_ENABLED" % sentence["id"]
+        switches.append("#define %s %s" % (name, existing.get(name, "true")))
+    parameters = []
+    for parameter in spec.get("parameters", []):
+        name = parameter["name"]
+        parameters.append("#define %s %s" % (name, existing.get(name, parameter["value"])))
+    masks = []
+    for sentence in spec["sentences"]:
+        name = mask_macro(sentence["id"])
+        masks.append("#define %s %s" % (name, existing.get(name, "%s_ALL_PRESENT" % sentence["id"])))
+    return {"sentence switches": switches, "sentence parameters": parameters, "sentence field masks": masks}
+
+
+# ---------------------------------------------------------------------------
+# tools/nmeaTestVectors.h
+
+
+def checksum(body):
+    value = 0
+    for c in body:
+        value ^= ord(c)
+    return value
+
+
+def generate_vectors(spec):
+    out = [
+        "/* %s */" % GENERATED_NOTE,
+        "",
+        "#ifndef TOOLS_NMEA_TEST_VECTORS_H_",
+        "#define TOOLS_NMEA_TEST_VECTORS_H_",
+        "",
+        '#include "nmeaSentences.h"',
+        "",
+        "/**",
+        " * @brief Example sentence of an enabled sentence type.",
+        " *",
+        " * Every example is in canonical form: decoding it and encoding the result",
+        " * reproduces the sentence exactly.",
+        " */",
+        "typedef struct NmeaTestVector",
+        "{",
+        "  SentenceID sentenceId; /**< Sentence formatter of the example */",
+        "  const char *sentence;  /**< Complete sentence including checksum and CR/LF */",
+        "} NmeaTestVector;",
+        "",
+        "/** Test vectors, terminated by an entry with a NULL sentence. */",
+        "static const NmeaTestVector NMEA_TEST_VECTORS[] = {",
+    ]
+    for sentence in spec["sentences"]:
+        sid = sentence["id"]
+        examples = sentence.get("examples", [])
+        if not examples:
+            continue
+        out.append("#if CFG_SENTENCE_%s_ENABLED" % sid)
+        for example in examples:
+            if example[0] != sentence.get("delimiter", "$") or example[3:6] != sid:
+                fail("example '%s' does not match sentence %s" % (example, sid))
+            full = "%s*%02X" % (example, checksum(example[1:]))
+            out.append('    {%s, "%s\\r\\n"},' % (sid, full.replace('"', '\\"')))
+        out.append("#endif")
+    out += [
+        "    {(SentenceID)0, 0}};",
+        "",
+        "#endif",
+    ]
+    return "\n".join(out) + "\n"
+
+
+# ---------------------------------------------------------------------------
+
+
+def replace_region(text, region, lines, path):
+    begin = "/* BEGIN GENERATED: %s */" % region
+    end = "/* END GENERATED: %s */" % region
+    pattern = re.compile(re.escape(begin) + r"\n.*?" + re.escape(end), re.DOTALL)
+    if not pattern.search(text):
+        fail("%s has no '%s' region" % (os.path.relpath(path, ROOT), region))
+    body = "\n".join(lines)
+    return pattern.sub(lambda _: "%s\n%s\n%s" % (begin, body, end), text)
+
+
+def main(argv):
+    check = "--check" in argv[1:]
+    spec, groups = load_spec()
+
+    outputs = {}
+
+    with open(CONFIG_PATH, encoding="utf-8") as f:
+        config = f.read()
+    for region, lines in generate_config_regions(spec, current_defines(config)).items():
+        config = replace_region(config, region, lines, CONFIG_PATH)
+    outputs[CONFIG_PATH] = config
+
+    with open(HEADER_PATH, encoding="utf-8") as f:
+        header = f.read()
+    outputs[HEADER_PATH] = replace_region(header, "sentence structures",
+                                          generate_header_region(spec, groups), HEADER_PATH)
+
+    outputs[SOURCE_PATH] = generate_source(spec, groups)
+    outputs[VECTORS_PATH] = generate_vectors(spec)
+
+    stale = []
+    for path, text in outputs.items():
+        try:
+            with open(path, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current == text:
+            continue
+        stale.append(os.path.relpath(path, ROOT))
+        if not check:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(text)
+
+    if check and stale:
+        sys.stderr.write("nmeagen: out of date: %s\n" % ", ".join(stale))
+        return 1
+    for path in stale:
+        print("nmeagen: wrote %s" % path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
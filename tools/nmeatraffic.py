@@ -0,0 +1,527 @@
+#!/usr/bin/env python3
+"""Synthetic ship's NMEA traffic generator for load testing.
+
+Simulates the sensors of one ship and the traffic around it and writes the
+sentences, with valid checksums, to a file, a pseudo terminal or UDP:
+
+  GNSS      GPGGA, GPRMC, GPVTG at 10 Hz, GPGSA, GPGSV, GPZDA at 1 Hz
+  gyro      HEHDT at 50 Hz
+  AIS       !AIVDM position reports (type 1) of the surrounding vessels at
+            the reporting interval of their speed
+  alerts    ALF on every alert state change and ALC every 30 s from each
+            alert source, ACN when the bridge acknowledges an alert
+  depth     SDDPT at 1 Hz
+  wind      WIMWV at 1 Hz
+
+Own ship and vessels move by dead reckoning with slowly wandering courses;
+alerts are raised at random, acknowledged after a while and rectified.
+The output is reproducible for a given --seed and --start.
+
+Usage:
+  tools/nmeatraffic.py [--output FILE | --pty | --udp HOST:PORT]
+                       [--duration SECONDS] [--rate N|max] [--speed F]
+                       [--vessels N] [--alerts N] [--seed N]
+                       [--start YYYY-MM-DDTHH:MM:SS] [--position LAT,LON]
+
+--output writes to FILE (default standard output), --pty creates a pseudo
+terminal and prints its name for the consumer to open, --udp sends every
+sentence as one datagram. --duration is in simulated seconds, 0 runs until
+interrupted (default 60).
+
+Pacing: by default the sentences are written in real time, --speed scales
+the simulated clock (--speed 10 plays ten seconds per second). --rate
+paces the output to N sentences per second regardless of the simulated
+clock, --rate max writes as fast as the destination accepts, which
+saturates a pty or UDP consumer; to saturate a parser at its native speed,
+write a file with --rate max and feed that.
+
+--vessels is the number of AIS targets (default 50), --alerts the mean
+number of alerts raised per hour (default 30).
+"""
+
+import datetime
+import heapq
+import math
+import os
+import random
+import socket
+import sys
+import time
+
+DEFAULT_DURATION = 60.0
+DEFAULT_VESSELS = 50
+DEFAULT_ALERTS = 30.0
+DEFAULT_POSITION = (53.5, 8.3)
+AIS_RANGE = 12.0  # NM around own ship in which the vessels start
+FLUSH_SIZE = 8192  # bytes buffered for files and ptys at --rate max
+STATS_INTERVAL = 5.0  # seconds of wall time between rate reports
+
+# Alert sources: (talker, alert identifier, category, priority, text)
+ALERTS = [
+    ("RA", 3008, "B", "W", "LOST TARGET"),
+    ("RA", 3015, "B", "A", "CPA/TCPA"),
+    ("GP", 3016, "B", "W", "LOSS OF POSITION"),
+    ("SD", 3119, "B", "A", "DEPTH BELOW KEEL"),
+    ("HE", 3036, "B", "W", "HEADING DEVIATION"),
+]
+ALC_ENTRIES_PER_SENTENCE = 5  # keeps ALC within 82 characters
+
+
+def fail(message):
+    sys.stderr.write("nmeatraffic: %s\n" % message)
+    sys.exit(2)
+
+
+def checksum(body):
+    value = 0
+    for c in body.encode("ascii"):
+        value ^= c
+    return value
+
+
+def sentence(start, body):
+    """start is "$" or "!", body the text between it and the checksum."""
+    return "%s%s*%02X\r\n" % (start, body, checksum(body))
+
+
+def wrap360(angle):
+    return angle % 360.0
+
+
+def nmea_time(clock):
+    return "%02d%02d%02d.%02d" % (clock.hour, clock.minute, clock.second, clock.microsecond // 10000)
+
+
+def degrees_minutes(degrees):
+    """Whole degrees and minutes of a magnitude, rounded to the 1/10000 minute
+    written before the carry so the minutes never print as 60."""
+    steps = int(round(abs(degrees) * 600000.0))
+    return steps // 600000, (steps % 600000) / 10000.0
+
+
+def nmea_latitude(latitude):
+    return "%02d%07.4f,%s" % (degrees_minutes(latitude) + ("N" if latitude >= 0 else "S",))
+
+
+def nmea_longitude(longitude):
+    return "%03d%07.4f,%s" % (degrees_minutes(longitude) + ("E" if longitude >= 0 else "W",))
+
+
+# ---------------------------------------------------------------------------
+# Simulation
+
+
+class Mover:
+    """A ship moving by dead reckoning, its course wandering at random."""
+
+    def __init__(self, rng, latitude, longitude, course, speed, wander):
+        self.rng = rng
+        self.latitude = latitude
+        self.longitude = longitude
+        self.course = course
+        self.speed = speed  # knots
+        self.wander = wander  # standard deviation of the course change, degrees per sqrt(second)
+        self.rate_of_turn = 0.0  # degrees per minute
+        self.time = 0.0
+
+    def advance(self, now):
+        dt = now - self.time
+        if dt <= 0.0:
+            return
+        self.time = now
+        change = self.rng.gauss(0.0, self.wander * math.sqrt(dt))
+        self.rate_of_turn = change / dt * 60.0
+        self.course = wrap360(self.course + change)
+        distance = self.speed * dt / 3600.0 / 60.0  # degrees of latitude
+        self.latitude += distance * math.cos(math.radians(self.course))
+        self.longitude += distance * math.sin(math.radians(self.course)) / math.cos(math.radians(self.latitude))
+
+
+class Alert:
+    def __init__(self, definition, instance, raised):
+        self.talker, self.identifier, self.category, self.priority, self.text = definition
+        self.instance = instance
+        self.state = "V"
+        self.revision = 1
+        self.changed = raised
+
+
+class World:
+    def __init__(self, rng, start, position, vessels, alerts_per_hour):
+        self.rng = rng
+        self.start = start
+        self.own = Mover(rng, position[0], position[1], rng.uniform(0.0, 360.0), 12.0, 0.05)
+        self.vessels = []
+        for index in range(vessels):
+            bearing = rng.uniform(0.0, 360.0)
+            distance = AIS_RANGE * math.sqrt(rng.random()) / 60.0
+            anchored = rng.random() < 0.1
+            vessel = Mover(rng,
+                           position[0] + distance * math.cos(math.radians(bearing)),
+                           position[1] + distance * math.sin(math.radians(bearing)) /
+                           math.cos(math.radians(position[0])),
+                           rng.uniform(0.0, 360.0), 0.0 if anchored else rng.uniform(4.0, 25.0),
+                           0.0 if anchored else rng.uniform(0.02, 0.3))
+            vessel.mmsi = 211000000 + index * 7919 % 1000000
+            vessel.anchored = anchored
+            self.vessels.append(vessel)
+        self.alert_probability = alerts_per_hour / 3600.0  # per second
+        self.alerts = []
+        self.instances = {}
+        self.sequence = {}
+        self.depth = 25.0
+        self.wind_angle = rng.uniform(0.0, 360.0)
+        self.wind_speed = rng.uniform(5.0, 25.0)
+        self.satellites = [(prn, rng.randint(5, 85), rng.randint(0, 359), rng.randint(25, 48))
+                           for prn in sorted(rng.sample(range(1, 33), 10))]
+
+    def clock(self, now):
+        return self.start + datetime.timedelta(seconds=now)
+
+    def next_sequence(self, key):
+        value = self.sequence.get(key, -1)
+        self.sequence[key] = (value + 1) % 10
+        return self.sequence[key]
+
+
+# ---------------------------------------------------------------------------
+# Sources: each returns the sentences it emits at a given simulated time and
+# the interval until it next emits
+
+
+def gnss_fast(world, now):
+    own = world.own
+    own.advance(now)
+    clock = world.clock(now)
+    position = "%s,%s" % (nmea_latitude(own.latitude), nmea_longitude(own.longitude))
+    return [
+        sentence("$", "GPGGA,%s,%s,1,%02d,0.9,%.1f,M,46.9,M,," %
+                 (nmea_time(clock), position, len(world.satellites), 12.0 + world.rng.gauss(0.0, 0.3))),
+        sentence("$", "GPRMC,%s,A,%s,%.1f,%.1f,%s,1.2,E,A,S" %
+                 (nmea_time(clock), position, own.speed, own.course, clock.strftime("%d%m%y"))),
+        sentence("$", "GPVTG,%.1f,T,%.1f,M,%.1f,N,%.1f,K,A" %
+                 (own.course, wrap360(own.course - 1.2), own.speed, own.speed * 1.852)),
+    ], 0.1
+
+
+def gnss_slow(world, now):
+    clock = world.clock(now)
+    sentences = []
+    used = ",".join("%02d" % s[0] for s in world.satellites) + "," * (12 - len(world.satellites))
+    sentences.append(sentence("$", "GPGSA,A,3,%s,1.8,0.9,1.5" % used))
+    total = (len(world.satellites) + 3) // 4
+    for number in range(total):
+        group = world.satellites[number * 4:number * 4 + 4]
+        fields = "".join(",%02d,%02d,%03d,%02d" % (prn, elevation, azimuth,
+                                                   max(0, snr + world.rng.randint(-2, 2)))
+                         for prn, elevation, azimuth, snr in group)
+        sentences.append(sentence("$", "GPGSV,%d,%d,%02d%s" % (total, number + 1, len(world.satellites), fields)))
+    sentences.append(sentence("$", "GPZDA,%s,%02d,%02d,%04d,00,00" %
+                              (nmea_time(clock), clock.day, clock.month, clock.year)))
+    return sentences, 1.0
+
+
+def gyro(world, now):
+    own = world.own
+    own.advance(now)
+    # The heading swings about the course with the yaw of the hull
+    heading = wrap360(own.course + 1.5 * math.sin(now * 2.0 * math.pi / 8.0))
+    return [sentence("$", "HEHDT,%.1f,T" % heading)], 0.02
+
+
+def depth(world, now):
+    world.depth = min(200.0, max(4.0, world.depth + world.rng.gauss(0.0, 0.5)))
+    return [sentence("$", "SDDPT,%.1f,0.5,200.0" % world.depth)], 1.0
+
+
+def wind(world, now):
+    world.wind_angle = wrap360(world.wind_angle + world.rng.gauss(0.0, 3.0))
+    world.wind_speed = min(60.0, max(0.0, world.wind_speed + world.rng.gauss(0.0, 0.5)))
+    return [sentence("$", "WIMWV,%.1f,R,%.1f,N,A" % (world.wind_angle, world.wind_speed))], 1.0
+
+
+def ais_armor(bits):
+    """Packs (value, width) pairs into the six-bit AIS payload characters."""
+    text = "".join(format(value & ((1 << width) - 1), "0%db" % width) for value, width in bits)
+    fill = -len(text) % 6
+    text += "0" * fill
+    payload = ""
+    for i in range(0, len(text), 6):
+        value = int(text[i:i + 6], 2)
+        payload += chr(value + 48 if value < 40 else value + 56)
+    return payload, fill
+
+
+def ais_interval(vessel):
+    """Class A reporting interval in seconds."""
+    if vessel.anchored:
+        return 180.0
+    if vessel.speed > 23.0:
+        return 2.0
+    if abs(vessel.rate_of_turn) > 5.0 or vessel.speed > 14.0:
+        return 6.0 if vessel.speed <= 14.0 else 2.0
+    return 10.0
+
+
+def ais_vessel(vessel):
+    def report(world, now):
+        vessel.advance(now)
+        rot = max(-126, min(126, int(round(4.733 * math.sqrt(abs(vessel.rate_of_turn))))))
+        rot = rot if vessel.rate_of_turn >= 0 else -rot
+        payload, fill = ais_armor([
+            (1, 6), (0, 2), (vessel.mmsi, 30),
+            (1 if vessel.anchored else 0, 4),
+            (rot, 8),
+            (int(round(vessel.speed * 10.0)), 10),
+            (1, 1),
+            (int(round(vessel.longitude * 600000.0)), 28),
+            (int(round(vessel.latitude * 600000.0)), 27),
+            (int(round(vessel.course * 10.0)) % 3600, 12),
+            (int(round(vessel.course)) % 360, 9),
+            (int(now) % 60, 6),
+            (0, 2), (0, 3), (0, 1),
+            (world.rng.getrandbits(19), 19),
+        ])
+        channel = "A" if world.rng.random() < 0.5 else "B"
+        return [sentence("!", "AIVDM,1,1,,%s,%s,%d" % (channel, payload, fill))], ais_interval(vessel)
+    return report
+
+
+def alf(world, alert):
+    return sentence("$", "%sALF,1,1,%d,%s,%s,%s,%s,,%d,%d,%d,0,%s" %
+                    (alert.talker, world.next_sequence((alert.talker, "ALF")),
+                     nmea_time(world.clock(alert.changed)), alert.category, alert.priority, alert.state,
+                     alert.identifier, alert.instance, alert.revision, alert.text))
+
+
+def change_alert(world, alert, now, state):
+    alert.state = state
+    alert.changed = now
+    alert.revision = alert.revision % 99 + 1
+    return alf(world, alert)
+
+
+def alert_manager(world, now):
+    """Raises, acknowledges and rectifies alerts, checked once a second."""
+    rng = world.rng
+    sentences = []
+    if rng.random() < world.alert_probability:
+        definition = rng.choice(ALERTS)
+        key = definition[:2]
+        world.instances[key] = world.instances.get(key, 0) % 999999 + 1
+        alert = Alert(definition, world.instances[key], now)
+        alert.acknowledge_at = now + rng.uniform(5.0, 60.0)
+        alert.rectify_at = alert.acknowledge_at + rng.uniform(30.0, 600.0)
+        world.alerts.append(alert)
+        sentences.append(alf(world, alert))
+    for alert in list(world.alerts):
+        if alert.state == "V" and now >= alert.acknowledge_at:
+            sentences.append(sentence("$", "IIACN,%s,,%d,%d,A,C" %
+                                      (nmea_time(world.clock(now)), alert.identifier, alert.instance)))
+            sentences.append(change_alert(world, alert, now, "A"))
+        elif alert.state == "A" and now >= alert.rectify_at:
+            sentences.append(change_alert(world, alert, now, "N"))
+            world.alerts.remove(alert)
+    return sentences, 1.0
+
+
+def alert_cyclic(talker):
+    def report(world, now):
+        alerts = [a for a in world.alerts if a.talker == talker]
+        chunks = [alerts[i:i + ALC_ENTRIES_PER_SENTENCE]
+                  for i in range(0, len(alerts), ALC_ENTRIES_PER_SENTENCE)] or [[]]
+        sequence = world.next_sequence((talker, "ALC"))
+        sentences = []
+        for number, chunk in enumerate(chunks):
+            entries = "".join(",,%d,%d,%d" % (a.identifier, a.instance, a.revision) for a in chunk)
+            sentences.append(sentence("$", "%sALC,%02d,%02d,%02d,%d%s" %
+                                      (talker, len(chunks), number + 1, sequence, len(chunk), entries)))
+        return sentences, 30.0
+    return report
+
+
+def make_sources(world):
+    """(first emission, source) pairs; sources at the same rate are staggered
+    so their sentences do not arrive in bursts."""
+    rng = world.rng
+    sources = [(0.0, gnss_fast), (0.0, gnss_slow), (0.0, gyro), (0.3, depth), (0.6, wind), (0.9, alert_manager)]
+    for talker in sorted(set(a[0] for a in ALERTS)):
+        sources.append((rng.uniform(0.0, 30.0), alert_cyclic(talker)))
+    for vessel in world.vessels:
+        sources.append((rng.uniform(0.0, ais_interval(vessel)), ais_vessel(vessel)))
+    return sources
+
+
+def generate(world, duration):
+    """Yields (simulated time, sentence) in time order."""
+    # Whole milliseconds, so that 10 Hz stays on the tenths of a second
+    queue = [(int(round(first * 1000.0)), index, source)
+             for index, (first, source) in enumerate(make_sources(world))]
+    heapq.heapify(queue)
+    while queue:
+        milliseconds, index, source = heapq.heappop(queue)
+        now = milliseconds / 1000.0
+        if duration > 0.0 and now >= duration:
+            return
+        sentences, interval = source(world, now)
+        for text in sentences:
+            yield now, text
+        heapq.heappush(queue, (milliseconds + int(round(interval * 1000.0)), index, source))
+
+
+# ---------------------------------------------------------------------------
+# Destinations
+
+
+class StreamOutput:
+    def __init__(self, fd, buffered):
+        self.fd = fd
+        self.buffered = buffered
+        self.pending = bytearray()
+
+    def write(self, data):
+        self.pending += data
+        if not self.buffered or len(self.pending) >= FLUSH_SIZE:
+            self.flush()
+
+    def flush(self):
+        written = 0
+        while written < len(self.pending):
+            written += os.write(self.fd, self.pending[written:])
+        del self.pending[:]
+
+
+class UdpOutput:
+    def __init__(self, address):
+        host, _, port = address.rpartition(":")
+        try:
+            self.address = (host or "127.0.0.1", int(port))
+        except ValueError:
+            fail("bad UDP address %s, expected HOST:PORT" % address)
+        self.socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    def write(self, data):
+        self.socket.sendto(data, self.address)
+
+    def flush(self):
+        pass
+
+
+def open_pty():
+    import tty
+
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    sys.stderr.write("nmeatraffic: writing to %s\n" % os.ttyname(slave))
+    # Keep the slave open, otherwise writes fail until the consumer opens it
+    return master, slave
+
+
+# ---------------------------------------------------------------------------
+
+
+def option(args, name, default, convert):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    try:
+        return convert(value)
+    except ValueError:
+        fail("bad value for %s: %s" % (name, value))
+
+
+def parse_rate(value):
+    rate = math.inf if value == "max" else float(value)
+    if rate <= 0.0:
+        raise ValueError(value)
+    return rate
+
+
+def parse_position(value):
+    latitude, longitude = (float(v) for v in value.split(","))
+    return latitude, longitude
+
+
+def parse_start(value):
+    return datetime.datetime.strptime(value, "%Y-%m-%dT%H:%M:%S")
+
+
+def main(argv):
+    args = argv[1:]
+    output = option(args, "--output", None, str)
+    udp = option(args, "--udp", None, str)
+    use_pty = "--pty" in args
+    if use_pty:
+        args.remove("--pty")
+    duration = option(args, "--duration", DEFAULT_DURATION, float)
+    rate = option(args, "--rate", None, parse_rate)  # None: real time
+    speed = option(args, "--speed", 1.0, float)
+    vessels = option(args, "--vessels", DEFAULT_VESSELS, int)
+    alerts = option(args, "--alerts", DEFAULT_ALERTS, float)
+    seed = option(args, "--seed", 1, int)
+    position = option(args, "--position", DEFAULT_POSITION, parse_position)
+    start = option(args, "--start", None, parse_start)
+    if args:
+        sys.stderr.write(__doc__)
+        return 2
+    if (output is not None) + (udp is not None) + use_pty > 1:
+        fail("choose one of --output, --pty and --udp")
+    if speed <= 0.0 or vessels < 0 or alerts < 0.0:
+        fail("--speed must be positive, --vessels and --alerts not negative")
+    if start is None:
+        start = datetime.datetime.utcnow().replace(microsecond=0)
+
+    buffered = rate == math.inf
+    if udp is not None:
+        destination = UdpOutput(udp)
+    elif use_pty:
+        master, _ = open_pty()
+        destination = StreamOutput(master, buffered)
+    elif output is not None and output != "-":
+        try:
+            destination = StreamOutput(os.open(output, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o644),
+                                       buffered)
+        except OSError as error:
+            fail("%s: %s" % (output, error))
+    else:
+        destination = StreamOutput(sys.stdout.fileno(), buffered)
+
+    world = World(random.Random(seed), start, position, vessels, alerts)
+    began = time.monotonic()
+    reported = began
+    count = 0
+    size = 0
+    try:
+        for now, text in generate(world, duration):
+            if rate is None:
+                wait = began + now / speed - time.monotonic()
+            else:
+                wait = began + count / rate - time.monotonic()
+            if wait > 0.0:
+                destination.flush()
+                time.sleep(wait)
+            data = text.encode("ascii")
+            destination.write(data)
+            count += 1
+            size += len(data)
+            if count % 1024 == 0 and time.monotonic() - reported >= STATS_INTERVAL:
+                reported = time.monotonic()
+                sys.stderr.write("nmeatraffic: %d sentences, %.0f sentences/s\n" %
+                                 (count, count / (reported - began)))
+        destination.flush()
+    except KeyboardInterrupt:
+        pass
+    except BrokenPipeError:
+        return 0
+    elapsed = max(time.monotonic() - began, 1e-9)
+    sys.stderr.write("nmeatraffic: %d sentences, %d bytes in %.1f s, %.0f sentences/s\n" %
+                     (count, size, elapsed, count / elapsed))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""Worst-case stack usage report.
+
+Compiles the sources with GCC's -fstack-usage and -fcallgraph-info=su, which
+record the frame size of every function and the calls it makes, walks the
+call graph from the public entry points and reports the deepest path of
+each. For the byte-feed path it also reports the worst case per enabled
+sentence, i.e. through that sentence's decoder.
+
+The frame sizes are those of the build being analysed, so pass the flags of
+the target build (the defaults are a typical size optimised build). A
+decoder the compiler inlined has no frame of its own; its sentence is then
+charged the frame it was inlined into.
+
+Exits with status 1 if nmeaFeedByte() or nmeaFeed() needs more than
+NMEA_STACK_BUDGET (inc/nmeaConfig.h) bytes, or if the depth cannot be
+bounded (recursion, unbounded dynamic allocation). The parser callback is
+user code, called through a pointer, and not included: add its own stack.
+
+Usage:
+  tools/stackreport.py [--cc COMPILER] [--cflags "FLAGS"] [--all]
+
+--all lists every global function, not only the main entry points. Use a
+cross compiler for target figures, e.g. --cc arm-none-eabi-gcc
+--cflags "-Os -mcpu=cortex-m4 -mthumb".
+"""
+
+import glob
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CONFIG_PATH = os.path.join(ROOT, "inc", "nmeaConfig.h")
+SOURCES = sorted(glob.glob(os.path.join(ROOT, "src", "*.c")))
+
+DEFAULT_CFLAGS = "-std=c99 -Os"
+ENTRY_POINTS = ["nmeaFeedByte", "nmeaFeed", "nmeaDecode", "nmeaEncode"]
+BUDGETED = ["nmeaFeedByte", "nmeaFeed"]
+DECODERS_CALLER = "nmeaDecodeFields"
+INDIRECT_CALL = "__indirect_call"
+
+NODE = re.compile(r'^node: \{ title: "([^"]+)" label: "([^"]*)"')
+EDGE = re.compile(r'^edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+FRAME = re.compile(r"\\n(\d+) bytes \(([^)]*)\)")
+
+
+def fail(message):
+    sys.stderr.write("stackreport: %s\n" % message)
+    sys.exit(2)
+
+
+def option(args, name, default):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def read_config():
+    with open(CONFIG_PATH, encoding="utf-8") as f:
+        defines = dict(re.findall(r"^#define\s+(\w+)\s+(\S+)", f.read(), re.MULTILINE))
+    if "NMEA_STACK_BUDGET" not in defines:
+        fail("NMEA_STACK_BUDGET missing from %s" % os.path.relpath(CONFIG_PATH, ROOT))
+    sentences = sorted(re.match(r"CFG_SENTENCE_(\w+)_ENABLED", name).group(1)
+                       for name, value in defines.items()
+                       if re.match(r"CFG_SENTENCE_\w+_ENABLED$", name) and value == "true")
+    return int(defines["NMEA_STACK_BUDGET"]), sentences
+
+
+def build_graph(cc, cflags):
+    """Returns {function: (frame bytes, qualifiers)} and {function: set of callees}."""
+    frames = {}
+    calls = {}
+    with tempfile.TemporaryDirectory() as work:
+        command = [cc] + shlex.split(cflags) + ["-I" + os.path.join(ROOT, "inc"), "-Wno-multichar",
+                                                 "-fstack-usage", "-fcallgraph-info=su", "-c"] + SOURCES
+        try:
+            subprocess.run(command, cwd=work, check=True)
+        except (OSError, subprocess.CalledProcessError) as error:
+            fail("compilation failed: %s" % error)
+        for path in glob.glob(os.path.join(work, "*.ci")):
+            with open(path, encoding="utf-8") as f:
+                for line in f:
+                    match = NODE.match(line)
+                    if match:
+                        frame = FRAME.search(match.group(2))
+                        if frame:
+                            frames[match.group(1)] = (int(frame.group(1)), frame.group(2))
+                        continue
+                    match = EDGE.match(line)
+                    if match:
+                        calls.setdefault(match.group(1), set()).add(match.group(2))
+    return frames, calls
+
+
+def short_name(function):
+    """Static functions are titled file:name."""
+    return function.rsplit(":", 1)[-1]
+
+
+class Walker:
+    """Deepest path from a function, memoised, with the problems met on the way."""
+
+    def __init__(self, frames, calls):
+        self.frames = frames
+        self.calls = calls
+        self.memo = {}
+        self.active = set()
+        self.unknown = set()
+        self.unbounded = set()
+        self.indirect = False
+
+    def callees(self, function, sentence):
+        callees = self.calls.get(function, set())
+        if sentence is None or function != DECODERS_CALLER:
+            return callees
+        # Through one sentence: only its decoder, and whatever the inlined
+        # decoders call directly
+        return {c for c in callees if not short_name(c).startswith("decode") or short_name(c) == "decode" + sentence}
+
+    def depth(self, function, sentence=None):
+        """Returns (bytes, path)."""
+        key = (function, sentence)
+        if key in self.memo:
+            return self.memo[key]
+        if function == INDIRECT_CALL:
+            self.indirect = True
+            return 0, []
+        if function not in self.frames:
+            self.unknown.add(function)
+            return 0, []
+        if function in self.active:
+            self.unbounded.add("recursion through %s" % short_name(function))
+            return 0, []
+        frame, qualifiers = self.frames[function]
+        if "dynamic" in qualifiers and "bounded" not in qualifiers:
+            self.unbounded.add("unbounded dynamic stack in %s" % short_name(function))
+        self.active.add(function)
+        worst, path = 0, []
+        for callee in sorted(self.callees(function, sentence)):
+            bytes_, callee_path = self.depth(callee, sentence)
+            if bytes_ > worst:
+                worst, path = bytes_, callee_path
+        self.active.discard(function)
+        result = (frame + worst, [(short_name(function), frame)] + path)
+        self.memo[key] = result
+        return result
+
+
+def format_path(path):
+    return " > ".join("%s(%d)" % step for step in path)
+
+
+def main(argv):
+    args = argv[1:]
+    cc = option(args, "--cc", os.environ.get("CC", "cc"))
+    cflags = option(args, "--cflags", DEFAULT_CFLAGS)
+    show_all = "--all" in args
+    if show_all:
+        args.remove("--all")
+    if args:
+        sys.stderr.write(__doc__)
+        return 2
+
+    budget, sentences = read_config()
+    frames, calls = build_graph(cc, cflags)
+    walker = Walker(frames, calls)
+
+    entry_points = list(ENTRY_POINTS)
+    if show_all:
+        entry_points += sorted(f for f in frames if ":" not in f and f not in ENTRY_POINTS)
+
+    print("Worst-case stack, %s %s\n" % (cc, cflags))
+    print("%-28s %6s  %s" % ("entry point", "bytes", "deepest path (frame bytes)"))
+    over = []
+    for function in entry_points:
+        if function not in frames:
+            fail("%s not found, is the source list complete?" % function)
+        bytes_, path = walker.depth(function)
+        print("%-28s %6d  %s" % (function, bytes_, format_path(path)))
+        if function in BUDGETED and bytes_ > budget:
+            over.append("%s needs %d bytes" % (function, bytes_))
+
+    print("\n%-28s %6s  %s" % ("nmeaFeedByte per sentence", "bytes", "deepest path"))
+    for sentence in sentences:
+        bytes_, path = walker.depth("nmeaFeedByte", sentence)
+        inlined = "" if any(step[0] == "decode" + sentence for step in path) else "  [decoder inlined]"
+        print("%-28s %6d  %s%s" % (sentence, bytes_, format_path(path), inlined))
+        if bytes_ > budget:
+            over.append("nmeaFeedByte through %s needs %d bytes" % (sentence, bytes_))
+
+    if walker.indirect:
+        print("\nIndirect calls (the parser callback) are not included: add the callback's stack.")
+    if walker.unknown:
+        print("Callees without stack information, counted as 0 bytes: %s" %
+              ", ".join(sorted(short_name(f) for f in walker.unknown)))
+    for problem in sorted(walker.unbounded):
+        print("UNBOUNDED: %s" % problem)
+    for problem in over:
+        print("OVER BUDGET: %s, NMEA_STACK_BUDGET is %d" % (problem, budget))
+    if walker.unbounded or over:
+        return 1
+    print("\nWithin NMEA_STACK_BUDGET of %d bytes." % budget)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))